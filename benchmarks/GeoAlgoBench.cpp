@@ -0,0 +1,412 @@
+/**
+ * GeoAlgoBench：各求值器的吞吐基准
+ *
+ * 按求值器 × 维数 × 次数 × 批量大小 × 线程数扫描，每项报告 ns/点 与 点/秒，
+ * 结果可写成 JSON，便于逐版本对比回归。
+ *
+ *   GeoAlgoBench [--quick] [--filter 子串] [--min-time 秒] [--repetitions n] [--json 文件|-]
+ *
+ * 每项先倍增迭代次数直到单次重复不短于 min-time / repetitions，再重复 repetitions 次取中位数。
+ */
+#include "BezierCurve.h"
+#include "BezierSegments.h"
+#include "CurveBatch.h"
+#include "GeoAlgo.h"
+#include "NURBS.h"
+#include "PowerBasisCurve.h"
+#include "PowerBasisCurve1D.h"
+#include "PowerBasisCurve2D.h"
+#include "PowerBasisCurve3D.h"
+#include "PowerBasisKernel.h"
+#include "RationalBezierCurve.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace GeoAlgo;
+
+namespace {
+
+// 防止求值结果被优化掉
+volatile double gSink = 0.0;
+
+struct Options {
+    bool quick = false;
+    std::string filter;
+    double minTime = 0.3;
+    int repetitions = 5;
+    std::string jsonPath;
+};
+
+struct Result {
+    std::string name;
+    int dim;
+    int degree;
+    std::size_t batch;
+    std::size_t threads;
+    std::size_t iterations;
+    double nsPerPoint;
+    double pointsPerSec;
+};
+
+class Runner {
+public:
+    Runner(const Options& opt, std::ostream& log) : opt_(opt), log_(log) {}
+
+    // fn 每次调用求值 points 个点；名称不含 --filter 子串的项跳过
+    void run(const std::string& name, int dim, int degree, std::size_t batch, std::size_t threads,
+             std::size_t points, const std::function<void()>& fn) {
+        if (!opt_.filter.empty() && name.find(opt_.filter) == std::string::npos) return;
+        using Clock = std::chrono::steady_clock;
+        auto timeIt = [&](std::size_t iters) {
+            const auto t0 = Clock::now();
+            for (std::size_t i = 0; i < iters; ++i) fn();
+            return std::chrono::duration<double>(Clock::now() - t0).count();
+        };
+
+        fn(); // 预热
+        const double target = opt_.minTime / opt_.repetitions;
+        std::size_t iters = 1;
+        while (timeIt(iters) < target && iters < (std::size_t(1) << 30)) iters *= 2;
+
+        std::vector<double> ns(opt_.repetitions);
+        for (double& v : ns) v = timeIt(iters) * 1e9 / (static_cast<double>(iters) * points);
+        std::sort(ns.begin(), ns.end());
+        const double median = ns[ns.size() / 2];
+
+        results_.push_back({name, dim, degree, batch, threads, iters, median, 1e9 / median});
+        log_ << std::left << std::setw(42) << name << std::right << std::setw(4) << dim << std::setw(5) << degree
+             << std::setw(9) << batch << std::setw(5) << threads << std::fixed << std::setprecision(2)
+             << std::setw(12) << median << std::setw(14) << std::setprecision(1) << 1e3 / median << std::endl;
+    }
+
+    void writeJson(std::ostream& os) const {
+        os << "{\n"
+           << "  \"library\": \"" << version() << "\",\n"
+           << "  \"simd\": \"" << simdLevelName(detectSimdLevel()) << "\",\n"
+           << "  \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n"
+#if defined(__VERSION__)
+           << "  \"compiler\": \"" << __VERSION__ << "\",\n"
+#endif
+#ifdef NDEBUG
+           << "  \"assertions\": false,\n"
+#else
+           << "  \"assertions\": true,\n"
+#endif
+           << "  \"min_time_s\": " << opt_.minTime << ",\n"
+           << "  \"repetitions\": " << opt_.repetitions << ",\n"
+           << "  \"results\": [\n";
+        os << std::setprecision(6);
+        for (std::size_t i = 0; i < results_.size(); ++i) {
+            const Result& r = results_[i];
+            os << "    {\"name\": \"" << r.name << "\", \"dim\": " << r.dim << ", \"degree\": " << r.degree
+               << ", \"batch\": " << r.batch << ", \"threads\": " << r.threads
+               << ", \"iterations\": " << r.iterations << ", \"ns_per_point\": " << r.nsPerPoint
+               << ", \"points_per_sec\": " << r.pointsPerSec << "}" << (i + 1 < results_.size() ? "," : "")
+               << "\n";
+        }
+        os << "  ]\n}\n";
+    }
+
+private:
+    Options opt_;
+    std::ostream& log_;
+    std::vector<Result> results_;
+};
+
+std::mt19937 rng(20251029);
+
+double randomCoord() {
+    return std::uniform_real_distribution<double>(-1.0, 1.0)(rng);
+}
+
+double randomWeight() {
+    return std::uniform_real_distribution<double>(0.5, 2.0)(rng);
+}
+
+std::vector<double> randomValues(int n) {
+    std::vector<double> v(n);
+    for (double& x : v) x = randomCoord();
+    return v;
+}
+
+std::vector<Point2D> randomPoints2D(int n) {
+    std::vector<Point2D> v(n);
+    for (Point2D& p : v) p = Point2D(randomCoord(), randomCoord());
+    return v;
+}
+
+std::vector<Vec3d> randomPoints3D(int n) {
+    std::vector<Vec3d> v(n);
+    for (Vec3d& p : v) p = Vec3d(randomCoord(), randomCoord(), randomCoord());
+    return v;
+}
+
+std::vector<double> randomWeights(int n) {
+    std::vector<double> v(n);
+    for (double& w : v) w = randomWeight();
+    return v;
+}
+
+// 有理 NURBS：degree+8 个控制点，clamped 均匀节点
+NURBS randomNURBS(int degree, int dim) {
+    const int n = degree + 8;
+    return NURBS(degree, dim, randomValues(n * dim), NURBS::clampedUniformKnots(n, degree), randomWeights(n));
+}
+
+std::vector<double> params(std::size_t count) {
+    std::vector<double> us(count);
+    for (std::size_t i = 0; i < count; ++i) us[i] = count == 1 ? 0.5 : static_cast<double>(i) / (count - 1);
+    return us;
+}
+
+void benchSingleThreaded(Runner& R, const std::vector<int>& degrees, const std::vector<std::size_t>& batches) {
+    for (int degree : degrees) {
+        for (std::size_t batch : batches) {
+            const std::vector<double> us = params(batch);
+            const double* u = us.data();
+            std::vector<double> xs(batch), ys(batch), zs(batch);
+            std::vector<Point2D> p2(batch);
+            std::vector<Vec3d> p3(batch);
+            std::vector<double> ders(3 * 3 * batch);
+            double* d[9];
+            for (int j = 0; j < 9; ++j) d[j] = ders.data() + j * batch;
+
+            // Bezier
+            {
+                BezierCurve bezier(randomPoints2D(degree + 1));
+                R.run("bezier.evaluate", 2, degree, batch, 1, batch, [&] {
+                    for (std::size_t i = 0; i < batch; ++i) p2[i] = bezier.evaluate(u[i]);
+                    gSink = gSink + p2[0].x;
+                });
+                R.run("bezier.evaluateMany", 2, degree, batch, 1, batch, [&] {
+                    bezier.evaluateMany(u, batch, p2.data());
+                    gSink = gSink + p2[0].x;
+                });
+                std::vector<Point2D> d2(3 * batch);
+                R.run("bezier.evaluateDerivativesMany.k2", 2, degree, batch, 1, batch, [&] {
+                    bezier.evaluateDerivativesMany(u, batch, 2, d2.data());
+                    gSink = gSink + d2[2].x;
+                });
+                bezier.cachePowerBasis();
+                R.run("bezier.evaluateMany.powerCache", 2, degree, batch, 1, batch, [&] {
+                    bezier.evaluateMany(u, batch, xs.data(), ys.data());
+                    gSink = gSink + xs[0];
+                });
+            }
+
+            // 幂基
+            {
+                const PowerBasisCurve pb(randomPoints2D(degree + 1));
+                R.run("powerBasis.evaluate", 2, degree, batch, 1, batch, [&] {
+                    for (std::size_t i = 0; i < batch; ++i) p2[i] = pb.evaluate(u[i]);
+                    gSink = gSink + p2[0].x;
+                });
+                const PowerBasisCurve1D c1(randomValues(degree + 1));
+                const PowerBasisCurve2D c2(randomValues(degree + 1), randomValues(degree + 1));
+                const PowerBasisCurve3D c3(randomValues(degree + 1), randomValues(degree + 1),
+                                           randomValues(degree + 1));
+                R.run("powerBasis1D.evaluate", 1, degree, batch, 1, batch, [&] {
+                    for (std::size_t i = 0; i < batch; ++i) xs[i] = c1.evaluate(u[i]);
+                    gSink = gSink + xs[0];
+                });
+                R.run("powerBasis1D.evaluateMany", 1, degree, batch, 1, batch, [&] {
+                    c1.evaluateMany(u, batch, xs.data());
+                    gSink = gSink + xs[0];
+                });
+                R.run("powerBasis2D.evaluateMany", 2, degree, batch, 1, batch, [&] {
+                    c2.evaluateMany(u, batch, xs.data(), ys.data());
+                    gSink = gSink + xs[0];
+                });
+                R.run("powerBasis3D.evaluate", 3, degree, batch, 1, batch, [&] {
+                    for (std::size_t i = 0; i < batch; ++i) p3[i] = c3.evaluate(u[i]);
+                    gSink = gSink + p3[0].x;
+                });
+                R.run("powerBasis3D.evaluateMany", 3, degree, batch, 1, batch, [&] {
+                    c3.evaluateMany(u, batch, xs.data(), ys.data(), zs.data());
+                    gSink = gSink + xs[0];
+                });
+                R.run("powerBasis1D.evaluateDerivativesMany.k2", 1, degree, batch, 1, batch, [&] {
+                    c1.evaluateDerivativesMany(u, batch, 2, d);
+                    gSink = gSink + d[2][0];
+                });
+                R.run("powerBasis2D.evaluateDerivativesMany.k2", 2, degree, batch, 1, batch, [&] {
+                    c2.evaluateDerivativesMany(u, batch, 2, d);
+                    gSink = gSink + d[4][0];
+                });
+                R.run("powerBasis3D.evaluateDerivativesMany.k2", 3, degree, batch, 1, batch, [&] {
+                    c3.evaluateDerivativesMany(u, batch, 2, d);
+                    gSink = gSink + d[6][0];
+                });
+                R.run("powerBasis3D.evaluateDerivatives.k2", 3, degree, batch, 1, batch, [&] {
+                    Vec3d tmp[3];
+                    for (std::size_t i = 0; i < batch; ++i) {
+                        c3.evaluateDerivatives(u[i], 2, tmp);
+                        p3[i] = tmp[2];
+                    }
+                    gSink = gSink + p3[0].x;
+                });
+            }
+
+            // NURBS 及其 Bezier 分解
+            if (degree <= NURBS::kMaxDegree) {
+                for (int dim = 1; dim <= 3; ++dim) {
+                    const NURBS nurbs = randomNURBS(degree, dim);
+                    R.run("nurbs.evaluateMany", dim, degree, batch, 1, batch, [&] {
+                        nurbs.evaluateMany(u, batch, ders.data());
+                        gSink = gSink + ders[0];
+                    });
+                }
+                const NURBS nurbs = randomNURBS(degree, 3);
+                R.run("nurbs.evaluatePoint3D", 3, degree, batch, 1, batch, [&] {
+                    for (std::size_t i = 0; i < batch; ++i) p3[i] = nurbs.evaluatePoint3D(u[i]);
+                    gSink = gSink + p3[0].x;
+                });
+                std::vector<Vec3d> d3(2 * batch);
+                R.run("nurbs.evaluateDerivativesMany.k1", 3, degree, batch, 1, batch, [&] {
+                    nurbs.evaluateDerivativesMany(u, batch, 1, d3.data());
+                    gSink = gSink + d3[1].x;
+                });
+                const BezierSegments segments(&nurbs, 1);
+                R.run("nurbs.bezierSegments.evaluateMany", 3, degree, batch, 1, batch, [&] {
+                    segments.evaluateMany(0, u, batch, p3.data());
+                    gSink = gSink + p3[0].x;
+                });
+            }
+
+            // 有理 Bezier
+            {
+                const RationalBezierCurve r2(randomPoints2D(degree + 1), randomWeights(degree + 1));
+                const RationalBezierCurve r3(randomPoints3D(degree + 1), randomWeights(degree + 1));
+                R.run("rationalBezier.evaluate", 2, degree, batch, 1, batch, [&] {
+                    for (std::size_t i = 0; i < batch; ++i) p2[i] = r2.evaluate(u[i]);
+                    gSink = gSink + p2[0].x;
+                });
+                R.run("rationalBezier.evaluateMany", 2, degree, batch, 1, batch, [&] {
+                    r2.evaluateMany(u, batch, xs.data(), ys.data());
+                    gSink = gSink + xs[0];
+                });
+                R.run("rationalBezier.evaluateMany", 3, degree, batch, 1, batch, [&] {
+                    r3.evaluateMany(u, batch, xs.data(), ys.data(), zs.data());
+                    gSink = gSink + xs[0];
+                });
+            }
+        }
+    }
+}
+
+// 多曲线 × 多线程：kBatchCurves 条曲线在同一组 batch 个参数上求值
+void benchThreaded(Runner& R, const std::vector<int>& degrees, const std::vector<std::size_t>& batches,
+                   const std::vector<std::size_t>& threadCounts) {
+    constexpr std::size_t kBatchCurves = 256;
+    for (std::size_t threads : threadCounts) {
+        const CurveBatch cb(threads);
+        for (int degree : degrees) {
+            std::vector<BezierCurve> beziers;
+            std::vector<PowerBasisCurve3D> pb3;
+            std::vector<NURBS> nurbs;
+            for (std::size_t c = 0; c < kBatchCurves; ++c) {
+                beziers.emplace_back(randomPoints2D(degree + 1));
+                pb3.emplace_back(randomValues(degree + 1), randomValues(degree + 1), randomValues(degree + 1));
+                if (degree <= NURBS::kMaxDegree) nurbs.push_back(randomNURBS(degree, 3));
+            }
+            for (std::size_t batch : batches) {
+                const std::vector<double> us = params(batch);
+                const std::size_t points = kBatchCurves * batch;
+                {
+                    std::vector<Point2D> out(points);
+                    R.run("curveBatch.bezier", 2, degree, batch, threads, points, [&] {
+                        cb.evaluate(beziers.data(), kBatchCurves, us.data(), batch, out.data());
+                        gSink = gSink + out[0].x;
+                    });
+                }
+                {
+                    std::vector<double> xs(points), ys(points), zs(points);
+                    R.run("curveBatch.powerBasis3D", 3, degree, batch, threads, points, [&] {
+                        cb.evaluate(pb3.data(), kBatchCurves, us.data(), batch, xs.data(), ys.data(), zs.data());
+                        gSink = gSink + xs[0];
+                    });
+                }
+                if (!nurbs.empty()) {
+                    std::vector<double> out(3 * points);
+                    R.run("curveBatch.nurbs", 3, degree, batch, threads, points, [&] {
+                        cb.evaluate(nurbs.data(), kBatchCurves, us.data(), batch, out.data());
+                        gSink = gSink + out[0];
+                    });
+                }
+            }
+        }
+    }
+}
+
+void usage() {
+    std::cerr << "usage: GeoAlgoBench [--quick] [--filter substr] [--min-time sec] [--repetitions n] [--json file|-]\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--quick") {
+            opt.quick = true;
+        } else if (arg == "--filter" && hasValue) {
+            opt.filter = argv[++i];
+        } else if (arg == "--min-time" && hasValue) {
+            opt.minTime = std::atof(argv[++i]);
+        } else if (arg == "--repetitions" && hasValue) {
+            opt.repetitions = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--json" && hasValue) {
+            opt.jsonPath = argv[++i];
+        } else {
+            usage();
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+    if (opt.quick) opt.minTime = std::min(opt.minTime, 0.02);
+
+    const std::vector<int> degrees = opt.quick ? std::vector<int>{3, 7} : std::vector<int>{1, 3, 5, 7, 10, 15};
+    const std::vector<std::size_t> batches =
+        opt.quick ? std::vector<std::size_t>{256} : std::vector<std::size_t>{16, 256, 4096, 65536};
+    const std::vector<std::size_t> threadedBatches =
+        opt.quick ? std::vector<std::size_t>{256} : std::vector<std::size_t>{64, 1024};
+    const std::size_t hw = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::size_t> threadCounts;
+    for (std::size_t t = 1; t < hw; t *= 2) threadCounts.push_back(t);
+    threadCounts.push_back(hw);
+
+    // JSON 写到标准输出时，表格改写到标准错误
+    std::ostream& log = opt.jsonPath == "-" ? std::cerr : std::cout;
+    log << version() << ", SIMD " << simdLevelName(detectSimdLevel()) << ", " << hw << " hardware thread(s)\n"
+              << std::left << std::setw(42) << "benchmark" << std::right << std::setw(4) << "dim" << std::setw(5)
+              << "deg" << std::setw(9) << "batch" << std::setw(5) << "thr" << std::setw(12) << "ns/pt"
+              << std::setw(14) << "Mpts/s" << std::endl;
+
+    Runner R(opt, log);
+    benchSingleThreaded(R, degrees, batches);
+    benchThreaded(R, degrees, threadedBatches, threadCounts);
+
+    if (!opt.jsonPath.empty()) {
+        if (opt.jsonPath == "-") {
+            R.writeJson(std::cout);
+        } else {
+            std::ofstream os(opt.jsonPath);
+            if (!os) {
+                std::cerr << "GeoAlgoBench: cannot open " << opt.jsonPath << "\n";
+                return 1;
+            }
+            R.writeJson(os);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,35 @@
+#include "CurveBatch.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace GeoAlgo;
+
+int main() {
+    // 大量三次 Bezier 曲线在同一组参数上求值，比较不同线程数的耗时
+    const std::size_t numCurves = 20000, count = 100;
+    std::vector<BezierCurve> curves;
+    curves.reserve(numCurves);
+    for (std::size_t c = 0; c < numCurves; ++c) {
+        double s = 1e-4 * c;
+        curves.emplace_back(std::vector<Point2D>{{0, s}, {1, 2 + s}, {3, 3 - s}, {4, s}});
+    }
+    std::vector<double> us(count);
+    for (std::size_t k = 0; k < count; ++k) us[k] = static_cast<double>(k) / (count - 1);
+    std::vector<Point2D> out(numCurves * count);
+
+    const std::size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        CurveBatch batch(threads);
+        auto t0 = std::chrono::steady_clock::now();
+        batch.evaluate(curves.data(), numCurves, us.data(), count, out.data());
+        auto t1 = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        std::cout << threads << " thread(s): " << ms << " ms, "
+                  << (numCurves * count) / (ms * 1e3) << " Mpts/s" << std::endl;
+    }
+    std::cout << "curve[0](0.5) = " << out[count / 2] << std::endl;
+    return 0;
+}
@@ -1,5 +1,6 @@
 #include "GeoAlgo.h"
 #include "NURBS.h"
+#include <cmath>
 #include <iostream>
 
 int main() {
@@ -12,5 +13,13 @@ int main() {
         std::cout << "u=" << u << " -> value=" << curve.evaluate(u) << std::endl;
     }
 
+    // 有理二次曲线表示四分之一圆弧
+    const double w = std::sqrt(0.5);
+    GeoAlgo::NURBS arc(2, {{1, 0}, {1, 1}, {0, 1}}, {0, 0, 0, 1, 1, 1}, {1, w, 1});
+    for (double u = 0; u <= 1.0; u += 0.25) {
+        GeoAlgo::Point2D p = arc.evaluatePoint(u);
+        std::cout << "arc(" << u << ") = " << p << "  |p| = " << std::hypot(p.x, p.y) << std::endl;
+    }
+
     return 0;
 }
@@ -1,5 +1,6 @@
 #include <pybind11/embed.h>
 #include <pybind11/stl.h>   // ⚠️ 必须
+#include "AdaptiveTessellator.h"
 #include "BezierCurve.h"
 #include "Point2D.h"
 #include <vector>
@@ -15,11 +16,13 @@ int main() {
     std::vector<Point2D> controlPoints = {{0,0}, {1,2}, {3,3}, {4,0}};
     BezierCurve bezier(controlPoints);
 
+    // 自适应离散：平坦处少取点，弯曲处多取点
+    AdaptiveTessellator tess(1e-3);
+    std::vector<Point2D> pts(tess.tessellate(bezier, nullptr, 0));
+    tess.tessellate(bezier, pts.data(), pts.size());
+
     std::vector<double> xs, ys;
-    int nSamples = 20;
-    for(int i=0; i<=nSamples; ++i){
-        double u = static_cast<double>(i)/nSamples;
-        Point2D p = bezier.evaluate(u);
+    for (const auto& p : pts) {
         xs.push_back(p.x);
         ys.push_back(p.y);
     }
@@ -15,17 +15,17 @@ int main() {
     PowerBasisCurve2D curve2({1.0, 1.0, 1.0}, {2.0, -1.0});
     curve2.print();
     auto p = curve2.evaluate(t);
-    std::cout << "curve2(" << t << ") = (" << p.first << "," << p.second << ")\n";
+    std::cout << "curve2(" << t << ") = " << p << "\n";
     auto dp = curve2.derivative(t);
-    std::cout << "curve2'(" << t << ") = (" << dp.first << "," << dp.second << ")\n";
+    std::cout << "curve2'(" << t << ") = " << dp << "\n";
 
     // 3D 示例: x(t)=t, y(t)=t^2, z(t)=1
     PowerBasisCurve3D curve3({0.0, 1.0}, {0.0, 0.0, 1.0}, {1.0});
     curve3.print();
     auto q = curve3.evaluate(t);
-    std::cout << "curve3(" << t << ") = (" << std::get<0>(q) << "," << std::get<1>(q) << "," << std::get<2>(q) << ")\n";
+    std::cout << "curve3(" << t << ") = " << q << "\n";
     auto dq = curve3.derivative(t);
-    std::cout << "curve3'(" << t << ") = (" << std::get<0>(dq) << "," << std::get<1>(dq) << "," << std::get<2>(dq) << ")\n";
+    std::cout << "curve3'(" << t << ") = " << dq << "\n";
 
     return 0;
 }
@@ -2,6 +2,7 @@
 #include <vector>
 #include <cmath>
 #include <iomanip>
+#include "RationalBezierCurve.h"
 #include <pybind11/embed.h>
 #include <pybind11/stl.h>
 
@@ -9,67 +10,33 @@ namespace py = pybind11;
 using namespace std;
 
 /**
- * @brief 计算组合数 C(n, k)
+ * @brief 由控制点坐标与权重构造有理 Bézier 曲线（支持二维/三维）
  */
-double combination(int n, int k)
+GeoAlgo::RationalBezierCurve make_curve(const vector<vector<double>>& control, const vector<double>& weights)
 {
-    if (k < 0 || k > n) return 0.0;
-    if (k == 0 || k == n) return 1.0;
-    double c = 1.0;
-    for (int i = 1; i <= k; ++i)
-        c = c * (n - i + 1) / i;
-    return c;
-}
-
-/**
- * @brief 计算单个 Bernstein 基函数 B_{i,n}(u)
- */
-double bernstein(int i, int n, double u)
-{
-    if (i < 0 || i > n) return 0.0;
-    double coeff = combination(n, i);
-    return coeff * pow(u, i) * pow(1 - u, n - i);
-}
-
-/**
- * @brief 计算所有 Bernstein 基函数
- */
-vector<double> bernstein_all(int n, double u)
-{
-    vector<double> B(n + 1);
-    for (int i = 0; i <= n; ++i)
-        B[i] = bernstein(i, n, u);
-    return B;
+    if (control[0].size() == 2)
+    {
+        vector<GeoAlgo::Point2D> pts;
+        for (auto& p : control) pts.emplace_back(p[0], p[1]);
+        return GeoAlgo::RationalBezierCurve(pts, weights);
+    }
+    vector<GeoAlgo::Vec3d> pts;
+    for (auto& p : control) pts.emplace_back(p[0], p[1], p[2]);
+    return GeoAlgo::RationalBezierCurve(pts, weights);
 }
 
 /**
- * @brief 计算有理 Bézier 曲线上的点（支持二维/三维）
- * @param control 控制点坐标
- * @param weights 权重
- * @param u 参数值 [0,1]
- * @return 曲线点坐标
+ * @brief 在 [0,1] 上均匀采样 N+1 个点，批量求值
  */
-vector<double> rational_bezier_point(const vector<vector<double>>& control, const vector<double>& weights, double u)
+void sample_curve(const GeoAlgo::RationalBezierCurve& curve, int N, vector<double>& xu, vector<double>& yu, vector<double>& zu)
 {
-    int n = control.size() - 1;
-    int dim = control[0].size(); // 2 或 3
-    vector<double> B = bernstein_all(n, u);
-
-    vector<double> num(dim, 0.0);
-    double denom = 0.0;
-
-    for (int i = 0; i <= n; ++i)
-    {
-        double wB = weights[i] * B[i];
-        for (int d = 0; d < dim; ++d)
-            num[d] += wB * control[i][d];
-        denom += wB;
-    }
-
-    for (int d = 0; d < dim; ++d)
-        num[d] /= denom;
-
-    return num;
+    vector<double> us(N + 1);
+    for (int k = 0; k <= N; ++k)
+        us[k] = static_cast<double>(k) / N;
+    xu.resize(N + 1);
+    yu.resize(N + 1);
+    zu.resize(N + 1);
+    curve.evaluateMany(us.data(), us.size(), xu.data(), yu.data(), zu.data());
 }
 
 /**
@@ -77,16 +44,8 @@ vector<double> rational_bezier_point(const vector<vector<double>>& control, cons
  */
 void plot_rational_bezier_2d(py::module_& plt, const vector<vector<double>>& control, const vector<double>& weights)
 {
-    int N = 100;
-    vector<double> xu, yu;
-
-    for (int k = 0; k <= N; ++k)
-    {
-        double u = static_cast<double>(k) / N;
-        vector<double> pt = rational_bezier_point(control, weights, u);
-        xu.push_back(pt[0]);
-        yu.push_back(pt[1]);
-    }
+    vector<double> xu, yu, zu;
+    sample_curve(make_curve(control, weights), 100, xu, yu, zu);
 
     vector<double> xc, yc;
     for (auto& p : control)
@@ -125,16 +84,8 @@ void plot_rational_bezier_3d(py::module_& plt, const vector<vector<double>>& con
     py::object fig = plt.attr("figure")();
     py::object ax = fig.attr("add_subplot")(111, py::arg("projection")="3d");
 
-    int N = 100;
     vector<double> xu, yu, zu;
-    for (int k = 0; k <= N; ++k)
-    {
-        double u = static_cast<double>(k) / N;
-        vector<double> pt = rational_bezier_point(control, weights, u);
-        xu.push_back(pt[0]);
-        yu.push_back(pt[1]);
-        zu.push_back(pt[2]);
-    }
+    sample_curve(make_curve(control, weights), 100, xu, yu, zu);
 
     vector<double> xc, yc, zc;
     for (auto& p : control)
@@ -203,10 +154,10 @@ int main()
     }
 
     double u = 0.5;
-    vector<double> pt = rational_bezier_point(control, weights, u);
+    GeoAlgo::Vec3d pt = make_curve(control, weights).evaluate3D(u);
 
     cout << "\n在 u = 0.5 时的有理 Bézier 曲线点坐标: ";
-    for (double val : pt) cout << val << " ";
+    for (int d = 0; d < dim; ++d) cout << pt[d] << " ";
     cout << endl;
 
     py::scoped_interpreter guard{};
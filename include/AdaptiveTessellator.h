@@ -0,0 +1,84 @@
+#ifndef GEOALGO_ADAPTIVE_TESSELLATOR_H
+#define GEOALGO_ADAPTIVE_TESSELLATOR_H
+
+#include "BezierCurve.h"
+#include "NURBS.h"
+#include "PowerBasisCurve.h"
+#include "PowerBasisCurve2D.h"
+#include "PowerBasisCurve3D.h"
+#include "Vec.h"
+#include <cstddef>
+
+namespace GeoAlgo {
+
+/**
+ * 自适应曲线离散（Adaptive Tessellation）
+ * 在 Bezier 控制多边形上递归二分：当所有内部控制点到首末点弦线段的距离不超过容差时，
+ * 由凸包性质该段曲线到弦的距离也不超过容差，直接输出弦；否则在中点用 de Casteljau 细分。
+ * - 有理曲线在齐次坐标中细分，正权重下投影后的控制多边形同样满足凸包性质
+ * - 幂基曲线先在 [t0, t1] 上换成 Bezier 形式
+ * - 细分使用定长显式栈（深度优先、先左后右），不递归、不分配内存
+ *
+ * tessellate 返回折线所需的点数；只写入前 min(返回值, capacity) 个点，
+ * 可先以 capacity = 0 查询所需大小。params 非空时同时写出每个点的曲线参数。
+ * tessellateBounded 则以 capacity 为点数上限，见下文。
+ */
+class AdaptiveTessellator {
+public:
+    static constexpr int kMaxDegree = 15;
+    static constexpr int kMaxDepth = 30;
+
+    explicit AdaptiveTessellator(double tolerance = 1e-3, int maxDepth = 20);
+
+    double tolerance() const { return tolerance_; }
+    int maxDepth() const { return maxDepth_; }
+
+    std::size_t tessellate(const BezierCurve& curve,
+                           Point2D* out, std::size_t capacity, double* params = nullptr) const;
+
+    std::size_t tessellate(const PowerBasisCurve& curve, double t0, double t1,
+                           Point2D* out, std::size_t capacity, double* params = nullptr) const;
+
+    std::size_t tessellate(const PowerBasisCurve2D& curve, double t0, double t1,
+                           Point2D* out, std::size_t capacity, double* params = nullptr) const;
+
+    std::size_t tessellate(const PowerBasisCurve3D& curve, double t0, double t1,
+                           Vec3d* out, std::size_t capacity, double* params = nullptr) const;
+
+    /**
+     * 有理 Bezier 曲线：Pw 为 degree+1 个齐次控制点 (w*x, w*y, w*z, w)，参数域 [0,1]
+     * N = 2 或 3 决定输出点的维数
+     */
+    template <int N>
+    std::size_t tessellateHomogeneous(const Vec4d* Pw, int degree,
+                                      Vec<double, N>* out, std::size_t capacity,
+                                      double* params = nullptr) const;
+
+    /**
+     * 有界离散：至多输出 capacity 个点（capacity >= 2），返回写入的点数
+     * 所需点数一旦超过 capacity 即停止细分，改为在整个参数域上取 capacity 个等距参数点，
+     * 此时 truncated 非空则置为 true（否则置为 false）。
+     * NURBS 先分解为 Bezier 段，相邻段共用端点，参数为原曲线参数；2 维曲线的 z 分量为 0。
+     */
+    std::size_t tessellateBounded(const NURBS& curve, Vec3d* out, std::size_t capacity,
+                                  double* params = nullptr, bool* truncated = nullptr) const;
+
+    /**
+     * 分段有理 Bezier 曲线：Pw 为 numSegments*(degree+1) 个齐次控制点，按段连续，
+     * 第 s 段的参数区间为 [breaks[s], breaks[s+1]]；语义同上
+     */
+    std::size_t tessellateBounded(const Vec4d* Pw, int degree, const double* breaks, int numSegments,
+                                  Vec3d* out, std::size_t capacity,
+                                  double* params = nullptr, bool* truncated = nullptr) const;
+
+private:
+    // 幂基系数（低次到高次）在 [t0, t1] 上换成齐次 Bezier 控制点
+    static void powerToBezier(const Vec3d* coeffs, int degree, double t0, double t1, Vec4d* Pw);
+
+    double tolerance_;
+    int maxDepth_;
+};
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_ADAPTIVE_TESSELLATOR_H
@@ -0,0 +1,191 @@
+#ifndef GEOALGO_ARC_LENGTH_TABLE_H
+#define GEOALGO_ARC_LENGTH_TABLE_H
+
+#include "BezierCurve.h"
+#include "NURBS.h"
+#include "PowerBasisCurve2D.h"
+#include "PowerBasisCurve3D.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace GeoAlgo {
+
+namespace detail {
+
+// 8 点 Gauss–Legendre 求积（[-1,1] 上的节点与权重）
+inline constexpr double kGaussNodes[8] = {
+    -0.9602898564975363, -0.7966664774136267, -0.5255324099163290, -0.1834346424956498,
+    0.1834346424956498,  0.5255324099163290,  0.7966664774136267,  0.9602898564975363};
+inline constexpr double kGaussWeights[8] = {
+    0.1012285362903763, 0.2223810344533745, 0.3137066458778873, 0.3626837833783620,
+    0.3626837833783620, 0.3137066458778873, 0.2223810344533745, 0.1012285362903763};
+
+// 各曲线类型的速度 |C'(t)| 与曲线点
+inline double arcSpeed(const BezierCurve& c, double t) { return c.derivative(t).norm(); }
+inline Point2D arcPoint(const BezierCurve& c, double t) { return c.evaluate(t); }
+
+inline double arcSpeed(const PowerBasisCurve2D& c, double t) { return c.derivative(t).norm(); }
+inline Vec2d arcPoint(const PowerBasisCurve2D& c, double t) { return c.evaluate(t); }
+
+inline double arcSpeed(const PowerBasisCurve3D& c, double t) {
+    Vec3d d[2];
+    c.evaluateDerivatives(t, 1, d);
+    return d[1].norm();
+}
+inline Vec3d arcPoint(const PowerBasisCurve3D& c, double t) { return c.evaluate(t); }
+
+inline double arcSpeed(const NURBS& c, double t) {
+    Vec3d d[2];
+    c.evaluateDerivatives(t, 1, d);
+    return d[1].norm();
+}
+inline Vec3d arcPoint(const NURBS& c, double t) { return c.evaluatePoint3D(t); }
+
+} // namespace detail
+
+/**
+ * 弧长参数化查找表（Arc-Length Table）
+ *
+ * - 构造时把参数域切成若干区间（NURBS 以节点为天然断点），每个区间用 8 点 Gauss–Legendre
+ *   积分 |C'(t)|，与两个半区间之和比较，误差超过容差则继续对半细分；
+ *   保存断点 t_k 与累计弧长 s_k
+ * - s → t：按弧长均匀分桶的索引表定位区间（期望 O(1)），区间内以线性插值为初值，
+ *   Newton 迭代 t ← t - (S(t) - s) / |C'(t)|，越出区间时退回二分
+ * - 表只保存数值，不持有曲线：与曲线放在一起缓存，查询时传入构造它的同一条曲线；
+ *   曲线修改后需重建
+ */
+class ArcLengthTable {
+public:
+    static constexpr double kDefaultTolerance = 1e-10; // 相对总弧长
+
+    ArcLengthTable() = default;
+    explicit ArcLengthTable(const BezierCurve& curve, double tolerance = kDefaultTolerance);
+    ArcLengthTable(const PowerBasisCurve2D& curve, double t0, double t1, double tolerance = kDefaultTolerance);
+    ArcLengthTable(const PowerBasisCurve3D& curve, double t0, double t1, double tolerance = kDefaultTolerance);
+    explicit ArcLengthTable(const NURBS& curve, double tolerance = kDefaultTolerance);
+
+    double length() const { return s_.empty() ? 0.0 : s_.back(); }
+    double firstParam() const { return t_.empty() ? 0.0 : t_.front(); }
+    double lastParam() const { return t_.empty() ? 0.0 : t_.back(); }
+    std::size_t intervals() const { return t_.empty() ? 0 : t_.size() - 1; }
+
+    // 断点 t_k 与对应的累计弧长 s_k
+    const std::vector<double>& params() const { return t_; }
+    const std::vector<double>& lengths() const { return s_; }
+
+    // 从起点到参数 t 的弧长
+    template <typename Curve>
+    double lengthAt(const Curve& curve, double t) const;
+
+    // 弧长 s（截断到 [0, length()]）对应的参数
+    template <typename Curve>
+    double param(const Curve& curve, double s) const;
+
+    // n 个按弧长等距的参数（含两端），单调推进区间，总代价 O(n + 区间数)
+    template <typename Curve>
+    void equallySpacedParams(const Curve& curve, std::size_t n, double* params) const;
+
+    // n 个按弧长等距的点；params 非空时同时写出参数
+    template <typename Curve, typename Point>
+    void equallySpaced(const Curve& curve, std::size_t n, Point* points, double* params = nullptr) const;
+
+private:
+    static constexpr int kMaxNewtonIterations = 20;
+
+    void build(const std::function<double(double)>& speed, const std::vector<double>& breaks, double tolerance);
+    std::size_t locate(double s) const;
+
+    template <typename Curve>
+    static double integrate(const Curve& curve, double a, double b);
+    template <typename Curve>
+    double solve(const Curve& curve, std::size_t k, double s) const;
+    template <typename Curve, typename Fn>
+    void forEachEquallySpaced(const Curve& curve, std::size_t n, Fn&& fn) const;
+
+    std::vector<double> t_;
+    std::vector<double> s_;
+    std::vector<std::uint32_t> bucket_; // 弧长均匀分桶 → 桶起点所在区间
+    double tol_ = 0.0;                  // 绝对弧长容差
+};
+
+template <typename Curve>
+double ArcLengthTable::integrate(const Curve& curve, double a, double b) {
+    const double h = 0.5 * (b - a);
+    const double m = 0.5 * (a + b);
+    double sum = 0.0;
+    for (int i = 0; i < 8; ++i) sum += detail::kGaussWeights[i] * detail::arcSpeed(curve, m + h * detail::kGaussNodes[i]);
+    return sum * h;
+}
+
+template <typename Curve>
+double ArcLengthTable::solve(const Curve& curve, std::size_t k, double s) const {
+    const double a = t_[k], b = t_[k + 1];
+    const double sa = s_[k], sb = s_[k + 1];
+    if (!(sb > sa)) return a;
+    double lo = a, hi = b;
+    double t = a + (b - a) * std::clamp((s - sa) / (sb - sa), 0.0, 1.0);
+    for (int it = 0; it < kMaxNewtonIterations; ++it) {
+        const double f = sa + integrate(curve, a, t) - s;
+        if (std::fabs(f) <= tol_) break;
+        if (f > 0.0) hi = t;
+        else lo = t;
+        const double speed = detail::arcSpeed(curve, t);
+        double next = speed > 0.0 ? t - f / speed : lo;
+        if (!(next > lo && next < hi)) next = 0.5 * (lo + hi);
+        t = next;
+    }
+    return t;
+}
+
+template <typename Curve>
+double ArcLengthTable::lengthAt(const Curve& curve, double t) const {
+    if (t_.size() < 2) return 0.0;
+    t = std::clamp(t, t_.front(), t_.back());
+    const std::size_t k = std::min<std::size_t>(
+        std::upper_bound(t_.begin(), t_.end(), t) - t_.begin() - 1, t_.size() - 2);
+    return s_[k] + integrate(curve, t_[k], t);
+}
+
+template <typename Curve>
+double ArcLengthTable::param(const Curve& curve, double s) const {
+    if (t_.size() < 2) return firstParam();
+    s = std::clamp(s, 0.0, length());
+    return solve(curve, locate(s), s);
+}
+
+template <typename Curve, typename Fn>
+void ArcLengthTable::forEachEquallySpaced(const Curve& curve, std::size_t n, Fn&& fn) const {
+    if (t_.size() < 2) {
+        for (std::size_t i = 0; i < n; ++i) fn(i, firstParam());
+        return;
+    }
+    const std::size_t last = t_.size() - 2;
+    const double L = length();
+    std::size_t k = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double s = n == 1 ? 0.0 : (i + 1 == n ? L : L * static_cast<double>(i) / (n - 1));
+        while (k < last && s_[k + 1] < s) ++k;
+        fn(i, solve(curve, k, s));
+    }
+}
+
+template <typename Curve>
+void ArcLengthTable::equallySpacedParams(const Curve& curve, std::size_t n, double* params) const {
+    forEachEquallySpaced(curve, n, [&](std::size_t i, double t) { params[i] = t; });
+}
+
+template <typename Curve, typename Point>
+void ArcLengthTable::equallySpaced(const Curve& curve, std::size_t n, Point* points, double* params) const {
+    forEachEquallySpaced(curve, n, [&](std::size_t i, double t) {
+        points[i] = detail::arcPoint(curve, t);
+        if (params) params[i] = t;
+    });
+}
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_ARC_LENGTH_TABLE_H
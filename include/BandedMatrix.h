@@ -0,0 +1,58 @@
+#ifndef GEOALGO_BANDED_MATRIX_H
+#define GEOALGO_BANDED_MATRIX_H
+
+#include <cstddef>
+#include <vector>
+
+namespace GeoAlgo {
+
+/**
+ * n×n 带状矩阵：下带宽 lower、上带宽 upper，只存放带内 n*(lower+upper+1) 个元素
+ * 按行连续存放，第 i 行的 (i, j) 在 i*(lower+upper+1) + (j - i + lower)
+ *
+ * - factorLU：不选主元的原地 LU 分解，O(n·lower·upper)。适用于不需要选主元的矩阵，
+ *   如 B 样条配置矩阵（全正矩阵，de Boor）与对角占优的三对角矩阵
+ * - factorCholesky：对称正定矩阵的原地 Cholesky 分解 A = L Lᵀ，只读取下三角（j <= i），O(n·lower²)；
+ *   对称矩阵只需存放下带，upper 可取 0
+ * - solve：用分解结果解 A X = B，B 为 n 行 nrhs 列、按行连续（与控制点按点连续的布局一致），
+ *   可一次求解多个坐标分量
+ * 分解过程中遇到零主元（或非正主元）时抛出 runtime_error；不分配临时的稠密矩阵
+ */
+class BandedMatrix {
+public:
+    BandedMatrix() = default;
+    BandedMatrix(int n, int lower, int upper);
+
+    int size() const { return n_; }
+    int lower() const { return lower_; }
+    int upper() const { return upper_; }
+
+    // (i, j) 须在带内：-lower <= j - i <= upper
+    double& operator()(int i, int j) { return a_[index(i, j)]; }
+    double operator()(int i, int j) const { return a_[index(i, j)]; }
+    bool inBand(int i, int j) const { return j - i >= -lower_ && j - i <= upper_; }
+
+    void setZero();
+
+    void factorLU();
+    void factorCholesky();
+
+    void solve(double* B, int nrhs) const;
+
+private:
+    enum class Factor { None, LU, Cholesky };
+
+    std::size_t index(int i, int j) const {
+        return static_cast<std::size_t>(i) * (lower_ + upper_ + 1) + (j - i + lower_);
+    }
+
+    int n_ = 0;
+    int lower_ = 0;
+    int upper_ = 0;
+    Factor factor_ = Factor::None;
+    std::vector<double> a_;
+};
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_BANDED_MATRIX_H
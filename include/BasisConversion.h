@@ -0,0 +1,58 @@
+#ifndef GEOALGO_BASIS_CONVERSION_H
+#define GEOALGO_BASIS_CONVERSION_H
+
+#include "BezierCurve.h"
+#include "PowerBasisCurve.h"
+#include "PowerBasisCurve1D.h"
+#include "PowerBasisCurve2D.h"
+#include "ThreadPool.h"
+#include <cstddef>
+#include <vector>
+
+namespace GeoAlgo {
+
+/**
+ * Bezier（Bernstein 基）与幂基之间的基变换，参数域均为 [0,1]
+ *
+ *   幂基系数   a_i = Σ_{j<=i} (-1)^(i-j) C(n,i) C(i,j) b_j
+ *   Bezier 点  b_j = Σ_{i<=j} C(j,i) / C(n,i) a_i
+ *
+ * 两个 (n+1)×(n+1) 下三角矩阵按次数预计算（n <= kMaxConversionDegree），首次调用时一次建好，
+ * 之后只读，可多线程共享；每条曲线的转换即一次矩阵–向量乘。
+ *
+ * 数值稳定性：Bernstein 基在 [0,1] 上的条件数最优，幂基的条件数随次数指数增长，
+ * 矩阵元素 C(n,i)C(i,j) 最大约 3^n。控制点在 [-1,1] 内随机取值时，转换后用 Horner 求值
+ * 与 Bernstein 递推的最大偏差实测约为：5 次 1e-14、10 次 3e-12、15 次 5e-10、
+ * 20 次 1e-7、24 次 2e-5（随控制点量级线性放大）。
+ * 10 次以内可放心使用幂基做批量求值；更高次数应保留 Bernstein 形式。
+ */
+constexpr int kMaxConversionDegree = 24;
+
+// 行主序下三角矩阵，M[i*(n+1) + j]
+const double* bezierToPowerMatrix(int degree);
+const double* powerToBezierMatrix(int degree);
+
+// 原始系数：degree+1 个 dim 维点按点连续存放，in 与 out 不可重叠
+void bezierToPower(const double* bezier, int degree, int dim, double* power);
+void powerToBezier(const double* power, int degree, int dim, double* bezier);
+
+PowerBasisCurve toPowerBasis(const BezierCurve& curve);
+PowerBasisCurve2D toPowerBasis2D(const BezierCurve& curve);
+BezierCurve toBezier(const PowerBasisCurve& curve);
+BezierCurve toBezier(const PowerBasisCurve2D& curve);
+
+// 一维：Bezier 控制值 ↔ 幂基多项式
+PowerBasisCurve1D toPowerBasis1D(const std::vector<double>& bezierValues);
+std::vector<double> toBezierValues(const PowerBasisCurve1D& curve);
+
+// 批量转换：out[i] 对应 curves[i]，按块在线程池上并行
+void toPowerBasis(const BezierCurve* curves, std::size_t count, PowerBasisCurve* out,
+                  ThreadPool& pool = ThreadPool::shared());
+void toPowerBasis2D(const BezierCurve* curves, std::size_t count, PowerBasisCurve2D* out,
+                    ThreadPool& pool = ThreadPool::shared());
+void toBezier(const PowerBasisCurve* curves, std::size_t count, BezierCurve* out,
+              ThreadPool& pool = ThreadPool::shared());
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_BASIS_CONVERSION_H
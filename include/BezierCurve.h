@@ -2,6 +2,7 @@
 #define GEOALGO_BEZIER_CURVE_H
 
 #include "Point2D.h"
+#include <cstddef>
 #include <vector>
 
 namespace GeoAlgo {
@@ -10,17 +11,60 @@ namespace GeoAlgo {
  * 贝塞尔曲线（Bezier Curve）
  * 定义：P(u) = Σ B_i^n(u) * P_i
  * 其中 B_i^n(u) = C(n,i) * (1-u)^(n-i) * u^i
+ *
+ * 构造时预计算 C(n,i) * P_i，求值采用 Bernstein 形式的 Horner 递推：
+ *   Q = C(n,0)P_0;  Q = Q*(1-u) + C(n,i) u^i P_i  (i = 1..n)
+ * 每个参数 O(n) 次乘加，无 pow 调用、无内存分配。
+ *
+ * 各阶导数曲线（hodograph）P^(j)(u) 是 n-j 次 Bezier 曲线，控制点为
+ *   n!/(n-j)! * Δ^j P_i，构造时一并缓存（同样乘好组合数），导数求值沿用同一递推。
  */
 class BezierCurve {
 public:
     BezierCurve() = default;
-    explicit BezierCurve(const std::vector<Point2D>& controlPoints)
-        : ctrlPoints(controlPoints) {}
+    explicit BezierCurve(const std::vector<Point2D>& controlPoints);
+
+    // 次数 n = 控制点数 - 1，空曲线返回 -1
+    int degree() const { return static_cast<int>(ctrlPoints.size()) - 1; }
+
+    const std::vector<Point2D>& controlPoints() const { return ctrlPoints; }
 
     Point2D evaluate(double u) const;
 
+    // 批量求值：结果写入调用者提供的 out[0..count)，不分配内存
+    void evaluateMany(const double* us, std::size_t count, Point2D* out) const;
+
+    // order 阶导数，order > n 时为零向量
+    Point2D derivative(double u, int order = 1) const;
+
+    // out[j] = P^(j)(u)，j = 0..k
+    void evaluateDerivatives(double u, int k, Point2D* out) const;
+
+    // 批量：out[i*(k+1) + j] = P^(j)(us[i])
+    void evaluateDerivativesMany(const double* us, std::size_t count, int k, Point2D* out) const;
+
+    // 一阶导数曲线（n-1 次，控制点 n*(P_{i+1} - P_i)）
+    BezierCurve hodograph() const;
+
+    /**
+     * 可选的幂基缓存：缓存后批量求值改用 SIMD Horner 内核（PowerBasisKernel.h），
+     * 结果与 Bernstein 递推只差舍入误差；次数上限与数值稳定性见 BasisConversion.h
+     */
+    void cachePowerBasis();
+    void clearPowerBasisCache() { powerPacked.clear(); }
+    bool hasPowerBasisCache() const { return !powerPacked.empty(); }
+
+    // SoA 批量求值：xs[k], ys[k] 为 us[k] 处的点
+    void evaluateMany(const double* us, std::size_t count, double* xs, double* ys) const;
+
 private:
+    // j 阶导数网在 scaledHodographs 中的起始位置（j >= 1）
+    std::size_t hodographOffset(int j) const;
+
     std::vector<Point2D> ctrlPoints;
+    std::vector<Point2D> scaledPoints;     // C(n,i) * P_i
+    std::vector<Point2D> scaledHodographs; // 依次为 j = 1..n 阶：C(n-j,i) * n!/(n-j)! * Δ^j P_i
+    std::vector<double> powerPacked;       // 幂基系数按分量连续存放：x 的 n+1 个，随后 y 的 n+1 个
     static double binomial(int n, int i);
 };
 
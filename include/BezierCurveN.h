@@ -0,0 +1,94 @@
+#ifndef GEOALGO_BEZIER_CURVE_N_H
+#define GEOALGO_BEZIER_CURVE_N_H
+
+#include "BezierCurve.h"
+#include "FixedMath.h"
+#include "Vec.h"
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace GeoAlgo {
+
+/**
+ * 定次数、定维数的贝塞尔曲线 BezierCurveN<Degree, Dim>
+ * - 控制点存放在 std::array 中，无堆分配
+ * - 组合数取自编译期表，C(n,i)*P_i 在构造时计算
+ * - Horner 递推按次数与维数完全展开，可在常量表达式中求值
+ * - 点类型为 Vec<double, Dim>；Dim == 2 时即 Point2D，可与动态 BezierCurve 互相转换
+ */
+template <int Degree, int Dim = 2>
+class BezierCurveN {
+    static_assert(Degree >= 0, "BezierCurveN: Degree must be non-negative");
+    static_assert(Dim >= 1, "BezierCurveN: Dim must be positive");
+
+public:
+    using Point = Vec<double, Dim>;
+    using ControlPoints = std::array<Point, Degree + 1>;
+
+    static constexpr int kDegree = Degree;
+    static constexpr int kDim = Dim;
+
+    constexpr BezierCurveN() : ctrl_{}, scaled_{} {}
+
+    constexpr explicit BezierCurveN(const ControlPoints& controlPoints)
+        : ctrl_(controlPoints), scaled_(scale(controlPoints, std::make_index_sequence<Degree + 1>{})) {}
+
+    // 由动态曲线构造，次数不符时抛出 std::invalid_argument
+    explicit BezierCurveN(const BezierCurve& curve) : BezierCurveN(fromDynamic(curve)) {}
+
+    constexpr int degree() const { return Degree; }
+    constexpr const ControlPoints& controlPoints() const { return ctrl_; }
+
+    constexpr Point evaluate(double u) const {
+        return horner(u, std::make_index_sequence<Degree>{});
+    }
+
+    void evaluateMany(const double* us, std::size_t count, Point* out) const {
+        for (std::size_t k = 0; k < count; ++k) out[k] = evaluate(us[k]);
+    }
+
+    // 转为动态 BezierCurve（仅二维）
+    BezierCurve toDynamic() const {
+        static_assert(Dim == 2, "BezierCurveN::toDynamic requires Dim == 2");
+        return BezierCurve(std::vector<Point2D>(ctrl_.begin(), ctrl_.end()));
+    }
+
+private:
+    template <std::size_t... I>
+    static constexpr ControlPoints scale(const ControlPoints& P, std::index_sequence<I...>) {
+        return {{P[I] * detail::kBinomialRow<Degree>[I]...}};
+    }
+
+    // Q = C(n,0)P_0;  Q = Q*(1-u) + C(n,i) u^i P_i
+    template <std::size_t... I>
+    constexpr Point horner(double u, std::index_sequence<I...>) const {
+        const double s = 1.0 - u;
+        double ui = 1.0;
+        Point r = scaled_[0];
+        ((ui *= u, r = r * s + scaled_[I + 1] * ui), ...);
+        return r;
+    }
+
+    static ControlPoints fromDynamic(const BezierCurve& curve) {
+        static_assert(Dim == 2, "BezierCurveN: conversion from BezierCurve requires Dim == 2");
+        if (curve.degree() != Degree)
+            throw std::invalid_argument("BezierCurveN: degree mismatch");
+        ControlPoints P{};
+        for (int i = 0; i <= Degree; ++i) P[i] = curve.controlPoints()[i];
+        return P;
+    }
+
+    ControlPoints ctrl_;
+    ControlPoints scaled_; // C(n,i) * P_i
+};
+
+using QuadraticBezier2D = BezierCurveN<2, 2>;
+using CubicBezier2D = BezierCurveN<3, 2>;
+using QuadraticBezier3D = BezierCurveN<2, 3>;
+using CubicBezier3D = BezierCurveN<3, 3>;
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_BEZIER_CURVE_N_H
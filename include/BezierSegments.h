@@ -0,0 +1,69 @@
+#ifndef GEOALGO_BEZIER_SEGMENTS_H
+#define GEOALGO_BEZIER_SEGMENTS_H
+
+#include "BezierCurve.h"
+#include "NURBS.h"
+#include "RationalBezierCurve.h"
+#include "ThreadPool.h"
+#include <cstddef>
+#include <vector>
+
+namespace GeoAlgo {
+
+/**
+ * NURBS 曲线集合的 Bezier 分解（NURBS::decomposeToBezier）
+ *
+ * - 所有段的齐次控制点 (w*x, w*y, w*z, w) 连续存放在一块数组中，第 c 条曲线的段为
+ *   [curveBegin(c), curveEnd(c))，breaks(c) 为该曲线的 numSegments(c)+1 个段端点参数
+ * - 构造时先串行统计各曲线段数得到偏移，再按曲线分块在线程池上并行分解，
+ *   各块只写自己的区间，结果与线程数无关
+ * - 段上求值为有理 Bernstein–Horner 递推 O(p)，免去节点区间查找与 Cox–de Boor 的 O(p^2)
+ */
+class BezierSegments {
+public:
+    BezierSegments() : segmentOffset_(1, 0), curveOffset_(1, 0) {}
+    BezierSegments(const NURBS* curves, std::size_t count, ThreadPool& pool = ThreadPool::shared());
+
+    std::size_t numCurves() const { return curveOffset_.size() - 1; }
+    std::size_t numSegments() const { return curveOffset_.back(); }
+    std::size_t numSegments(std::size_t curve) const { return curveEnd(curve) - curveBegin(curve); }
+    std::size_t curveBegin(std::size_t curve) const { return curveOffset_[curve]; }
+    std::size_t curveEnd(std::size_t curve) const { return curveOffset_[curve + 1]; }
+
+    int degree(std::size_t segment) const {
+        return static_cast<int>(segmentOffset_[segment + 1] - segmentOffset_[segment]) - 1;
+    }
+    // 原曲线的维数（1..3）
+    int dimension(std::size_t curve) const { return dims_[curve]; }
+    const Vec4d* controlPoints(std::size_t segment) const { return points_.data() + segmentOffset_[segment]; }
+    const double* breaks(std::size_t curve) const { return breaks_.data() + curveOffset_[curve] + curve; }
+
+    // 段在局部参数 t ∈ [0,1] 处的齐次点
+    Vec4d evaluateHomogeneous(std::size_t segment, double t) const;
+
+    // 第 curve 条曲线在原参数 u（截断到定义域）处的点，与 NURBS::evaluatePoint3D 一致
+    Vec3d evaluate(std::size_t curve, double u) const;
+
+    // 批量：参数非降序时逐段推进，乱序时退回二分查找
+    void evaluateMany(std::size_t curve, const double* us, std::size_t count, Vec3d* out) const;
+
+    // 单段转为有理 Bezier 曲线（局部参数 [0,1]），二维或三维，一维曲线按二维处理
+    RationalBezierCurve rationalBezier(std::size_t segment) const;
+
+    // 权重全部相等的段转为二维多项式 Bezier 曲线，否则抛出 invalid_argument
+    BezierCurve bezier(std::size_t segment) const;
+
+private:
+    std::size_t curveOf(std::size_t segment) const;
+    std::size_t locate(std::size_t curve, double u) const;
+
+    std::vector<Vec4d> points_;
+    std::vector<std::size_t> segmentOffset_; // 段 s 的控制点为 points_[segmentOffset_[s], segmentOffset_[s+1])
+    std::vector<std::size_t> curveOffset_;   // 曲线 c 的段为 [curveOffset_[c], curveOffset_[c+1])
+    std::vector<double> breaks_;             // 每条曲线 段数+1 个端点，曲线 c 起于 curveOffset_[c] + c
+    std::vector<int> dims_;
+};
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_BEZIER_SEGMENTS_H
@@ -0,0 +1,62 @@
+#ifndef GEOALGO_BOX2D_H
+#define GEOALGO_BOX2D_H
+
+#include "Point2D.h"
+#include <algorithm>
+#include <limits>
+
+namespace GeoAlgo {
+
+/**
+ * 二维轴对齐包围盒（AABB）
+ * 默认构造为空盒（lo = +inf, hi = -inf），expand 后变为非空
+ */
+struct Box2D {
+    Point2D lo = Point2D::filled(std::numeric_limits<double>::infinity());
+    Point2D hi = Point2D::filled(-std::numeric_limits<double>::infinity());
+
+    Box2D() = default;
+    Box2D(const Point2D& a, const Point2D& b)
+        : lo(std::min(a.x, b.x), std::min(a.y, b.y)), hi(std::max(a.x, b.x), std::max(a.y, b.y)) {}
+
+    bool empty() const { return lo.x > hi.x || lo.y > hi.y; }
+
+    void expand(const Point2D& p) {
+        lo = Point2D(std::min(lo.x, p.x), std::min(lo.y, p.y));
+        hi = Point2D(std::max(hi.x, p.x), std::max(hi.y, p.y));
+    }
+
+    void expand(const Box2D& b) {
+        lo = Point2D(std::min(lo.x, b.lo.x), std::min(lo.y, b.lo.y));
+        hi = Point2D(std::max(hi.x, b.hi.x), std::max(hi.y, b.hi.y));
+    }
+
+    static Box2D merge(Box2D a, const Box2D& b) {
+        a.expand(b);
+        return a;
+    }
+
+    Point2D center() const { return (lo + hi) * 0.5; }
+
+    // 周长，作为二维包围体层次的插入代价
+    double perimeter() const { return empty() ? 0.0 : 2.0 * ((hi.x - lo.x) + (hi.y - lo.y)); }
+
+    bool contains(const Point2D& p) const {
+        return p.x >= lo.x && p.x <= hi.x && p.y >= lo.y && p.y <= hi.y;
+    }
+
+    bool overlaps(const Box2D& b) const {
+        return lo.x <= b.hi.x && b.lo.x <= hi.x && lo.y <= b.hi.y && b.lo.y <= hi.y;
+    }
+
+    // 点到盒子的距离平方，点在盒内为 0
+    double squaredDistanceTo(const Point2D& p) const {
+        const double dx = std::max({lo.x - p.x, 0.0, p.x - hi.x});
+        const double dy = std::max({lo.y - p.y, 0.0, p.y - hi.y});
+        return dx * dx + dy * dy;
+    }
+};
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_BOX2D_H
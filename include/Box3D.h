@@ -0,0 +1,54 @@
+#ifndef GEOALGO_BOX3D_H
+#define GEOALGO_BOX3D_H
+
+#include "Vec.h"
+#include <algorithm>
+#include <limits>
+
+namespace GeoAlgo {
+
+/**
+ * 三维轴对齐包围盒（AABB），接口与 Box2D 一致
+ * 默认构造为空盒（lo = +inf, hi = -inf），expand 后变为非空
+ */
+struct Box3D {
+    Vec3d lo = Vec3d::filled(std::numeric_limits<double>::infinity());
+    Vec3d hi = Vec3d::filled(-std::numeric_limits<double>::infinity());
+
+    Box3D() = default;
+    Box3D(const Vec3d& a, const Vec3d& b)
+        : lo(std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z)),
+          hi(std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z)) {}
+
+    bool empty() const { return lo.x > hi.x || lo.y > hi.y || lo.z > hi.z; }
+
+    void expand(const Vec3d& p) {
+        lo = Vec3d(std::min(lo.x, p.x), std::min(lo.y, p.y), std::min(lo.z, p.z));
+        hi = Vec3d(std::max(hi.x, p.x), std::max(hi.y, p.y), std::max(hi.z, p.z));
+    }
+
+    void expand(const Box3D& b) {
+        lo = Vec3d(std::min(lo.x, b.lo.x), std::min(lo.y, b.lo.y), std::min(lo.z, b.lo.z));
+        hi = Vec3d(std::max(hi.x, b.hi.x), std::max(hi.y, b.hi.y), std::max(hi.z, b.hi.z));
+    }
+
+    static Box3D merge(Box3D a, const Box3D& b) {
+        a.expand(b);
+        return a;
+    }
+
+    Vec3d center() const { return (lo + hi) * 0.5; }
+
+    bool contains(const Vec3d& p) const {
+        return p.x >= lo.x && p.x <= hi.x && p.y >= lo.y && p.y <= hi.y && p.z >= lo.z && p.z <= hi.z;
+    }
+
+    bool overlaps(const Box3D& b) const {
+        return lo.x <= b.hi.x && b.lo.x <= hi.x && lo.y <= b.hi.y && b.lo.y <= hi.y && lo.z <= b.hi.z &&
+               b.lo.z <= hi.z;
+    }
+};
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_BOX3D_H
@@ -0,0 +1,135 @@
+#ifndef GEOALGO_CURVE_BVH_H
+#define GEOALGO_CURVE_BVH_H
+
+#include "BezierCurve.h"
+#include "Box2D.h"
+#include "NURBS.h"
+#include "ThreadPool.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace GeoAlgo {
+
+/**
+ * 曲线集合的包围体层次（BVH）与最近点投影
+ *
+ * - 叶子为一段曲线：Bezier 曲线整条一个叶子，NURBS 每个非零长度节点区间一个叶子；
+ *   每段以齐次 Bezier 控制点 (w*x, w*y, w) 缓存（NURBS 由 Bezier 分解取得），
+ *   包围盒取控制多边形的包围盒（凸包性质，要求权重为正）
+ * - 动态 AABB 树：add / update / remove 只插入、删除对应叶子并沿父链重算包围盒，
+ *   插入时按周长增量选择兄弟节点；rebuild() 按质心中位数自顶向下重建以恢复树的质量
+ * - 查询：深度优先、近子树优先遍历，盒距离不小于当前最优距离的子树被剪枝；
+ *   叶子内对 Bezier 段做 de Casteljau 对半细分，同样按控制多边形包围盒剪枝，
+ *   子段足够平直后从控制点中离查询点最近者对应的参数出发做 Newton 迭代
+ *     f(u) = C'(u)·(C(u)-q),  f'(u) = |C'(u)|² + C''(u)·(C(u)-q)
+ * - closestPoints 把查询点分块交给线程池并行执行，每个结果写入固定位置
+ */
+class CurveBVH {
+public:
+    struct Projection {
+        int curve = -1;       // 曲线编号，集合为空时为 -1
+        double param = 0.0;   // 曲线参数
+        Point2D point;        // 曲线上的最近点
+        double distance = 0.0;
+    };
+
+    CurveBVH() = default;
+    CurveBVH(CurveBVH&&) noexcept = default;
+    CurveBVH& operator=(CurveBVH&&) noexcept = default;
+
+    // 加入一条曲线（保存副本），返回编号；编号在 remove 之后也不会复用
+    int add(const BezierCurve& curve);
+    int add(const NURBS& curve); // 只接受二维、权重为正的 NURBS
+
+    // 替换编号 id 的几何，只重新插入它的叶子
+    void update(int id, const BezierCurve& curve);
+    void update(int id, const NURBS& curve);
+
+    void remove(int id);
+
+    // 自顶向下重建整棵树；批量 add 之后调用一次可得到更平衡的树
+    void rebuild();
+
+    std::size_t size() const { return numCurves_; }
+    bool contains(int id) const;
+    int height() const;
+
+    // 最近点；集合为空时 curve = -1
+    Projection closestPoint(const Point2D& q) const;
+
+    // 批量最近点：out[i] 对应 qs[i]，在线程池上并行
+    void closestPoints(const Point2D* qs, std::size_t count, Projection* out,
+                       ThreadPool& pool = ThreadPool::shared()) const;
+
+    // 点到单条曲线的投影；q 在曲线上时即点求逆（point inversion）
+    Projection project(int id, const Point2D& q) const;
+
+private:
+    struct Entry {
+        std::unique_ptr<BezierCurve> bezier;
+        std::unique_ptr<NURBS> nurbs;
+        std::vector<int> leaves;
+        std::vector<Vec3d> segments; // 每个叶子 degree+1 个齐次 Bezier 控制点
+        int degree = 0;
+    };
+    struct Leaf {
+        int curve;
+        double t0, t1;
+        int offset; // 在 Entry::segments 中的起始位置
+        int node;
+    };
+    // 叶子内细分的子段：段参数 [s0, s1]，控制点在 Scratch::points 栈顶
+    struct Piece {
+        double s0, s1;
+        int depth;
+    };
+    // 每个查询线程的工作区，避免逐点分配
+    struct Scratch {
+        std::vector<int> nodes;
+        std::vector<Piece> pieces;
+        std::vector<Vec3d> points;
+        std::vector<Vec3d> work;
+        std::vector<Point2D> projected;
+    };
+    struct Node {
+        Box2D box;
+        int parent = -1;
+        int left = -1;
+        int right = -1;
+        int leaf = -1; // 叶子节点为 leaves_ 下标，内部节点为 -1
+    };
+
+    static constexpr int kQueryGrain = 256;
+    static constexpr int kMaxSubdivisionDepth = 40;
+    static constexpr int kMaxNewtonIterations = 16;
+
+    int addEntry(Entry entry);
+    void buildLeaves(int id);
+    void dropLeaves(int id);
+    int allocNode();
+    void freeNode(int n);
+    void insertNode(int n);
+    void removeNode(int n);
+    void refit(int n);
+    int buildRange(int* nodes, int count);
+    const Entry& entry(int id) const;
+
+    void evaluate(const Entry& e, double u, Point2D* d, int k) const;
+    void newton(const Entry& e, const Point2D& q, double u, double lo, double hi, int curve,
+                Projection& best, double& bestD2) const;
+    void refineLeaf(const Leaf& leaf, const Point2D& q, Projection& best, double& bestD2, Scratch& sc) const;
+    Projection query(const Point2D& q, Scratch& sc) const;
+
+    std::vector<Entry> entries_;
+    std::vector<Leaf> leaves_;
+    std::vector<int> freeLeaves_;
+    std::vector<Node> nodes_;
+    std::vector<int> freeNodes_;
+    int root_ = -1;
+    std::size_t numCurves_ = 0;
+};
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_CURVE_BVH_H
@@ -0,0 +1,98 @@
+#ifndef GEOALGO_CURVE_BATCH_H
+#define GEOALGO_CURVE_BATCH_H
+
+#include "BezierCurve.h"
+#include "CurveStore.h"
+#include "Instrumentation.h"
+#include "NURBS.h"
+#include "PowerBasisCurve.h"
+#include "PowerBasisCurve1D.h"
+#include "PowerBasisCurve2D.h"
+#include "PowerBasisCurve3D.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+namespace GeoAlgo {
+
+/**
+ * 多曲线批量求值（Curve Batch）
+ * 所有曲线（曲线对象数组或 CurveStore）在同一组参数 us[0..count) 上求值，第 c 条曲线第 k 个参数的结果位于
+ * 输出的 c*count + k 处（NURBS 按 dim 展开）。
+ * 把 numCurves*count 个求值点切成约 grainSize 个点的任务，任务可跨越多条曲线，
+ * 也可只覆盖一条曲线的部分参数，由工作窃取线程池并行执行。
+ * 每个任务写入固定位置，输出与线程数、调度顺序无关。
+ */
+class CurveBatch {
+public:
+    // numThreads = 0 表示硬件并发数
+    explicit CurveBatch(std::size_t numThreads = 0, std::size_t grainSize = 4096);
+    explicit CurveBatch(ThreadPool& pool, std::size_t grainSize = 4096);
+
+    std::size_t threadCount() const { return pool_->size(); }
+    std::size_t grainSize() const { return grain_; }
+
+    void evaluate(const BezierCurve* curves, std::size_t numCurves,
+                  const double* us, std::size_t count, Point2D* out) const;
+
+    void evaluate(const PowerBasisCurve* curves, std::size_t numCurves,
+                  const double* us, std::size_t count, Point2D* out) const;
+
+    void evaluate(const PowerBasisCurve1D* curves, std::size_t numCurves,
+                  const double* us, std::size_t count, double* out) const;
+
+    // SoA 输出：xs/ys 各 numCurves*count 个值
+    void evaluate(const PowerBasisCurve2D* curves, std::size_t numCurves,
+                  const double* us, std::size_t count, double* xs, double* ys) const;
+
+    void evaluate(const PowerBasisCurve3D* curves, std::size_t numCurves,
+                  const double* us, std::size_t count, double* xs, double* ys, double* zs) const;
+
+    // 第 c 条曲线的结果从 out + offset_c 开始，offset_c = Σ_{j<c} count*dim_j
+    void evaluate(const NURBS* curves, std::size_t numCurves,
+                  const double* us, std::size_t count, double* out) const;
+
+    // 仓库中全部曲线，out 共 store.size()*count 个点
+    template <int Dim>
+    void evaluate(const CurveStoreT<Dim>& store,
+                  const double* us, std::size_t count, Vec<double, Dim>* out) const {
+        forEachRange(store.size(), count, [&](std::size_t c, std::size_t k0, std::size_t k1) {
+            store.evaluateMany(c, us + k0, k1 - k0, out + c * count + k0);
+        });
+    }
+
+    /**
+     * 通用入口：对每个区间调用 fn(curveIndex, k0, k1)，处理第 curveIndex 条曲线的参数 [k0, k1)
+     */
+    template <typename Fn>
+    void forEachRange(std::size_t numCurves, std::size_t count, Fn&& fn) const;
+
+private:
+    std::unique_ptr<ThreadPool> ownedPool_;
+    ThreadPool* pool_;
+    std::size_t grain_;
+};
+
+template <typename Fn>
+void CurveBatch::forEachRange(std::size_t numCurves, std::size_t count, Fn&& fn) const {
+    const std::size_t total = numCurves * count;
+    if (total == 0) return;
+    GEOALGO_SCOPED_TIMER(Timer::BatchEvaluation);
+    const std::size_t numTasks = (total + grain_ - 1) / grain_;
+    pool_->parallelFor(numTasks, [&](std::size_t task) {
+        std::size_t g = task * grain_;
+        const std::size_t gEnd = std::min(total, g + grain_);
+        while (g < gEnd) {
+            const std::size_t c = g / count;
+            const std::size_t k0 = g - c * count;
+            const std::size_t k1 = std::min(count, k0 + (gEnd - g));
+            fn(c, k0, k1);
+            g += k1 - k0;
+        }
+    });
+}
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_CURVE_BATCH_H
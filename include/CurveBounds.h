@@ -0,0 +1,49 @@
+#ifndef GEOALGO_CURVE_BOUNDS_H
+#define GEOALGO_CURVE_BOUNDS_H
+
+#include "BezierCurve.h"
+#include "Box2D.h"
+#include "Box3D.h"
+#include "NURBS.h"
+#include "PowerBasisCurve.h"
+#include "PowerBasisCurve1D.h"
+#include "PowerBasisCurve2D.h"
+#include "PowerBasisCurve3D.h"
+#include "RationalBezierCurve.h"
+#include <utility>
+
+namespace GeoAlgo {
+
+/**
+ * 曲线的精确轴对齐包围盒（而非控制多边形包围盒或采样包围盒）
+ *
+ * 每个分量的极值只出现在定义域端点或导数零点处：
+ * - 多项式分量 x(t)：求 x'(t) 在区间内的实根
+ * - 有理分量 x = A/W：x' = (A'W - AW')/W²，求分子 A'W - AW' 的实根（次数不超过 2p-1）
+ * Bezier 与有理 Bezier 先换成 [0,1] 上的幂基；NURBS 先分解为 Bezier 段逐段处理。
+ * 次数超过 kMaxConversionDegree 的 Bezier 段幂基误差过大，退回控制多边形包围盒（仍为保守包围盒）。
+ * 有理曲线要求权重为正。
+ */
+
+// 多项式 Σ coeffs[i] t^i 在 [t0, t1] 内的实根，升序写入 roots（至多 degree 个），返回个数
+// 导数的根把区间分成单调段，每段内至多一个根，以二分求得；恒为零的多项式没有孤立根，返回 0
+constexpr int kMaxRootDegree = 64;
+int polynomialRoots(const double* coeffs, int degree, double t0, double t1, double* roots);
+
+Box2D exactBounds(const BezierCurve& curve);
+Box2D exactBounds(const RationalBezierCurve& curve);
+// 幂基曲线在 [t0, t1] 上的包围盒；t0 > t1 时抛出 std::invalid_argument
+Box2D exactBounds(const PowerBasisCurve& curve, double t0 = 0.0, double t1 = 1.0);
+Box2D exactBounds(const PowerBasisCurve2D& curve, double t0 = 0.0, double t1 = 1.0);
+Box3D exactBounds(const PowerBasisCurve3D& curve, double t0 = 0.0, double t1 = 1.0);
+// 一维幂基：值域 [lo, hi]
+std::pair<double, double> exactRange(const PowerBasisCurve1D& curve, double t0 = 0.0, double t1 = 1.0);
+// NURBS 在定义域 [u_p, u_{n+1}] 上的包围盒；Box2D 版本取前两个分量（一维曲线 y 为 0）
+Box2D exactBounds(const NURBS& curve);
+
+Box3D exactBounds3D(const RationalBezierCurve& curve);
+Box3D exactBounds3D(const NURBS& curve);
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_CURVE_BOUNDS_H
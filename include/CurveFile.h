@@ -0,0 +1,215 @@
+#ifndef GEOALGO_CURVE_FILE_H
+#define GEOALGO_CURVE_FILE_H
+
+#include "BezierCurve.h"
+#include "CurveStore.h"
+#include "NURBS.h"
+#include "PowerBasisCurve.h"
+#include "PowerBasisCurve1D.h"
+#include "PowerBasisCurve2D.h"
+#include "PowerBasisCurve3D.h"
+#include "RationalBezierCurve.h"
+#include "Vec.h"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace GeoAlgo {
+
+/**
+ * 二进制曲线文件格式（小端，版本 kCurveFileVersion）
+ *
+ *   [0, 64)                 CurveFileHeader
+ *   [dataOffset, indexOffset) 系数区：各曲线的系数块 / 节点块，每块起点按 64 字节对齐
+ *   [indexOffset, ...)      索引区：numCurves 个 CurveFileEntry，每个 32 字节
+ *
+ * 系数块布局与各求值内核的输入一致，映射后无需转换即可求值：
+ * - Bezier / BSpline：按点连续（CurveKernels.h 的 AoS 布局），每点 dim 个分量；
+ *   有理曲线（kRational）每点 dim+1 个齐次分量 (w*x, .., w)
+ * - PowerBasis：按分量连续，coeffs[d*numPoints + i] 为第 d 个分量 t^i 的系数，
+ *   即 evaluatePowerBasisSoA 的输入布局
+ * - BSpline 另有 numPoints+degree+1 个节点的节点块
+ *
+ * 写入端先顺序写系数区，最后写索引并回填文件头，因此写入时内存中只保留索引
+ */
+constexpr char kCurveFileMagic[8] = {'G', 'E', 'O', 'C', 'U', 'R', 'V', 'E'};
+constexpr std::uint32_t kCurveFileVersion = 1;
+constexpr std::uint64_t kCurveFileEndianTag = 0x0102030405060708ull;
+// 块对齐（字节），同时是缓存行大小与 AVX-512 向量宽度
+constexpr std::size_t kCurveFileAlignment = 64;
+
+enum class CurveFileType : std::uint8_t {
+    Bezier     = 0, // 与 CurveKind 取值一致
+    PowerBasis = 1,
+    BSpline    = 2  // 非均匀（有理）B 样条
+};
+
+enum CurveFileFlags : std::uint8_t {
+    kCurveFileRational = 1, // 系数块为齐次坐标
+    kCurveFileKnots    = 2  // 有节点块
+};
+
+struct CurveFileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t headerSize;
+    std::uint64_t endianTag;
+    std::uint64_t numCurves;
+    std::uint64_t indexOffset; // 字节
+    std::uint64_t dataOffset;  // 字节
+    std::uint64_t dataSize;    // 系数区 double 个数
+    std::uint64_t reserved;
+};
+
+struct CurveFileEntry {
+    std::uint8_t type;  // CurveFileType
+    std::uint8_t dim;   // 1..3
+    std::uint8_t flags; // CurveFileFlags
+    std::uint8_t reserved0;
+    std::uint32_t numPoints;
+    std::uint64_t coeffOffset; // 相对系数区起点的 double 下标
+    std::uint64_t knotOffset;  // 同上，无节点块时为 0
+    std::uint32_t degree;
+    std::uint32_t reserved1;
+};
+
+static_assert(sizeof(CurveFileHeader) == 64, "CurveFileHeader must be 64 bytes");
+static_assert(sizeof(CurveFileEntry) == 32, "CurveFileEntry must be 32 bytes");
+
+/**
+ * 只读曲线文件：POSIX 下 mmap 整个文件，记录与求值直接指向映射页，不复制系数
+ * - 打开时检查文件头与索引区范围，并对每条 BSpline 检查一次节点是否有限、非降；
+ *   record(i) 只检查单条索引项的偏移是否越界并查表，为 O(1)，打开与访问都不扫描系数
+ * - validate() 做完整检查：索引项一致性、节点非降、权重为正、系数有限
+ * - 格式错误与 I/O 错误抛出 runtime_error，下标与类型误用抛出 invalid_argument
+ */
+class CurveFile {
+public:
+    // 单条曲线的视图，指针指向映射内存
+    struct Record {
+        CurveFileType type;
+        int dim;
+        int degree;
+        int numPoints;
+        bool rational;
+        const double* coeffs;
+        const double* knots; // 仅 BSpline
+        int numKnots() const { return knots ? numPoints + degree + 1 : 0; }
+        // 参数域：BSpline 为 [u_p, u_{n+1}]，其余为 [0, 1]
+        double firstParam() const { return knots ? knots[degree] : 0.0; }
+        double lastParam() const { return knots ? knots[numPoints] : 1.0; }
+        // 类型、维数、次数与点数是否一致（不检查系数），合法时返回空指针
+        const char* error() const;
+    };
+
+    CurveFile() = default;
+    explicit CurveFile(const std::string& path);
+    // 使用调用者持有的内存（须 8 字节对齐且在本对象生命周期内有效），不复制
+    static CurveFile fromMemory(const void* data, std::size_t size);
+
+    CurveFile(CurveFile&& other) noexcept;
+    CurveFile& operator=(CurveFile&& other) noexcept;
+    CurveFile(const CurveFile&) = delete;
+    CurveFile& operator=(const CurveFile&) = delete;
+    ~CurveFile();
+
+    std::size_t size() const { return numCurves_; }
+    std::size_t byteSize() const { return size_; }
+    // 未关联文件（默认构造或已被移走）时抛出 invalid_argument
+    const CurveFileHeader& header() const;
+
+    Record record(std::size_t i) const;
+
+    // 第 i 条曲线的点（缺少的分量为 0）；BSpline 参数截断到定义域
+    Vec3d evaluate(std::size_t i, double u) const;
+    void evaluateMany(std::size_t i, const double* us, std::size_t count, Vec3d* out) const;
+    // SoA 输出 outs[0..dim)；幂基曲线直接在映射的系数块上走 SIMD 内核
+    void evaluateMany(std::size_t i, const double* us, std::size_t count, double* const* outs) const;
+
+    // 复制为曲线对象；类型或维数不符时抛出 invalid_argument
+    BezierCurve bezierCurve(std::size_t i) const;           // 二维非有理 Bezier
+    RationalBezierCurve rationalBezier(std::size_t i) const; // 二维 / 三维 Bezier（权重缺省为 1）
+    PowerBasisCurve powerBasis(std::size_t i) const;        // 二维幂基
+    PowerBasisCurve1D powerBasis1D(std::size_t i, int component = 0) const;
+    PowerBasisCurve2D powerBasis2D(std::size_t i) const;
+    PowerBasisCurve3D powerBasis3D(std::size_t i) const;
+    NURBS nurbs(std::size_t i) const;
+
+    // 完整检查，返回发现的问题（最多 maxIssues 条，0 表示不限），为空表示文件有效
+    std::vector<std::string> validate(std::size_t maxIssues = 100) const;
+
+private:
+    void attach(const unsigned char* data, std::size_t size);
+    void release();
+    const CurveFileEntry& entry(std::size_t i) const;
+
+    const unsigned char* base_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t numCurves_ = 0;
+    const CurveFileEntry* index_ = nullptr;
+    const double* data_ = nullptr;
+    std::size_t dataSize_ = 0;
+    // 非空时为 mmap 的映射长度（或回退读取时的缓冲区）
+    void* mapping_ = nullptr;
+    std::size_t mappingSize_ = 0;
+    bool mapped_ = false;
+    // 打开时发现节点非法的曲线下标（升序），通常为空
+    std::vector<std::size_t> badKnots_;
+};
+
+// 记录视图上的求值（CurveFile 与流式流水线共用），缺少的分量为 0，BSpline 参数截断到定义域
+Vec3d evaluateRecord(const CurveFile::Record& r, double u);
+// 幂基记录分块走 SIMD 内核，其余逐点求值
+void evaluateRecordMany(const CurveFile::Record& r, const double* us, std::size_t count, Vec3d* out);
+// BSpline 记录复制为 NURBS 对象
+NURBS toNURBS(const CurveFile::Record& r);
+
+/**
+ * 顺序写入曲线文件：系数块直接写入文件，只在内存中保留索引
+ * finish() 写出索引并回填文件头；析构时未调用 finish() 会自动完成（忽略错误）
+ */
+class CurveFileWriter {
+public:
+    explicit CurveFileWriter(const std::string& path);
+    ~CurveFileWriter();
+    CurveFileWriter(const CurveFileWriter&) = delete;
+    CurveFileWriter& operator=(const CurveFileWriter&) = delete;
+
+    /**
+     * 通用接口：coeffs 按 CurveFile 的块布局存放（有理曲线每点 dim+1 个齐次分量），
+     * knots 仅 BSpline 需要（numPoints+degree+1 个），返回曲线下标
+     */
+    std::size_t add(CurveFileType type, int dim, int degree, int numPoints, bool rational,
+                    const double* coeffs, const double* knots = nullptr);
+
+    std::size_t add(const BezierCurve& curve);
+    std::size_t add(const RationalBezierCurve& curve);
+    std::size_t add(const PowerBasisCurve& curve);
+    std::size_t add(const PowerBasisCurve1D& curve);
+    std::size_t add(const PowerBasisCurve2D& curve);
+    std::size_t add(const PowerBasisCurve3D& curve);
+    // 权重全为 1 时写为非有理
+    std::size_t add(const NURBS& curve);
+
+    // 追加仓库中的全部曲线
+    template <int Dim>
+    void add(const CurveStoreT<Dim>& store);
+
+    std::size_t size() const { return entries_.size(); }
+    void finish();
+
+private:
+    std::uint64_t writeBlock(const double* values, std::size_t count);
+
+    std::ofstream out_;
+    std::string path_;
+    std::vector<CurveFileEntry> entries_;
+    std::uint64_t dataSize_ = 0; // 已写入的系数区 double 个数（含对齐填充）
+    bool finished_ = false;
+};
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_CURVE_FILE_H
@@ -0,0 +1,75 @@
+#ifndef GEOALGO_CURVE_FITTING_H
+#define GEOALGO_CURVE_FITTING_H
+
+#include "NURBS.h"
+#include "Point2D.h"
+#include "ThreadPool.h"
+#include "Vec.h"
+#include <cstddef>
+#include <vector>
+
+namespace GeoAlgo {
+
+/**
+ * 数据点的参数化，结果非降且落在 [0,1]，首末为 0 与 1
+ * - Uniform：等距
+ * - ChordLength：参数差正比于相邻点距离
+ * - Centripetal：参数差正比于距离的平方根，拐角处不易打结
+ * 所有点重合时退回等距参数
+ */
+enum class Parameterization {
+    Uniform,
+    ChordLength,
+    Centripetal
+};
+
+// points 为 count 个 dim 维点按点连续存放
+std::vector<double> parameterize(const double* points, std::size_t count, int dim, Parameterization method);
+
+/**
+ * 最小二乘逼近的 clamped 节点向量（NURBS Book 式 9.68–9.69 平均法）
+ * 内部节点取相邻数据参数的加权平均，使每个非零节点区间都含有数据参数，法方程正定
+ * 要求 degree+1 <= numControlPoints <= params.size()
+ */
+std::vector<double> approximationKnots(const std::vector<double>& params, int numControlPoints, int degree);
+
+struct CurveFitOptions {
+    int degree = 3;
+    Parameterization parameterization = Parameterization::Centripetal;
+    int numControlPoints = 0;       // 初始控制点数，0 时取 degree+1
+    std::vector<double> knots;      // 非空时作为初始节点向量（忽略 numControlPoints）
+    bool interpolateEnds = true;    // 首末控制点固定为首末数据点，不参与最小二乘
+    double tolerance = 0.0;         // > 0 时按误差插入节点并重新拟合，直到最大误差不超过它
+    int maxControlPoints = 0;       // 节点插入的控制点数上限，0 表示数据点数
+    int maxIterations = 32;         // 重新拟合的最多次数
+    std::size_t grainPoints = 16384; // 组装与误差计算时每个任务处理的数据点数
+    ThreadPool* pool = nullptr;      // 为空时使用 ThreadPool::shared()
+};
+
+struct CurveFitResult {
+    NURBS curve;                // 非有理 B 样条（权重全为 1）
+    std::vector<double> params; // 数据点的参数
+    double maxError = 0.0;      // 数据点到 C(params[k]) 的最大距离
+    double rmsError = 0.0;
+    int iterations = 0;         // 求解次数
+};
+
+/**
+ * 最小二乘 B 样条逼近：min Σ |C(u_k) - Q_k|²
+ *
+ * - 固定节点时法方程 (NᵀN) P = Nᵀ Q 是半带宽为 degree 的对称正定带状矩阵，
+ *   用 BandedMatrix 的带状 Cholesky 求解，O(n·p²)，不形成稠密矩阵
+ * - 组装按数据点分块在线程池上并行：参数非降，每块只触及一段连续的控制点，
+ *   各块在局部带状缓冲区中累加后按块序合并，结果与线程数无关
+ * - tolerance > 0 时，在最大误差超过容差的节点区间内，于该区间数据参数的中位数处插入节点，
+ *   然后重新拟合，直到满足容差、达到 maxControlPoints 或 maxIterations
+ * 误差是数据点到其参数处曲线点的距离（不做参数修正），为到曲线距离的上界
+ */
+CurveFitResult fitBSpline(const double* points, std::size_t count, int dim,
+                          const CurveFitOptions& options = CurveFitOptions());
+CurveFitResult fitBSpline(const std::vector<Point2D>& points, const CurveFitOptions& options = CurveFitOptions());
+CurveFitResult fitBSpline(const std::vector<Vec3d>& points, const CurveFitOptions& options = CurveFitOptions());
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_CURVE_FITTING_H
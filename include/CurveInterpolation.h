@@ -0,0 +1,68 @@
+#ifndef GEOALGO_CURVE_INTERPOLATION_H
+#define GEOALGO_CURVE_INTERPOLATION_H
+
+#include "BezierCurve.h"
+#include "CurveFitting.h"
+#include "NURBS.h"
+#include "Point2D.h"
+#include "ThreadPool.h"
+#include "Vec.h"
+#include <cstddef>
+#include <vector>
+
+namespace GeoAlgo {
+
+/**
+ * 全局 B 样条插值：C(t_k) = Q_k，k = 0..count-1
+ *
+ * - 参数 t_k 由 parameterize 给出，节点取参数的滑动平均（NURBS Book 式 9.8），控制点数等于数据点数
+ * - 配置矩阵 N_{i}(t_k) 是半带宽小于 degree 的全正带状矩阵，按带状存放并用不选主元的带状 LU 求解，
+ *   O(count·degree²)，不形成稠密矩阵；各坐标分量作为多个右端项一次求解
+ * - 相邻参数必须严格递增（Uniform 之外要求相邻点不重合），否则抛出 invalid_argument
+ * 结果为非有理 B 样条（权重全为 1），定义域 [0,1]
+ */
+NURBS interpolateBSpline(const double* points, std::size_t count, int dim, int degree = 3,
+                         Parameterization method = Parameterization::Centripetal);
+NURBS interpolateBSpline(const std::vector<Point2D>& points, int degree = 3,
+                         Parameterization method = Parameterization::Centripetal);
+NURBS interpolateBSpline(const std::vector<Vec3d>& points, int degree = 3,
+                         Parameterization method = Parameterization::Centripetal);
+
+/**
+ * 批量插值互不相关的点序列：第 s 条序列为 points 中第 [offsets[s], offsets[s+1]) 个点
+ * 按序列分块在线程池上并行，每条序列的结果与单独调用 interpolateBSpline 相同
+ */
+std::vector<NURBS> interpolateBSplines(const double* points, const std::size_t* offsets, std::size_t numSequences,
+                                       int dim, int degree = 3,
+                                       Parameterization method = Parameterization::Centripetal,
+                                       ThreadPool& pool = ThreadPool::shared());
+std::vector<NURBS> interpolateBSplines(const std::vector<std::vector<Point2D>>& sequences, int degree = 3,
+                                       Parameterization method = Parameterization::Centripetal,
+                                       ThreadPool& pool = ThreadPool::shared());
+
+/**
+ * 三次 Hermite 插值，转为 count-1 段三次 Bezier 曲线
+ * 第 i 段对应参数区间 [params[i], params[i+1]]（映射到局部 [0,1]），tangents 为对原参数的导数：
+ *   B_0 = P_i,  B_1 = P_i + h m_i / 3,  B_2 = P_{i+1} - h m_{i+1} / 3,  B_3 = P_{i+1},  h = params[i+1] - params[i]
+ */
+std::vector<BezierCurve> hermiteSegments(const std::vector<Point2D>& points, const std::vector<Point2D>& tangents,
+                                         const std::vector<double>& params);
+
+/**
+ * Catmull-Rom 样条（C1，局部构造 O(count)）：内部点的切向取过相邻三点的抛物线在该点的导数，
+ * 端点取抛物线端点导数；配合 Centripetal 参数化即向心 Catmull-Rom，不产生尖点与自交
+ */
+std::vector<BezierCurve> catmullRomSegments(const std::vector<Point2D>& points,
+                                            Parameterization method = Parameterization::Centripetal);
+
+/**
+ * 自然三次样条（C2，两端二阶导数为 0）：切向由三对角方程组
+ *   h_i m_{i-1} + 2(h_{i-1} + h_i) m_i + h_{i-1} m_{i+1} = 3(h_i s_{i-1} + h_{i-1} s_i)
+ * 给出（s_i 为弦斜率），严格对角占优，带状 LU O(count) 求解
+ */
+std::vector<BezierCurve> cubicSplineSegments(const std::vector<Point2D>& points,
+                                             Parameterization method = Parameterization::ChordLength);
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_CURVE_INTERPOLATION_H
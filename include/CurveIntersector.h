@@ -0,0 +1,87 @@
+#ifndef GEOALGO_CURVE_INTERSECTOR_H
+#define GEOALGO_CURVE_INTERSECTOR_H
+
+#include "BezierCurve.h"
+#include "Box2D.h"
+#include "PowerBasisCurve.h"
+#include "ThreadPool.h"
+#include <cstddef>
+#include <vector>
+
+namespace GeoAlgo {
+
+/**
+ * 曲线求交（Curve Intersection）
+ *
+ * - 曲线–线段：有符号距离 d(u) = (P(u)-p0)×dir / |dir| 本身是 Bezier 函数，控制值 d_i 由控制点直接得到；
+ *   Bezier 裁剪（Bezier clipping）用控制多边形 (i/n, d_i) 凸包与 u 轴的交把参数区间收缩到可能含根的部分，
+ *   收缩不足一半时对半细分以分离多个根
+ * - 曲线–曲线：de Casteljau 细分，控制多边形包围盒不相交即排除；两段都足够平直后由弦的交点
+ *   出发做二维 Newton 迭代 A(s) = B(t)；切点处 Newton 退化，改用交替投影求最近点，
+ *   距离在容差内即记为相切交点；仍不收敛则继续细分；平直且共线重叠的两段报告重叠端点
+ * - 全部曲线两两求交：按 x 方向扫描排序（sweep and prune）生成包围盒相交的候选对，
+ *   候选对按扫描位置分块在线程池上并行检测，结果按 (curveA, curveB, tA) 排序，与线程数无关
+ * - 幂基曲线在 [0,1] 上先转为 Bezier 形式
+ */
+class CurveIntersector {
+public:
+    struct Hit {
+        int curveA;   // curveA < curveB
+        int curveB;
+        double tA;
+        double tB;
+        Point2D point;
+    };
+
+    struct LineHit {
+        double t; // 曲线参数
+        double s; // 线段参数，p0 + s*(p1-p0)
+        Point2D point;
+    };
+
+    // tolerance：交点处两曲线距离的容差（绝对值），同时用于合并重复交点
+    explicit CurveIntersector(double tolerance = 1e-9, int maxDepth = 48);
+
+    double tolerance() const { return tolerance_; }
+    int maxDepth() const { return maxDepth_; }
+
+    // 曲线与线段 [p0, p1] 的交点，追加到 out，按 t 排序
+    void intersect(const BezierCurve& curve, const Point2D& p0, const Point2D& p1,
+                   std::vector<LineHit>& out) const;
+
+    // 两条曲线的交点，追加到 out（curveA = 0, curveB = 1），按 tA 排序
+    void intersect(const BezierCurve& a, const BezierCurve& b, std::vector<Hit>& out) const;
+
+    // 集合内全部曲线两两求交
+    std::vector<Hit> intersectAll(const BezierCurve* curves, std::size_t count,
+                                  ThreadPool& pool = ThreadPool::shared()) const;
+    std::vector<Hit> intersectAll(const PowerBasisCurve* curves, std::size_t count,
+                                  ThreadPool& pool = ThreadPool::shared()) const;
+
+private:
+    struct Piece {
+        int offsetA, offsetB; // 子段控制点在 Scratch::points 中的位置
+        double a0, a1, b0, b1;
+        int depth;
+    };
+    struct Scratch {
+        std::vector<Piece> pieces;
+        std::vector<Point2D> points;
+        std::vector<Point2D> work;
+    };
+
+    static constexpr std::size_t kSweepGrain = 64;
+
+    void intersectPair(const BezierCurve& a, const BezierCurve& b, int ia, int ib,
+                       std::vector<Hit>& out, Scratch& sc) const;
+    bool newton(const BezierCurve& a, const BezierCurve& b, double& s, double& t) const;
+    bool closestApproach(const BezierCurve& a, const BezierCurve& b, double& s, double& t) const;
+    void addHit(std::vector<Hit>& out, std::size_t first, const Hit& hit, double radius) const;
+
+    double tolerance_;
+    int maxDepth_;
+};
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_CURVE_INTERSECTOR_H
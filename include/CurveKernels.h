@@ -0,0 +1,46 @@
+#ifndef GEOALGO_CURVE_KERNELS_H
+#define GEOALGO_CURVE_KERNELS_H
+
+#include "Vec.h"
+
+namespace GeoAlgo {
+
+/**
+ * 直接作用于连续坐标数组的曲线求值内核
+ * 控制点 / 系数按点连续存放（AoS），每个点 Dim 个 double，适用于 CurveStore、
+ * 内存映射文件等不持有曲线对象的场景。
+ */
+
+// Pascal 三角形中的一行 C(n, 0..n)，n <= kMaxTableDegree，首次调用时构建
+constexpr int kMaxTableDegree = 63;
+const double* binomialTableRow(int n);
+
+// Bernstein 形式的 Horner 递推：Q = C(n,0)P_0;  Q = Q*(1-u) + C(n,i) u^i P_i
+template <int Dim>
+inline Vec<double, Dim> bezierPoint(const double* P, int degree, double u) {
+    using V = Vec<double, Dim>;
+    auto load = [&](int i) { return V::generate([&](int d) { return P[i * Dim + d]; }); };
+    const double* C = binomialTableRow(degree);
+    const double s = 1.0 - u;
+    double ui = 1.0;
+    V r = load(0);
+    for (int i = 1; i <= degree; ++i) {
+        ui *= u;
+        r = r * s + load(i) * (C[i] * ui);
+    }
+    return r;
+}
+
+// Horner：r = a_n;  r = r*t + a_i
+template <int Dim>
+inline Vec<double, Dim> powerBasisPoint(const double* a, int degree, double t) {
+    using V = Vec<double, Dim>;
+    auto load = [&](int i) { return V::generate([&](int d) { return a[i * Dim + d]; }); };
+    V r = load(degree);
+    for (int i = degree - 1; i >= 0; --i) r = axpy(r, t, load(i));
+    return r;
+}
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_CURVE_KERNELS_H
@@ -0,0 +1,198 @@
+#ifndef GEOALGO_CURVE_PIPELINE_H
+#define GEOALGO_CURVE_PIPELINE_H
+
+#include "AdaptiveTessellator.h"
+#include "CurveFile.h"
+#include "ThreadPool.h"
+#include "Vec.h"
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace GeoAlgo {
+
+/**
+ * 一块输入曲线：records 为记录视图，可能指向 storage（流式解析）或外部内存（映射文件）
+ */
+struct CurveChunk {
+    std::size_t firstCurve = 0; // 第一条曲线在整个输入中的下标
+    std::vector<CurveFile::Record> records;
+    std::vector<double> storage;
+
+    std::size_t size() const { return records.size(); }
+    void clear() {
+        records.clear();
+        storage.clear();
+    }
+};
+
+/**
+ * 一块输出点：第 c 条曲线的点为 points[offsets[c], offsets[c+1])，参数在 params 中同位置，
+ * 维数为 dims[c]（缺少的分量为 0）。points / params 按容量预分配，只有前 offsets.back() 个有效
+ */
+struct PointChunk {
+    std::size_t firstCurve = 0;
+    std::vector<std::size_t> offsets;
+    std::vector<int> dims;
+    std::vector<Vec3d> points;
+    std::vector<double> params;
+
+    std::size_t numCurves() const { return dims.size(); }
+    std::size_t numPoints() const { return offsets.empty() ? 0 : offsets.back(); }
+};
+
+/**
+ * 曲线来源：每次读入至多 maxCurves 条曲线到 chunk（调用前已清空），返回条数，0 表示结束
+ * 在读取线程上调用，同一时刻只有一个调用
+ */
+class CurveSource {
+public:
+    virtual ~CurveSource() = default;
+    virtual std::size_t read(CurveChunk& chunk, std::size_t maxCurves) = 0;
+};
+
+/**
+ * 点输出：按输入顺序逐块调用，在写出线程上执行
+ */
+class PointSink {
+public:
+    virtual ~PointSink() = default;
+    virtual void write(const PointChunk& chunk) = 0;
+};
+
+// 映射文件中 [first, first+count) 的曲线，记录直接指向映射页，不复制系数
+class CurveFileSource : public CurveSource {
+public:
+    explicit CurveFileSource(const CurveFile& file, std::size_t first = 0, std::size_t count = static_cast<std::size_t>(-1));
+    std::size_t read(CurveChunk& chunk, std::size_t maxCurves) override;
+
+private:
+    const CurveFile& file_;
+    std::size_t next_;
+    std::size_t end_;
+};
+
+/**
+ * 文本曲线流，每行一条曲线（空行与 # 开头的行忽略），点坐标按点连续：
+ *   bezier  dim degree  P_0 .. P_n
+ *   rbezier dim degree  (P_i w_i) ..
+ *   power   dim degree  a_0 .. a_n          （a_i 为 t^i 的 dim 维系数）
+ *   bspline dim degree n  P_0 .. P_{n-1}  U_0 .. U_{n+degree}
+ *   nurbs   dim degree n  (P_i w_i) ..    U_0 .. U_{n+degree}
+ * 解析错误抛出 runtime_error（含行号）
+ */
+class CurveTextSource : public CurveSource {
+public:
+    explicit CurveTextSource(std::istream& in);
+    std::size_t read(CurveChunk& chunk, std::size_t maxCurves) override;
+
+private:
+    std::istream& in_;
+    std::size_t line_ = 0;
+    std::size_t next_ = 0;
+    std::string buffer_;
+    std::vector<double> values_;
+    // 本块各曲线系数 / 节点在 storage 中的偏移，读完整块后再设置记录指针
+    std::vector<std::size_t> coeffOffsets_;
+    std::vector<std::size_t> knotOffsets_;
+};
+
+// 每个点一行 "曲线下标 参数 x [y [z]]"
+class TextPointSink : public PointSink {
+public:
+    explicit TextPointSink(std::ostream& out, int precision = 17);
+    void write(const PointChunk& chunk) override;
+
+private:
+    std::ostream& out_;
+    int precision_;
+};
+
+// 每条曲线：uint64 下标、uint64 点数、点数×dim 个 double（按点连续）
+class BinaryPointSink : public PointSink {
+public:
+    explicit BinaryPointSink(std::ostream& out) : out_(out) {}
+    void write(const PointChunk& chunk) override;
+
+private:
+    std::ostream& out_;
+    std::vector<double> buffer_;
+};
+
+class CallbackPointSink : public PointSink {
+public:
+    explicit CallbackPointSink(std::function<void(const PointChunk&)> fn) : fn_(std::move(fn)) {}
+    void write(const PointChunk& chunk) override { fn_(chunk); }
+
+private:
+    std::function<void(const PointChunk&)> fn_;
+};
+
+struct CurvePipelineOptions {
+    enum class Mode {
+        Evaluate,  // 定义域上 samplesPerCurve 个等距参数
+        Tessellate // AdaptiveTessellator，每条曲线至多 maxPointsPerCurve 个点，超出时改为等距采样
+    };
+    Mode mode = Mode::Evaluate;
+    std::size_t chunkCurves = 4096;
+    std::size_t chunkBytes = std::size_t(16) << 20; // 单个输出块中点与参数的字节上限，可进一步减少每块曲线数
+    std::size_t samplesPerCurve = 64;
+    double tolerance = 1e-3;
+    int maxDepth = 20;
+    std::size_t maxPointsPerCurve = 1024;
+    std::size_t grainCurves = 64;  // 块内按曲线分给线程池的粒度
+    ThreadPool* pool = nullptr;    // 为空时使用 ThreadPool::shared()
+};
+
+struct PipelineStats {
+    std::size_t curves = 0;
+    std::size_t points = 0;
+    std::size_t chunks = 0;
+    std::size_t truncatedCurves = 0; // 离散点数超过 maxPointsPerCurve 而改为等距采样的曲线
+    double seconds = 0.0;            // 总墙钟时间
+    double readSeconds = 0.0;        // 各阶段忙碌时间（阶段重叠，因此和可超过总时间）
+    double computeSeconds = 0.0;
+    double writeSeconds = 0.0;
+    std::size_t bufferBytes = 0;     // 两组输入 / 输出缓冲区的峰值容量（字节）
+
+    double curvesPerSecond() const { return seconds > 0.0 ? curves / seconds : 0.0; }
+    double pointsPerSecond() const { return seconds > 0.0 ? points / seconds : 0.0; }
+    std::string toText() const;
+};
+
+/**
+ * 有界内存的流式求值流水线：读取 → 计算 → 写出
+ *
+ * - 三个阶段各占一个线程（计算阶段在调用线程上，块内再按曲线在线程池上并行），
+ *   输入块与输出块各有两份缓冲区循环使用（双缓冲）：计算第 k 块时读取第 k+1 块、写出第 k-1 块
+ * - 常驻内存只有这四块缓冲区，与输入总量无关：每块至多 chunkCurves() 条曲线，
+ *   即 chunkCurves 与 chunkBytes / (每条曲线的点数 × 40 字节) 中的较小者，
+ *   因此单个输出块不超过 chunkBytes（单条曲线超出时每块一条）
+ * - 输出按输入顺序，与线程数无关
+ * - 任一阶段抛出异常时其余阶段停止，异常在 run() 中重新抛出
+ */
+class CurvePipeline {
+public:
+    explicit CurvePipeline(const CurvePipelineOptions& options = CurvePipelineOptions());
+
+    const CurvePipelineOptions& options() const { return options_; }
+    // 每块实际读取的曲线数
+    std::size_t chunkCurves() const { return chunkCurves_; }
+
+    PipelineStats run(CurveSource& source, PointSink& sink) const;
+
+private:
+    void compute(const CurveChunk& in, PointChunk& out, std::size_t& truncated) const;
+
+    CurvePipelineOptions options_;
+    AdaptiveTessellator tessellator_;
+    std::size_t chunkCurves_ = 0;
+};
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_CURVE_PIPELINE_H
@@ -0,0 +1,79 @@
+#ifndef GEOALGO_CURVE_RTREE_H
+#define GEOALGO_CURVE_RTREE_H
+
+#include "BezierCurve.h"
+#include "Box2D.h"
+#include "NURBS.h"
+#include "PowerBasisCurve2D.h"
+#include "ThreadPool.h"
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace GeoAlgo {
+
+/**
+ * 大规模曲线集合的静态 R 树（STR 批量装载，Sort-Tile-Recursive）
+ *
+ * - 对象编号即输入下标；曲线集合的构造函数先在线程池上并行计算每条曲线的精确包围盒
+ *   （CurveBounds.h）并缓存在树中（box(id)），之后的查询不再访问曲线
+ * - 空包围盒（如空曲线）的对象不进入树，任何查询都不返回；含 NaN 的包围盒抛出 std::invalid_argument
+ * - 装载：n 个包围盒按中心 x 排序，切成 ceil(sqrt(n/M)) 条竖带，带内按中心 y 排序，
+ *   每 M 个连续条目打包成一个节点；上层节点以同样方式打包，直到只剩一个根。
+ *   各竖带的排序与节点包围盒的计算在线程池上并行，结果与线程数无关
+ * - 每层节点连续存放，节点的子节点是下一层中的一段连续区间，不使用指针
+ * - 建成后只读：所有查询都是 const，不修改共享状态，可在多个线程上并发执行
+ */
+class CurveRTree {
+public:
+    static constexpr int kNodeCapacity = 16;
+
+    struct Neighbor {
+        int id;
+        double distance;
+    };
+
+    CurveRTree() = default;
+    explicit CurveRTree(std::vector<Box2D> boxes, ThreadPool& pool = ThreadPool::shared());
+    explicit CurveRTree(const std::vector<BezierCurve>& curves, ThreadPool& pool = ThreadPool::shared());
+    // 幂基曲线取 [0,1] 上的包围盒
+    explicit CurveRTree(const std::vector<PowerBasisCurve2D>& curves, ThreadPool& pool = ThreadPool::shared());
+    explicit CurveRTree(const std::vector<NURBS>& curves, ThreadPool& pool = ThreadPool::shared());
+
+    std::size_t size() const { return boxes_.size(); }
+    bool empty() const { return boxes_.empty(); }
+    // 层数（含叶子层），空树为 0
+    int height() const { return static_cast<int>(levels_.size()); }
+    // 第 id 个对象缓存的包围盒
+    const Box2D& box(int id) const { return boxes_[id]; }
+    // 全部对象的包围盒
+    Box2D bounds() const { return levels_.empty() ? Box2D() : levels_.back()[0].box; }
+
+    // 包围盒与 window 相交（含边界接触）的对象编号，追加到 out，返回个数
+    std::size_t query(const Box2D& window, std::vector<int>& out) const;
+
+    /**
+     * 离 q 最近的 k 个对象，按距离升序（距离相同时按编号）
+     * distance 为空时距离为 q 到对象包围盒的距离；否则 distance(id, q) 给出到对象本身的距离，
+     * 包围盒距离作为其下界，按最优优先顺序只对可能进入结果的对象调用 distance
+     */
+    std::vector<Neighbor> nearest(const Point2D& q, std::size_t k = 1,
+                                  const std::function<double(int, const Point2D&)>& distance = nullptr) const;
+
+private:
+    struct Node {
+        Box2D box;
+        int first; // 子条目在下一层（叶子层为 items_）中的起始位置
+        int count;
+    };
+
+    void build(ThreadPool& pool);
+
+    std::vector<Box2D> boxes_;             // 按编号
+    std::vector<int> items_;               // 叶子层条目：STR 顺序下的对象编号
+    std::vector<std::vector<Node>> levels_; // levels_[0] 为叶子节点，levels_.back() 只有根节点
+};
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_CURVE_RTREE_H
@@ -0,0 +1,120 @@
+#ifndef GEOALGO_CURVE_STORE_H
+#define GEOALGO_CURVE_STORE_H
+
+#include "BezierCurve.h"
+#include "CurveKernels.h"
+#include "PowerBasisCurve.h"
+#include "PowerBasisCurve2D.h"
+#include "PowerBasisCurve3D.h"
+#include "Vec.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GeoAlgo {
+
+/**
+ * 曲线类型
+ */
+enum class CurveKind : std::uint8_t {
+    Bezier     = 0, // Bernstein 控制点，参数域 [0,1]
+    PowerBasis = 1  // 幂基系数，低次到高次
+};
+
+/**
+ * 扁平曲线仓库（CSR 布局）CurveStoreT<Dim>
+ * - 所有曲线的控制点 / 系数按点连续存放在一块坐标数组中（每点 Dim 个 double）
+ * - offsets[c] .. offsets[c+1] 为第 c 条曲线的点下标区间，次数 = 点数 - 1
+ * - 可选的分块 SoA 副本：第 c 条曲线占 [Dim*offsets[c], Dim*offsets[c+1])，
+ *   按分量连续（x0..xn, y0..yn, ...），即幂基 SIMD 内核的输入布局
+ * - 百万条曲线只对应几次大块分配，句柄 CurveRef 只含仓库指针与下标
+ */
+template <int Dim>
+class CurveStoreT {
+    static_assert(Dim == 2 || Dim == 3, "CurveStoreT: Dim must be 2 or 3");
+
+public:
+    using Point = Vec<double, Dim>;
+
+    /**
+     * 轻量句柄：不拥有数据，仓库追加曲线后仍然有效（数据指针除外）
+     */
+    class CurveRef {
+    public:
+        CurveRef(const CurveStoreT* store, std::size_t index) : store_(store), index_(index) {}
+
+        std::size_t index() const { return index_; }
+        CurveKind kind() const { return store_->kind(index_); }
+        int degree() const { return store_->degree(index_); }
+        // 第一个控制点的坐标，共 (degree+1)*Dim 个 double
+        const double* data() const { return store_->data(index_); }
+        Point point(int i) const { return store_->point(index_, i); }
+        Point evaluate(double u) const { return store_->evaluate(index_, u); }
+
+    private:
+        const CurveStoreT* store_;
+        std::size_t index_;
+    };
+
+    CurveStoreT() : offsets_(1, 0) {}
+
+    std::size_t size() const { return kinds_.size(); }
+    std::size_t pointCount() const { return offsets_.back(); }
+    void reserve(std::size_t numCurves, std::size_t numPoints);
+    void clear();
+
+    // 追加一条曲线（numPoints 个点，按点连续的坐标），返回曲线下标
+    std::size_t append(CurveKind kind, const double* coords, std::size_t numPoints);
+    std::size_t append(CurveKind kind, const std::vector<Point>& points);
+    std::size_t append(const BezierCurve& curve);
+    std::size_t append(const PowerBasisCurve& curve);
+    std::size_t append(const PowerBasisCurve2D& curve);
+    std::size_t append(const PowerBasisCurve3D& curve);
+
+    /**
+     * 批量载入 CSR 数据：coords 共 offsets[numCurves]*Dim 个 double，
+     * offsets 共 numCurves+1 个（offsets[0] == 0），kinds 为空指针时全部为 kind
+     */
+    void bulkLoad(const double* coords, const std::size_t* offsets, std::size_t numCurves,
+                  const CurveKind* kinds, CurveKind kind = CurveKind::Bezier);
+
+    CurveRef operator[](std::size_t c) const { return CurveRef(this, c); }
+
+    CurveKind kind(std::size_t c) const { return static_cast<CurveKind>(kinds_[c]); }
+    int degree(std::size_t c) const { return static_cast<int>(offsets_[c + 1] - offsets_[c]) - 1; }
+    std::size_t offset(std::size_t c) const { return offsets_[c]; }
+    const double* data(std::size_t c) const { return coords_.data() + offsets_[c] * Dim; }
+    Point point(std::size_t c, int i) const;
+
+    const std::vector<double>& coordinates() const { return coords_; }
+    const std::vector<std::size_t>& offsets() const { return offsets_; }
+
+    // 构建 / 丢弃分块 SoA 副本；追加曲线后需重新构建
+    void buildSoA();
+    void releaseSoA();
+    bool hasSoA() const { return soaValid_; }
+    // 第 c 条曲线的 SoA 块，分量 d 的系数从 soaData(c) + d*(degree+1) 开始
+    const double* soaData(std::size_t c) const { return soa_.data() + offsets_[c] * Dim; }
+
+    Point evaluate(std::size_t c, double u) const;
+
+    // 第 c 条曲线在 us[0..count) 上求值
+    void evaluateMany(std::size_t c, const double* us, std::size_t count, Point* out) const;
+
+    // SoA 输出 outs[d][0..count)；幂基曲线在 SoA 副本存在时走 SIMD 内核
+    void evaluateMany(std::size_t c, const double* us, std::size_t count, double* const* outs) const;
+
+private:
+    std::vector<double> coords_;
+    std::vector<std::size_t> offsets_;
+    std::vector<std::uint8_t> kinds_;
+    std::vector<double> soa_;
+    bool soaValid_ = false;
+};
+
+using CurveStore2D = CurveStoreT<2>;
+using CurveStore3D = CurveStoreT<3>;
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_CURVE_STORE_H
@@ -0,0 +1,27 @@
+#ifndef GEOALGO_FIXED_MATH_H
+#define GEOALGO_FIXED_MATH_H
+
+#include <array>
+
+namespace GeoAlgo {
+namespace detail {
+
+/**
+ * 编译期组合数表：binomialRow<N>()[i] = C(N, i)
+ */
+template <int N>
+constexpr std::array<double, N + 1> binomialRow() {
+    std::array<double, N + 1> row{};
+    row[0] = 1.0;
+    for (int i = 1; i <= N; ++i)
+        row[i] = row[i - 1] * (N - i + 1) / i;
+    return row;
+}
+
+template <int N>
+constexpr std::array<double, N + 1> kBinomialRow = binomialRow<N>();
+
+} // namespace detail
+} // namespace GeoAlgo
+
+#endif // GEOALGO_FIXED_MATH_H
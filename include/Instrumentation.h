@@ -0,0 +1,164 @@
+#ifndef GEOALGO_INSTRUMENTATION_H
+#define GEOALGO_INSTRUMENTATION_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/**
+ * 热路径插桩：计数器、作用域计时器与内存分配计数
+ *
+ * - 编译期开关 GEOALGO_ENABLE_INSTRUMENTATION（CMake 选项同名）：关闭时下列宏展开为空，
+ *   不产生任何代码；开启时每次计数只是对本线程计数块的一次 relaxed 读改写（无锁、无共享缓存行）
+ * - 每个线程首次计数时登记自己的计数块，线程退出时并入全局累计值；
+ *   snapshot() 汇总已退出线程与所有活动线程，并发计数期间读到的是近似值，静止时精确
+ * - 开启时库内替换全局 operator new / delete，统计分配次数、字节数与释放次数
+ *
+ *   GEOALGO_COUNT(Counter::X)          计数 +1
+ *   GEOALGO_COUNT_N(Counter::X, n)     计数 +n
+ *   GEOALGO_SCOPED_TIMER(Timer::X)     当前作用域计时（调用次数与累计纳秒）
+ */
+
+namespace GeoAlgo {
+namespace instrumentation {
+
+enum class Counter : int {
+    BezierEvaluations = 0,   // BezierCurve 求值点数（含批量）
+    PowerBasisEvaluations,   // 幂基分量多项式求值次数，每个参数的每个分量计一次（标量 Horner 与 SIMD 内核）
+    RationalEvaluations,     // RationalBezierCurve 求值点数
+    NURBSEvaluations,        // NURBS 求值点数（含导数）
+    NURBSBasisComputations,  // B 样条基函数（含导数）计算次数
+    DerivativeConstructions, // 导数曲线对象构造次数（PowerBasisCurve1D::derivative、BezierCurve::hodograph）
+    TessellatedCurves,       // 自适应离散的曲线数
+    TessellationPoints,      // 自适应离散输出的点数
+    BasisConversions,        // Bezier ↔ 幂基转换的曲线数
+    KnotInsertions,          // 插入的节点数（insertKnot / refineKnots）
+    BezierDecompositions,    // 分解为 Bezier 段的 NURBS 曲线数
+    Allocations,             // operator new 次数
+    AllocatedBytes,          // operator new 请求的字节数
+    Deallocations,           // operator delete 次数
+    Count
+};
+
+enum class Timer : int {
+    BatchEvaluation = 0, // CurveBatch::evaluate / forEachRange
+    Tessellation,        // AdaptiveTessellator::tessellate
+    BasisConversion,     // 批量基转换
+    BezierDecomposition, // BezierSegments 构造
+    Intersection,        // CurveIntersector::intersectAll
+    ArcLengthBuild,      // ArcLengthTable 构造
+    Count
+};
+
+constexpr int kNumCounters = static_cast<int>(Counter::Count);
+constexpr int kNumTimers = static_cast<int>(Timer::Count);
+
+#ifdef GEOALGO_ENABLE_INSTRUMENTATION
+constexpr bool kEnabled = true;
+#else
+constexpr bool kEnabled = false;
+#endif
+
+const char* counterName(Counter c);
+const char* timerName(Timer t);
+
+// 库本身编译时是否开启了插桩（与包含本头文件的翻译单元无关）
+bool libraryInstrumented();
+
+struct TimerStats {
+    std::uint64_t calls = 0;
+    std::uint64_t nanoseconds = 0;
+};
+
+/**
+ * 某一时刻所有线程的计数汇总
+ */
+struct Snapshot {
+    std::uint64_t counters[kNumCounters] = {};
+    TimerStats timers[kNumTimers] = {};
+
+    std::uint64_t counter(Counter c) const { return counters[static_cast<int>(c)]; }
+    const TimerStats& timer(Timer t) const { return timers[static_cast<int>(t)]; }
+
+    // 逐项相减，用于统计一段任务的增量
+    Snapshot operator-(const Snapshot& base) const;
+
+    // 每行 "name value"，计时器为 "name calls ns"；JSON 为 {"counters": {...}, "timers": {...}}
+    std::string toText() const;
+    std::string toJson() const;
+};
+
+Snapshot snapshot();
+
+// 清零全局累计值与所有活动线程的计数块
+void reset();
+
+namespace detail {
+
+// 单线程写、其他线程只读：relaxed 读改写即可，不需要原子加
+struct ThreadBlock {
+    std::atomic<std::uint64_t> counters[kNumCounters];
+    std::atomic<std::uint64_t> timerCalls[kNumTimers];
+    std::atomic<std::uint64_t> timerNanos[kNumTimers];
+};
+
+ThreadBlock* registerThread();
+
+inline thread_local ThreadBlock* tlsBlock = nullptr;
+
+inline ThreadBlock& block() {
+    ThreadBlock* b = tlsBlock;
+    return b ? *b : *registerThread();
+}
+
+inline void bump(std::atomic<std::uint64_t>& a, std::uint64_t n) {
+    a.store(a.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+inline void count(Counter c, std::uint64_t n = 1) {
+    detail::bump(detail::block().counters[static_cast<int>(c)], n);
+}
+
+/**
+ * 作用域计时器：析构时累加调用次数与经过的纳秒数
+ */
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Timer t) : timer_(static_cast<int>(t)), start_(std::chrono::steady_clock::now()) {}
+    ~ScopedTimer() {
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start_).count();
+        detail::ThreadBlock& b = detail::block();
+        detail::bump(b.timerCalls[timer_], 1);
+        detail::bump(b.timerNanos[timer_], static_cast<std::uint64_t>(ns));
+    }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    int timer_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace instrumentation
+} // namespace GeoAlgo
+
+#define GEOALGO_INSTR_CONCAT_(a, b) a##b
+#define GEOALGO_INSTR_CONCAT(a, b) GEOALGO_INSTR_CONCAT_(a, b)
+
+#ifdef GEOALGO_ENABLE_INSTRUMENTATION
+#define GEOALGO_COUNT(c) ::GeoAlgo::instrumentation::count(::GeoAlgo::instrumentation::c)
+#define GEOALGO_COUNT_N(c, n) \
+    ::GeoAlgo::instrumentation::count(::GeoAlgo::instrumentation::c, static_cast<std::uint64_t>(n))
+#define GEOALGO_SCOPED_TIMER(t) \
+    ::GeoAlgo::instrumentation::ScopedTimer GEOALGO_INSTR_CONCAT(geoalgoTimer_, __LINE__)(::GeoAlgo::instrumentation::t)
+#else
+#define GEOALGO_COUNT(c) ((void)0)
+#define GEOALGO_COUNT_N(c, n) ((void)0)
+#define GEOALGO_SCOPED_TIMER(t) ((void)0)
+#endif
+
+#endif // GEOALGO_INSTRUMENTATION_H
@@ -1,17 +1,149 @@
 #pragma once
+#include "Point2D.h"
+#include "Vec.h"
+#include <cstddef>
 #include <vector>
 
 namespace GeoAlgo {
 
+/**
+ * 非均匀有理 B 样条曲线（NURBS）
+ * 定义：C(u) = Σ N_{i,p}(u) w_i P_i / Σ N_{i,p}(u) w_i
+ *
+ * - 控制点以 Vec4d 齐次坐标 (w*x, w*y, w*z, w) 存放，不足三维的分量为 0，
+ *   二维、三维与一维曲线共用同一条四分量乘加路径
+ * - 节点区间查找为二分 O(log n)
+ * - 每次只计算 p+1 个非零基函数（Cox–de Boor 三角递推），使用栈上缓冲区，不分配内存
+ * - 参数超出 [u_p, u_{n+1}] 时截断到定义域端点
+ */
 class NURBS {
 public:
+    static constexpr int kMaxDegree = 15;
+    static constexpr int kMaxDim = 3;
+
+    // 兼容旧接口：一维控制值，clamped 均匀节点，权重全为 1
     NURBS(const std::vector<double>& controlPoints, int degree);
 
+    // 一般形式：controlPoints 为 n 个 dim 维点按点连续存放，knots 长度为 n+p+1，
+    // weights 为空时权重全为 1
+    NURBS(int degree, int dim,
+          const std::vector<double>& controlPoints,
+          const std::vector<double>& knots,
+          const std::vector<double>& weights = {});
+
+    // 二维控制点
+    NURBS(int degree,
+          const std::vector<Point2D>& controlPoints,
+          const std::vector<double>& knots,
+          const std::vector<double>& weights = {});
+
+    // clamped 均匀节点向量：首尾各 p+1 重，内部等距
+    static std::vector<double> clampedUniformKnots(int numControlPoints, int degree);
+
+    int degree() const { return degree_; }
+    int dimension() const { return dim_; }
+    int numControlPoints() const { return static_cast<int>(Pw_.size()); }
+    const std::vector<double>& knots() const { return knots_; }
+    // 齐次控制点 (w*x, w*y, w*z, w)
+    const std::vector<Vec4d>& homogeneousPoints() const { return Pw_; }
+
+    // 定义域 [u_p, u_{n+1}]
+    double firstParam() const { return knots_[degree_]; }
+    double lastParam() const { return knots_[numControlPoints()]; }
+
+    // 第一个分量的值（一维曲线即曲线值）
     double evaluate(double u) const;
 
+    // 写出 dim 个分量到 out
+    void evaluate(double u, double* out) const;
+
+    // 齐次坐标下的曲线点 Σ N_i w_i P_i
+    Vec4d evaluateHomogeneous(double u) const;
+
+    // 二维 / 三维曲线点（缺少的分量为 0）
+    Point2D evaluatePoint(double u) const;
+    Vec3d evaluatePoint3D(double u) const;
+
+    /**
+     * 批量求值：out 按点连续存放，共 count*dim 个值
+     * 参数非降序时区间沿节点向量逐步推进，乱序时退回二分查找
+     */
+    void evaluateMany(const double* us, std::size_t count, double* out) const;
+
+    // 满足 u_span <= u < u_{span+1} 的区间下标，取值范围 [p, n]
+    int findSpan(double u) const;
+
+    // 区间 span 上 p+1 个非零基函数 N_{span-p,p}(u) .. N_{span,p}(u)，写入 N[0..p]
+    void basisFunctions(int span, double u, double* N) const;
+
+    // 只依赖节点向量的版本，供共享节点的采样计划等使用（n+1 = knots.size()-degree-1）
+    static int findSpan(const std::vector<double>& knots, int degree, double u);
+    static void basisFunctions(const std::vector<double>& knots, int degree, int span, double u, double* N);
+    // 节点为外部数组（如内存映射文件）的版本
+    static int findSpan(const double* knots, int numKnots, int degree, double u);
+    static void basisFunctions(const double* knots, int degree, int span, double u, double* N);
+
+    /**
+     * 非零基函数及其 0..n 阶导数（NURBS Book A2.3），n <= degree
+     * ders[k*(degree+1) + j] = N^(k)_{span-degree+j, degree}(u)
+     */
+    static void basisFunctionDerivatives(const std::vector<double>& knots, int degree, int span,
+                                         double u, int n, double* ders);
+
+    /**
+     * 曲线的 0..k 阶导数，k <= kMaxDegree，只做一次基函数（含导数）计算
+     * 齐次坐标导数 A^(k), w^(k) 求出后按 NURBS Book A4.2 还原有理曲线导数：
+     *   C^(k) = (A^(k) - Σ_{i=1..k} C(k,i) w^(i) C^(k-i)) / w
+     */
+    void evaluateDerivatives(double u, int k, Vec3d* out) const;
+    void evaluateDerivatives(double u, int k, Point2D* out) const;
+
+    // 批量：out[i*(k+1) + j] = C^(j)(us[i])，非降序参数逐段推进区间
+    void evaluateDerivativesMany(const double* us, std::size_t count, int k, Vec3d* out) const;
+
+    /**
+     * 节点插入（Boehm，NURBS Book A5.1）：把 u 插入 times 次，曲线形状与参数化不变
+     * u 须在定义域内，插入后重数不得超过 p
+     */
+    NURBS insertKnot(double u, int times = 1) const;
+
+    /**
+     * 节点细化（NURBS Book A5.4）：一次插入非降序节点序列 X，
+     * 从右向左逐个插入并就地更新，总代价 O((n + |X|) * p)；重数限制同 insertKnot
+     */
+    NURBS refineKnots(const std::vector<double>& X) const;
+
+    // 两端节点补足到 p+1 重并去掉定义域外的节点与控制点，定义域与曲线形状不变
+    NURBS clamped() const;
+
+    // 定义域内非零长度的节点区间数，即 Bezier 段数
+    int numBezierSegments() const;
+
+    /**
+     * Bezier 分解（NURBS Book A5.6）：依次把内部节点插入到 p 重
+     *   points : numBezierSegments()*(p+1) 个齐次控制点，按段连续
+     *   breaks : 非空时写入 numBezierSegments()+1 个段端点参数
+     * 非 clamped 节点向量先转为 clamped 形式
+     */
+    void decomposeToBezier(Vec4d* points, double* breaks = nullptr) const;
+
 private:
-    std::vector<double> controlPoints_;
+    struct HomogeneousTag {};
+    // 直接接管齐次控制点，供节点插入等内部构造使用（不再校验）
+    NURBS(int degree, int dim, std::vector<double> knots, std::vector<Vec4d> Pw, HomogeneousTag);
+
+    bool isClamped() const;
+    void initHomogeneous(const double* points, std::size_t count, const std::vector<double>& weights);
+    double clampParam(double u) const;
+    // 从上一个区间出发查找 u 所在区间，适用于非降序参数序列
+    int advanceSpan(int span, double u) const;
+    Vec4d homogeneousInSpan(int span, double u) const;
+    void derivativesInSpan(int span, double u, int k, Vec3d* out) const;
+
     int degree_;
+    int dim_;
+    std::vector<double> knots_;
+    std::vector<Vec4d> Pw_;
 };
 
 } // namespace GeoAlgo
@@ -16,6 +16,9 @@ public:
     explicit PowerBasisCurve(const std::vector<Point2D>& coefficients)
         : coeffs(coefficients) {}
 
+    int degree() const { return static_cast<int>(coeffs.size()) - 1; }
+    const std::vector<Point2D>& coefficients() const { return coeffs; }
+
     // 计算曲线在参数 u 处的点
     Point2D evaluate(double u) const;
 
@@ -1,6 +1,8 @@
 #ifndef POWER_BASIS_CURVE_1D_H
 #define POWER_BASIS_CURVE_1D_H
 
+#include "Instrumentation.h"
+#include "PowerBasisKernel.h"
 #include <vector>
 #include <iostream>
 #include <initializer_list>
@@ -12,7 +14,10 @@
  - coefficients stored from low power to high power:
    coeffs_[i] corresponds to a_i * t^i
  - evaluate(t) uses Horner algorithm
+ - evaluateMany(ts, count, out) runs the SIMD Horner kernel over a parameter array
  - derivative() returns a PowerBasisCurve1D object for f'(t)
+ - evaluateDerivatives(t, k, out) returns f, f', ..., f^(k) in one extended-Horner
+   pass without allocating; evaluateDerivative/evaluateSecondDerivative use it
 */
 class PowerBasisCurve1D {
 public:
@@ -31,6 +36,7 @@ public:
 
     // Horner algorithm for polynomial evaluation
     double evaluate(double t) const {
+        GEOALGO_COUNT(Counter::PowerBasisEvaluations);
         if (coeffs_.empty()) return 0.0;
         // Horner from highest to lowest
         double result = 0.0;
@@ -40,8 +46,15 @@ public:
         return result;
     }
 
+    // Batch Horner over ts[0..count) into out[0..count), vectorized with runtime dispatch
+    void evaluateMany(const double* ts, std::size_t count, double* out) const {
+        GeoAlgo::evaluatePowerBasisSoA(coeffs_.data(), 1, static_cast<int>(coeffs_.size()),
+                                       ts, count, &out);
+    }
+
     // build derivative polynomial coefficients and return new curve
     PowerBasisCurve1D derivative() const {
+        GEOALGO_COUNT(Counter::DerivativeConstructions);
         int n = static_cast<int>(coeffs_.size());
         if (n <= 1) {
             return PowerBasisCurve1D(std::vector<double>{0.0});
@@ -55,13 +68,31 @@ public:
         return derivative().derivative();
     }
 
-    // Evaluate derivative at t (efficiently): form derivative polynomial and Horner-eval it
+    // out[j] = f^(j)(t) for j = 0..k
+    void evaluateDerivatives(double t, int k, double* out) const {
+        GEOALGO_COUNT(Counter::PowerBasisEvaluations);
+        GeoAlgo::hornerDerivatives(
+            [this](int i) { return coeffs_[i]; }, degree(), t, k, out);
+    }
+
+    // Batch: outs[j][i] = f^(j)(ts[i]) for j = 0..k, vectorized over ts
+    // 系数个数超过 kDerivativeTableCapacity 时须提供 scratch（powerBasisDerivativeTableSize 个 double）
+    void evaluateDerivativesMany(const double* ts, std::size_t count, int k, double* const* outs,
+                                 double* scratch = nullptr) const {
+        GeoAlgo::evaluatePowerBasisDerivativesSoA(coeffs_.data(), 1, static_cast<int>(coeffs_.size()),
+                                                  k, ts, count, outs, scratch);
+    }
+
     double evaluateDerivative(double t) const {
-        return derivative().evaluate(t);
+        double d[2];
+        evaluateDerivatives(t, 1, d);
+        return d[1];
     }
 
     double evaluateSecondDerivative(double t) const {
-        return secondDerivative().evaluate(t);
+        double d[3];
+        evaluateDerivatives(t, 2, d);
+        return d[2];
     }
 
     void print(std::ostream& os = std::cout) const {
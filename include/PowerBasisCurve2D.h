@@ -2,15 +2,19 @@
 #define POWER_BASIS_CURVE_2D_H
 
 #include "PowerBasisCurve1D.h"
-#include <utility>
+#include "Vec.h"
+#include <algorithm>
 
 /*
  PowerBasisCurve2D
  - Parametric curve (x(t), y(t))
  - Internally holds two PowerBasisCurve1D for x and y components.
- - evaluate(t) -> std::pair<double,double>
+ - evaluate(t) -> GeoAlgo::Vec2d
+ - evaluateMany(ts, count, xs, ys) evaluates both components in one SIMD pass
+   into SoA output buffers
  - derivative(t) gives first derivative (dx/dt, dy/dt)
  - secondDerivative(t) gives second derivative (d2x/dt2, d2y/dt2)
+ - evaluateDerivatives(t, k, out) gives position and derivatives up to order k in one pass
 */
 class PowerBasisCurve2D {
 public:
@@ -18,27 +22,55 @@ public:
 
     // Construct from two coefficient vectors: x_coeffs, y_coeffs
     PowerBasisCurve2D(const std::vector<double>& x_coeffs, const std::vector<double>& y_coeffs)
-        : x_(x_coeffs), y_(y_coeffs) {}
+        : x_(x_coeffs), y_(y_coeffs) { pack(); }
 
     // Construct from initializer lists
     PowerBasisCurve2D(std::initializer_list<double> x_coeffs, std::initializer_list<double> y_coeffs)
-        : x_(x_coeffs), y_(y_coeffs) {}
+        : x_(x_coeffs), y_(y_coeffs) { pack(); }
 
     // Evaluate point (x(t), y(t))
-    std::pair<double,double> evaluate(double t) const {
+    GeoAlgo::Vec2d evaluate(double t) const {
         return { x_.evaluate(t), y_.evaluate(t) };
     }
 
+    // Batch evaluate ts[0..count) into xs[0..count), ys[0..count)
+    void evaluateMany(const double* ts, std::size_t count, double* xs, double* ys) const {
+        double* outs[2] = { xs, ys };
+        GeoAlgo::evaluatePowerBasisSoA(packed_.data(), 2, order_, ts, count, outs);
+    }
+
+    // out[j] = j-th derivative at t for j = 0..k, both components in one extended-Horner pass
+    void evaluateDerivatives(double t, int k, GeoAlgo::Vec2d* out) const {
+        GEOALGO_COUNT_N(Counter::PowerBasisEvaluations, 2);
+        GeoAlgo::hornerDerivatives(
+            [this](int i) { return GeoAlgo::Vec2d(packed_[i], packed_[order_ + i]); },
+            order_ - 1, t, k, out);
+    }
+
+    // Batch: outs[2*j + d][i] = j-th derivative of component d at ts[i], j = 0..k
+    // 系数个数超过 kDerivativeTableCapacity 时须提供 scratch（powerBasisDerivativeTableSize 个 double）
+    void evaluateDerivativesMany(const double* ts, std::size_t count, int k, double* const* outs,
+                                 double* scratch = nullptr) const {
+        GeoAlgo::evaluatePowerBasisDerivativesSoA(packed_.data(), 2, order_, k, ts, count, outs, scratch);
+    }
+
     // First derivative (dx/dt, dy/dt)
-    std::pair<double,double> derivative(double t) const {
-        return { x_.evaluateDerivative(t), y_.evaluateDerivative(t) };
+    GeoAlgo::Vec2d derivative(double t) const {
+        GeoAlgo::Vec2d d[2];
+        evaluateDerivatives(t, 1, d);
+        return d[1];
     }
 
     // Second derivative (d2x/dt2, d2y/dt2)
-    std::pair<double,double> secondDerivative(double t) const {
-        return { x_.evaluateSecondDerivative(t), y_.evaluateSecondDerivative(t) };
+    GeoAlgo::Vec2d secondDerivative(double t) const {
+        GeoAlgo::Vec2d d[3];
+        evaluateDerivatives(t, 2, d);
+        return d[2];
     }
 
+    // Highest degree over all components
+    int degree() const { return order_ - 1; }
+
     // Access sub-curves
     const PowerBasisCurve1D& xCurve() const { return x_; }
     const PowerBasisCurve1D& yCurve() const { return y_; }
@@ -49,8 +81,20 @@ public:
     }
 
 private:
+    // Copy both coefficient sets into one zero-padded block for the batch kernel
+    void pack() {
+        const auto& xc = x_.coefficients();
+        const auto& yc = y_.coefficients();
+        order_ = static_cast<int>(std::max(xc.size(), yc.size()));
+        packed_.assign(2 * static_cast<std::size_t>(order_), 0.0);
+        std::copy(xc.begin(), xc.end(), packed_.begin());
+        std::copy(yc.begin(), yc.end(), packed_.begin() + order_);
+    }
+
     PowerBasisCurve1D x_;
     PowerBasisCurve1D y_;
+    std::vector<double> packed_;
+    int order_ = 0;
 };
 
 #endif // POWER_BASIS_CURVE_2D_H
@@ -2,12 +2,17 @@
 #define POWER_BASIS_CURVE_3D_H
 
 #include "PowerBasisCurve1D.h"
-#include <tuple>
+#include "Vec.h"
+#include <algorithm>
 
 /*
  PowerBasisCurve3D
  - Parametric curve (x(t), y(t), z(t))
  - Internally holds three PowerBasisCurve1D for x,y,z components.
+ - evaluate(t) -> GeoAlgo::Vec3d
+ - evaluateDerivatives(t, k, out) gives position and derivatives up to order k in one pass
+ - evaluateMany(ts, count, xs, ys, zs) evaluates all components in one SIMD pass
+   into SoA output buffers
 */
 class PowerBasisCurve3D {
 public:
@@ -16,26 +21,51 @@ public:
     PowerBasisCurve3D(const std::vector<double>& x_coeffs,
                       const std::vector<double>& y_coeffs,
                       const std::vector<double>& z_coeffs)
-        : x_(x_coeffs), y_(y_coeffs), z_(z_coeffs) {}
+        : x_(x_coeffs), y_(y_coeffs), z_(z_coeffs) { pack(); }
 
     PowerBasisCurve3D(std::initializer_list<double> x_coeffs,
                       std::initializer_list<double> y_coeffs,
                       std::initializer_list<double> z_coeffs)
-        : x_(x_coeffs), y_(y_coeffs), z_(z_coeffs) {}
+        : x_(x_coeffs), y_(y_coeffs), z_(z_coeffs) { pack(); }
 
     // Evaluate point (x,y,z)
-    std::tuple<double,double,double> evaluate(double t) const {
+    GeoAlgo::Vec3d evaluate(double t) const {
         return { x_.evaluate(t), y_.evaluate(t), z_.evaluate(t) };
     }
 
+    // Batch evaluate ts[0..count) into xs, ys, zs
+    void evaluateMany(const double* ts, std::size_t count, double* xs, double* ys, double* zs) const {
+        double* outs[3] = { xs, ys, zs };
+        GeoAlgo::evaluatePowerBasisSoA(packed_.data(), 3, order_, ts, count, outs);
+    }
+
+    // out[j] = j-th derivative at t for j = 0..k, all components in one extended-Horner pass
+    void evaluateDerivatives(double t, int k, GeoAlgo::Vec3d* out) const {
+        GEOALGO_COUNT_N(Counter::PowerBasisEvaluations, 3);
+        GeoAlgo::hornerDerivatives(
+            [this](int i) { return GeoAlgo::Vec3d(packed_[i], packed_[order_ + i], packed_[2 * order_ + i]); },
+            order_ - 1, t, k, out);
+    }
+
+    // Batch: outs[3*j + d][i] = j-th derivative of component d at ts[i], j = 0..k
+    // 系数个数超过 kDerivativeTableCapacity 时须提供 scratch（powerBasisDerivativeTableSize 个 double）
+    void evaluateDerivativesMany(const double* ts, std::size_t count, int k, double* const* outs,
+                                 double* scratch = nullptr) const {
+        GeoAlgo::evaluatePowerBasisDerivativesSoA(packed_.data(), 3, order_, k, ts, count, outs, scratch);
+    }
+
     // First derivative (dx/dt, dy/dt, dz/dt)
-    std::tuple<double,double,double> derivative(double t) const {
-        return { x_.evaluateDerivative(t), y_.evaluateDerivative(t), z_.evaluateDerivative(t) };
+    GeoAlgo::Vec3d derivative(double t) const {
+        GeoAlgo::Vec3d d[2];
+        evaluateDerivatives(t, 1, d);
+        return d[1];
     }
 
     // Second derivative (d2x/dt2, d2y/dt2, d2z/dt2)
-    std::tuple<double,double,double> secondDerivative(double t) const {
-        return { x_.evaluateSecondDerivative(t), y_.evaluateSecondDerivative(t), z_.evaluateSecondDerivative(t) };
+    GeoAlgo::Vec3d secondDerivative(double t) const {
+        GeoAlgo::Vec3d d[3];
+        evaluateDerivatives(t, 2, d);
+        return d[2];
     }
 
     void print(std::ostream& os = std::cout) const {
@@ -44,14 +74,29 @@ public:
         os << "z(t): "; z_.print(os);
     }
 
+    // Highest degree over all components
+    int degree() const { return order_ - 1; }
+
     const PowerBasisCurve1D& xCurve() const { return x_; }
     const PowerBasisCurve1D& yCurve() const { return y_; }
     const PowerBasisCurve1D& zCurve() const { return z_; }
 
 private:
+    // Copy all coefficient sets into one zero-padded block for the batch kernel
+    void pack() {
+        const std::vector<double>* comps[3] = { &x_.coefficients(), &y_.coefficients(), &z_.coefficients() };
+        order_ = 0;
+        for (auto* c : comps) order_ = std::max(order_, static_cast<int>(c->size()));
+        packed_.assign(3 * static_cast<std::size_t>(order_), 0.0);
+        for (int d = 0; d < 3; ++d)
+            std::copy(comps[d]->begin(), comps[d]->end(), packed_.begin() + d * order_);
+    }
+
     PowerBasisCurve1D x_;
     PowerBasisCurve1D y_;
     PowerBasisCurve1D z_;
+    std::vector<double> packed_;
+    int order_ = 0;
 };
 
 #endif // POWER_BASIS_CURVE_3D_H
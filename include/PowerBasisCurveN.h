@@ -0,0 +1,113 @@
+#ifndef GEOALGO_POWER_BASIS_CURVE_N_H
+#define GEOALGO_POWER_BASIS_CURVE_N_H
+
+#include "PowerBasisCurve.h"
+#include "PowerBasisCurve1D.h"
+#include "PowerBasisCurve2D.h"
+#include "PowerBasisCurve3D.h"
+#include "Vec.h"
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace GeoAlgo {
+
+/**
+ * 定次数、定维数的幂基曲线 PowerBasisCurveN<Degree, Dim>
+ * 形如：P(u) = a0 + a1*u + ... + an*u^n，a_i 为 Vec<double, Dim>
+ * - 系数存放在 std::array 中，Horner 递推按次数与维数完全展开，可在常量表达式中求值
+ * - 可由 PowerBasisCurve1D (Dim=1)、PowerBasisCurve / PowerBasisCurve2D (Dim=2)、
+ *   PowerBasisCurve3D (Dim=3) 构造；动态曲线次数低于 Degree 时高次系数补零，高于时抛出异常
+ */
+template <int Degree, int Dim = 2>
+class PowerBasisCurveN {
+    static_assert(Degree >= 0, "PowerBasisCurveN: Degree must be non-negative");
+    static_assert(Dim >= 1, "PowerBasisCurveN: Dim must be positive");
+
+public:
+    using Point = Vec<double, Dim>;
+    using Coefficients = std::array<Point, Degree + 1>;
+
+    static constexpr int kDegree = Degree;
+    static constexpr int kDim = Dim;
+
+    constexpr PowerBasisCurveN() : coeffs_{} {}
+    constexpr explicit PowerBasisCurveN(const Coefficients& coefficients) : coeffs_(coefficients) {}
+
+    explicit PowerBasisCurveN(const PowerBasisCurve1D& curve) : coeffs_{} {
+        static_assert(Dim == 1, "PowerBasisCurveN: PowerBasisCurve1D requires Dim == 1");
+        setComponent(0, curve.coefficients());
+    }
+
+    explicit PowerBasisCurveN(const PowerBasisCurve& curve) : coeffs_{} {
+        static_assert(Dim == 2, "PowerBasisCurveN: PowerBasisCurve requires Dim == 2");
+        const auto& c = curve.coefficients();
+        if (static_cast<int>(c.size()) > Degree + 1)
+            throw std::invalid_argument("PowerBasisCurveN: source degree exceeds Degree");
+        for (std::size_t i = 0; i < c.size(); ++i) coeffs_[i] = c[i];
+    }
+
+    explicit PowerBasisCurveN(const PowerBasisCurve2D& curve) : coeffs_{} {
+        static_assert(Dim == 2, "PowerBasisCurveN: PowerBasisCurve2D requires Dim == 2");
+        setComponent(0, curve.xCurve().coefficients());
+        setComponent(1, curve.yCurve().coefficients());
+    }
+
+    explicit PowerBasisCurveN(const PowerBasisCurve3D& curve) : coeffs_{} {
+        static_assert(Dim == 3, "PowerBasisCurveN: PowerBasisCurve3D requires Dim == 3");
+        setComponent(0, curve.xCurve().coefficients());
+        setComponent(1, curve.yCurve().coefficients());
+        setComponent(2, curve.zCurve().coefficients());
+    }
+
+    constexpr int degree() const { return Degree; }
+    constexpr const Coefficients& coefficients() const { return coeffs_; }
+
+    // Horner：r = a_n;  r = r*u + a_i  (i = n-1..0)
+    constexpr Point evaluate(double u) const {
+        return horner(u, std::make_index_sequence<Degree>{});
+    }
+
+    void evaluateMany(const double* us, std::size_t count, Point* out) const {
+        for (std::size_t k = 0; k < count; ++k) out[k] = evaluate(us[k]);
+    }
+
+    // 第 d 个分量的一维幂基曲线
+    PowerBasisCurve1D component(int d) const {
+        std::vector<double> c(Degree + 1);
+        for (int i = 0; i <= Degree; ++i) c[i] = coeffs_[i][d];
+        return PowerBasisCurve1D(c);
+    }
+
+    // 转为二维动态 PowerBasisCurve
+    PowerBasisCurve toDynamic() const {
+        static_assert(Dim == 2, "PowerBasisCurveN::toDynamic requires Dim == 2");
+        return PowerBasisCurve(std::vector<Point2D>(coeffs_.begin(), coeffs_.end()));
+    }
+
+private:
+    template <std::size_t... I>
+    constexpr Point horner(double u, std::index_sequence<I...>) const {
+        Point r = coeffs_[Degree];
+        ((r = axpy(r, u, coeffs_[Degree - 1 - I])), ...);
+        return r;
+    }
+
+    void setComponent(int d, const std::vector<double>& c) {
+        if (static_cast<int>(c.size()) > Degree + 1)
+            throw std::invalid_argument("PowerBasisCurveN: source degree exceeds Degree");
+        for (std::size_t i = 0; i < c.size(); ++i) coeffs_[i][d] = c[i];
+    }
+
+    Coefficients coeffs_;
+};
+
+using QuadraticPowerBasis2D = PowerBasisCurveN<2, 2>;
+using CubicPowerBasis2D = PowerBasisCurveN<3, 2>;
+using QuadraticPowerBasis3D = PowerBasisCurveN<2, 3>;
+using CubicPowerBasis3D = PowerBasisCurveN<3, 3>;
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_POWER_BASIS_CURVE_N_H
@@ -0,0 +1,89 @@
+#ifndef GEOALGO_POWER_BASIS_KERNEL_H
+#define GEOALGO_POWER_BASIS_KERNEL_H
+
+#include <algorithm>
+#include <cstddef>
+
+namespace GeoAlgo {
+
+/**
+ * 向量指令集等级，运行时按 CPU 支持情况选择
+ */
+enum class SimdLevel {
+    Scalar = 0,
+    SSE2   = 1,
+    AVX2   = 2,
+    AVX512 = 3
+};
+
+// 当前 CPU 支持的最高等级（首次调用时检测并缓存）
+SimdLevel detectSimdLevel();
+
+const char* simdLevelName(SimdLevel level);
+
+/**
+ * 幂基多项式批量求值内核（SoA 输出）
+ *   coeffs : dim 个分量的系数，按分量连续存放，每个分量 order 个系数（低次到高次）
+ *            即 coeffs[d * order + i] 为第 d 个分量 t^i 的系数
+ *   ts     : count 个参数
+ *   outs   : dim 个输出数组，outs[d][k] = Σ_i coeffs[d*order + i] * ts[k]^i
+ *
+ * 所有分量在同一遍 Horner 循环中完成，每次处理一个向量宽度的参数。
+ * 指令集按 detectSimdLevel() 选择，不分配内存。
+ * 不足一个向量宽度的尾部补齐后同样走向量路径，因此同一参数的结果与其在数组中的位置无关，
+ * 分块并行求值时输出逐位一致。
+ */
+void evaluatePowerBasisSoA(const double* coeffs, int dim, int order,
+                           const double* ts, std::size_t count, double* const* outs);
+
+// 指定指令集等级（超出 CPU 支持时降级），用于测试与基准
+void evaluatePowerBasisSoA(const double* coeffs, int dim, int order,
+                           const double* ts, std::size_t count, double* const* outs,
+                           SimdLevel level);
+
+// 导数系数表的栈上容量（double 个数）
+constexpr std::size_t kDerivativeTableCapacity = 512;
+
+// 导数系数表所需的 double 个数：高于 order-1 阶的导数恒为零，不占用表
+inline std::size_t powerBasisDerivativeTableSize(int dim, int order, int maxOrder) {
+    if (dim <= 0 || order <= 0 || maxOrder < 0) return 0;
+    return static_cast<std::size_t>(std::min(maxOrder, order - 1) + 1) * dim * order;
+}
+
+/**
+ * 幂基多项式及其各阶导数的批量求值（SoA 输出）
+ *   outs[j*dim + d][k] = 第 d 个分量的 j 阶导数在 ts[k] 处的值，j = 0..maxOrder
+ * 各阶导数系数在调用开始时一次算出，随后各多项式共用同一 SIMD 内核；高于次数的导数直接写零。
+ * 系数表放在 scratch 中（至少 powerBasisDerivativeTableSize 个 double）；scratch 为空时使用
+ * kDerivativeTableCapacity 大小的栈缓冲区，整张表放不下时按导数分批求值（对点数没有限制），
+ * 只有 order 本身超过 kDerivativeTableCapacity 时才须提供 scratch，否则抛出 std::invalid_argument。
+ * 不分配内存。
+ */
+void evaluatePowerBasisDerivativesSoA(const double* coeffs, int dim, int order, int maxOrder,
+                                      const double* ts, std::size_t count, double* const* outs,
+                                      double* scratch = nullptr);
+
+/**
+ * 扩展 Horner：一次递推同时得到 f(t), f'(t), ..., f^(k)(t)，写入 out[0..k]
+ * coeff(i) 返回 t^i 的系数（double 或 Vec），复杂度 O(n*k)，不分配内存
+ */
+template <typename T, typename Coeff>
+inline void hornerDerivatives(Coeff coeff, int degree, double t, int k, T* out) {
+    for (int j = 0; j <= k; ++j) out[j] = T{};
+    if (degree < 0) return;
+    out[0] = coeff(degree);
+    for (int i = degree - 1; i >= 0; --i) {
+        for (int j = std::min(k, degree - i); j >= 1; --j) out[j] = out[j] * t + out[j - 1];
+        out[0] = out[0] * t + coeff(i);
+    }
+    // out[j] 此时为 f^(j)(t) / j!
+    double fact = 1.0;
+    for (int j = 2; j <= k; ++j) {
+        fact *= j;
+        out[j] = out[j] * fact;
+    }
+}
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_POWER_BASIS_KERNEL_H
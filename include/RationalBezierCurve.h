@@ -0,0 +1,71 @@
+#ifndef GEOALGO_RATIONAL_BEZIER_CURVE_H
+#define GEOALGO_RATIONAL_BEZIER_CURVE_H
+
+#include "Point2D.h"
+#include <cstddef>
+#include <vector>
+
+namespace GeoAlgo {
+
+/**
+ * 有理贝塞尔曲线（Rational Bezier Curve），二维或三维
+ * 定义：C(u) = Σ B_i^n(u) w_i P_i / Σ B_i^n(u) w_i
+ *
+ * 控制点以齐次坐标 H_i = (w_i P_i, w_i) 连续存放，求值在齐次空间中完成：
+ * 分子与分母共用一次 Bernstein–Horner 递推（同 BezierCurve），最后只做一次除法。
+ *
+ * 批量求值：次数不超过 kMaxPowerDegree 时，构造时把齐次控制点转换为幂基系数
+ * （BasisConversion.h），按块调用 SIMD Horner 内核得到各齐次分量，再逐点除以权重；
+ * 更高次数保留 Bernstein 递推，避免幂基的数值误差。
+ */
+class RationalBezierCurve {
+public:
+    // 超过该次数时批量求值不使用幂基（误差见 BasisConversion.h）
+    static constexpr int kMaxPowerDegree = 10;
+
+    RationalBezierCurve() = default;
+    // 权重须为正，数量与控制点一致
+    RationalBezierCurve(const std::vector<Point2D>& controlPoints, const std::vector<double>& weights);
+    RationalBezierCurve(const std::vector<Vec3d>& controlPoints, const std::vector<double>& weights);
+
+    // 次数 n = 控制点数 - 1，空曲线返回 -1
+    int degree() const { return static_cast<int>(homogeneous.size()) - 1; }
+    // 2 或 3，空曲线为 0
+    int dimension() const { return dim; }
+
+    // 齐次控制点 (w*x, w*y, w*z, w)，二维曲线 z 分量为 0
+    const std::vector<Vec4d>& homogeneousPoints() const { return homogeneous; }
+    double weight(int i) const { return homogeneous[i].w; }
+    Vec3d controlPoint(int i) const { return fromHomogeneous<3>(homogeneous[i]); }
+
+    // 齐次坐标下的曲线点 Σ B_i^n(u) H_i
+    Vec4d evaluateHomogeneous(double u) const;
+
+    // 曲线点（二维曲线的 evaluate3D z 分量为 0）
+    Point2D evaluate(double u) const;
+    Vec3d evaluate3D(double u) const;
+
+    // 一阶导数：C' = (A' - w' C) / w，A 与 w 为齐次分子与分母
+    Point2D derivative(double u) const;
+    Vec3d derivative3D(double u) const;
+
+    // 批量求值：结果写入调用者提供的 out[0..count)，不分配内存
+    void evaluateMany(const double* us, std::size_t count, Point2D* out) const;
+    void evaluateMany(const double* us, std::size_t count, Vec3d* out) const;
+
+    // SoA 批量求值：zs 为空时不写 z 分量
+    void evaluateMany(const double* us, std::size_t count, double* xs, double* ys, double* zs = nullptr) const;
+
+private:
+    void init(int dimension);
+
+    int dim = 0;
+    std::vector<Vec4d> homogeneous;        // H_i = (w_i P_i, w_i)
+    std::vector<Vec4d> scaledPoints;       // C(n,i) * H_i
+    std::vector<Vec4d> scaledHodograph;    // C(n-1,i) * n * (H_{i+1} - H_i)
+    std::vector<double> powerPacked;       // 幂基系数按分量连续存放：dim 个坐标分量后接权重分量
+};
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_RATIONAL_BEZIER_CURVE_H
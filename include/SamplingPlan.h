@@ -0,0 +1,110 @@
+#ifndef GEOALGO_SAMPLING_PLAN_H
+#define GEOALGO_SAMPLING_PLAN_H
+
+#include "BezierCurve.h"
+#include "NURBS.h"
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace GeoAlgo {
+
+/**
+ * 采样计划（Sampling Plan）
+ * 对给定 (次数 p, 节点向量 U, 采样数 N)，在定义域 [u_p, u_{n+1}] 上取 N 个等距参数，
+ * 预计算每个参数的首个非零控制点下标 (span - p) 与 p+1 个基函数值。
+ * 之后共享这组参数的任意曲线求值只需一次 N×(p+1) 的稠密矩阵-向量乘。
+ * Bezier 曲线视为节点 [0,..,0,1,..,1] 的 B 样条，基函数即 Bernstein 基。
+ */
+class SamplingPlan {
+public:
+    SamplingPlan(int degree, const std::vector<double>& knots, int numSamples);
+
+    // n 次 Bezier 曲线在 [0,1] 上的采样计划
+    static SamplingPlan forBezier(int degree, int numSamples);
+
+    int degree() const { return degree_; }
+    int numSamples() const { return static_cast<int>(params_.size()); }
+    // 与本计划共享节点向量的曲线的控制点数
+    int numControlPoints() const { return static_cast<int>(knots_.size()) - degree_ - 1; }
+    const std::vector<double>& knots() const { return knots_; }
+    const std::vector<double>& params() const { return params_; }
+    // 第 k 个采样点的首个非零控制点下标
+    const std::vector<int>& firstIndices() const { return first_; }
+    // 第 k 个采样点的基函数值为 basis()[k*(p+1) .. k*(p+1)+p]
+    const std::vector<double>& basis() const { return basis_; }
+
+    // 节点向量与次数是否与给定曲线一致
+    bool matches(const NURBS& curve) const;
+    bool matches(const BezierCurve& curve) const;
+
+    /**
+     * 齐次控制点 Pw 上求值，out 按点连续存放 numSamples*dim 个值
+     * 适用于任何与本计划共享次数和节点向量的曲线数据；
+     * numPoints 须等于 numControlPoints()，dim 须在 [1, 3]，否则抛出 std::invalid_argument
+     */
+    void evaluateHomogeneous(const Vec4d* Pw, int numPoints, int dim, double* out) const;
+
+    // NURBS 曲线，out 共 numSamples*dim 个值；节点或次数不一致时抛出 std::invalid_argument
+    void evaluate(const NURBS& curve, double* out) const;
+
+    // Bezier 曲线，out 共 numSamples 个点
+    void evaluate(const BezierCurve& curve, Point2D* out) const;
+
+    // 多条共享节点的曲线依次求值，第 c 条曲线的结果写在 out + c*numSamples*dim
+    void evaluateBatch(const NURBS* curves, std::size_t count, double* out) const;
+    void evaluateBatch(const BezierCurve* curves, std::size_t count, Point2D* out) const;
+
+private:
+    int degree_;
+    std::vector<double> knots_;
+    std::vector<double> params_;
+    std::vector<int> first_;
+    std::vector<double> basis_;
+    bool bezier_; // 节点为 [0,..,0,1,..,1]
+};
+
+/**
+ * 采样计划缓存
+ * 以 (次数, 节点向量, 采样数) 为键，最近最少使用 (LRU) 淘汰，容量有上限。
+ * 线程安全；返回的计划为只读共享对象，被淘汰后仍可由持有者继续使用。
+ */
+class SamplingPlanCache {
+public:
+    explicit SamplingPlanCache(std::size_t capacity = 64);
+
+    std::shared_ptr<const SamplingPlan> get(int degree, const std::vector<double>& knots, int numSamples);
+    std::shared_ptr<const SamplingPlan> getBezier(int degree, int numSamples);
+
+    std::size_t size() const;
+    std::size_t capacity() const { return capacity_; }
+    std::size_t hits() const;
+    std::size_t misses() const;
+    void clear();
+
+private:
+    struct Entry {
+        int degree;
+        int numSamples;
+        std::vector<double> knots;
+        std::size_t hash;
+        std::shared_ptr<const SamplingPlan> plan;
+    };
+    using EntryList = std::list<Entry>;
+
+    static std::size_t hashKey(int degree, const std::vector<double>& knots, int numSamples);
+
+    std::size_t capacity_;
+    std::size_t hits_ = 0;
+    std::size_t misses_ = 0;
+    EntryList entries_; // 表头为最近使用
+    std::unordered_multimap<std::size_t, EntryList::iterator> index_;
+    mutable std::mutex mutex_;
+};
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_SAMPLING_PLAN_H
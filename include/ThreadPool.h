@@ -0,0 +1,69 @@
+#ifndef GEOALGO_THREAD_POOL_H
+#define GEOALGO_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace GeoAlgo {
+
+/**
+ * 工作窃取线程池（Work-Stealing Thread Pool）
+ * - 每个线程一个任务队列，任务为连续的下标区间
+ * - 线程从自己队列尾部取任务，较大的区间先对半拆分、后半段放回队列；
+ *   自己队列为空时从其他队列头部窃取（头部区间最大）
+ * - parallelFor 的调用线程也参与执行，因此在任务内部嵌套调用不会死锁
+ * - 结果写入位置由任务下标决定时，输出与调度顺序无关
+ */
+class ThreadPool {
+public:
+    // numThreads 为参与计算的线程总数（含调用线程），0 表示取硬件并发数
+    explicit ThreadPool(std::size_t numThreads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::size_t size() const { return queues_.size(); }
+
+    // 对 [0, numTasks) 中每个下标调用 fn，全部完成后返回；任务抛出的第一个异常在此重新抛出
+    void parallelFor(std::size_t numTasks, const std::function<void(std::size_t)>& fn);
+
+    // 进程内共享的默认线程池（硬件并发数）
+    static ThreadPool& shared();
+
+private:
+    struct ForState;
+    struct Job {
+        ForState* state;
+        std::size_t begin;
+        std::size_t end;
+    };
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    void push(std::size_t queue, const Job& job);
+    bool tryPop(std::size_t self, Job& job);
+    void run(std::size_t self, Job job);
+    void workerLoop(std::size_t index);
+    std::size_t currentQueue() const;
+
+    std::vector<std::unique_ptr<Queue>> queues_; // queues_[0] 供外部调用线程使用
+    std::vector<std::thread> workers_;
+    std::mutex sleepMutex_;
+    std::condition_variable sleepCv_;
+    std::atomic<std::size_t> queued_{0};
+    std::atomic<bool> stop_{false};
+};
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_THREAD_POOL_H
@@ -0,0 +1,208 @@
+#ifndef GEOALGO_VEC_H
+#define GEOALGO_VEC_H
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+
+namespace GeoAlgo {
+
+namespace detail {
+
+// 具名分量存储：x, y, z, w
+template <typename S, int N> struct VecStorage;
+template <typename S> struct VecStorage<S, 1> { S x; };
+template <typename S> struct VecStorage<S, 2> { S x; S y; };
+template <typename S> struct VecStorage<S, 3> { S x; S y; S z; };
+template <typename S> struct VecStorage<S, 4> { S x; S y; S z; S w; };
+
+// 下标到具名分量的成员指针表
+template <typename S, int N> struct VecMembers;
+template <typename S> struct VecMembers<S, 1> {
+    using B = VecStorage<S, 1>;
+    static constexpr S B::* value[1] = {&B::x};
+};
+template <typename S> struct VecMembers<S, 2> {
+    using B = VecStorage<S, 2>;
+    static constexpr S B::* value[2] = {&B::x, &B::y};
+};
+template <typename S> struct VecMembers<S, 3> {
+    using B = VecStorage<S, 3>;
+    static constexpr S B::* value[3] = {&B::x, &B::y, &B::z};
+};
+template <typename S> struct VecMembers<S, 4> {
+    using B = VecStorage<S, 4>;
+    static constexpr S B::* value[4] = {&B::x, &B::y, &B::z, &B::w};
+};
+
+// 对齐到不小于数据大小的 2 的幂，上限 32 字节（一个 AVX 寄存器）
+constexpr std::size_t vecAlignment(std::size_t bytes, std::size_t natural) {
+    std::size_t a = natural;
+    while (a < bytes && a < 32) a *= 2;
+    return a;
+}
+
+} // namespace detail
+
+/**
+ * 定长向量 Vec<Scalar, N>，N = 1..4
+ * - 分量以 x, y, z, w 具名访问，也可用 operator[] 按下标访问
+ * - 按向量寄存器宽度对齐、可平凡复制，逐分量运算展开为 N 条独立语句便于编译器向量化
+ * - N = 4 用作有理曲线的齐次坐标 (w*x, w*y, w*z, w)
+ * 所有曲线类的点、导数均以 Vec 返回，Point2D 即 Vec<double, 2>
+ */
+template <typename Scalar, int N>
+struct alignas(detail::vecAlignment(sizeof(Scalar) * N, alignof(Scalar))) Vec
+    : detail::VecStorage<Scalar, N> {
+    static_assert(N >= 1 && N <= 4, "Vec: N must be in [1, 4]");
+    static_assert(std::is_floating_point<Scalar>::value, "Vec: Scalar must be floating point");
+
+    using Storage = detail::VecStorage<Scalar, N>;
+    using scalar_type = Scalar;
+    static constexpr int kSize = N;
+
+    constexpr Vec() : Storage{} {}
+
+    template <typename... A,
+              typename = std::enable_if_t<sizeof...(A) == N && (std::is_arithmetic<A>::value && ...)>>
+    constexpr Vec(A... a) : Storage{static_cast<Scalar>(a)...} {}
+
+    constexpr explicit Vec(const std::array<Scalar, N>& a)
+        : Vec(generate([&](int i) { return a[i]; })) {}
+
+    static constexpr Vec filled(Scalar s) {
+        return generate([&](int) { return s; });
+    }
+
+    // 由 f(0), f(1), ..., f(N-1) 构造
+    template <typename F>
+    static constexpr Vec generate(F f) {
+        return generateImpl(f, std::make_integer_sequence<int, N>{});
+    }
+
+    constexpr Scalar& operator[](int i) { return this->*detail::VecMembers<Scalar, N>::value[i]; }
+    constexpr const Scalar& operator[](int i) const { return this->*detail::VecMembers<Scalar, N>::value[i]; }
+
+    constexpr std::array<Scalar, N> toArray() const {
+        return toArrayImpl(std::make_integer_sequence<int, N>{});
+    }
+
+    // 加法
+    friend constexpr Vec operator+(const Vec& a, const Vec& b) {
+        return generate([&](int i) { return a[i] + b[i]; });
+    }
+
+    // 减法
+    friend constexpr Vec operator-(const Vec& a, const Vec& b) {
+        return generate([&](int i) { return a[i] - b[i]; });
+    }
+
+    friend constexpr Vec operator-(const Vec& a) {
+        return generate([&](int i) { return -a[i]; });
+    }
+
+    // 乘标量
+    friend constexpr Vec operator*(const Vec& a, Scalar s) {
+        return generate([&](int i) { return a[i] * s; });
+    }
+
+    friend constexpr Vec operator*(Scalar s, const Vec& a) { return a * s; }
+
+    // 除标量
+    friend constexpr Vec operator/(const Vec& a, Scalar s) {
+        return generate([&](int i) { return a[i] / s; });
+    }
+
+    constexpr Vec& operator+=(const Vec& b) { return *this = *this + b; }
+    constexpr Vec& operator-=(const Vec& b) { return *this = *this - b; }
+    constexpr Vec& operator*=(Scalar s) { return *this = *this * s; }
+    constexpr Vec& operator/=(Scalar s) { return *this = *this / s; }
+
+    friend constexpr bool operator==(const Vec& a, const Vec& b) {
+        return a.equalImpl(b, std::make_integer_sequence<int, N>{});
+    }
+    friend constexpr bool operator!=(const Vec& a, const Vec& b) { return !(a == b); }
+
+    constexpr Scalar dot(const Vec& b) const {
+        return dotImpl(b, std::make_integer_sequence<int, N>{});
+    }
+
+    constexpr Scalar squaredNorm() const { return dot(*this); }
+    Scalar norm() const { return std::sqrt(squaredNorm()); }
+
+    constexpr Scalar squaredDistanceTo(const Vec& other) const { return (*this - other).squaredNorm(); }
+
+    // 距离
+    Scalar distanceTo(const Vec& other) const {
+        if constexpr (N == 2) return std::hypot(this->x - other.x, this->y - other.y);
+        else return (*this - other).norm();
+    }
+
+    // 输出
+    friend std::ostream& operator<<(std::ostream& os, const Vec& p) {
+        os << "(";
+        for (int i = 0; i < N; ++i) os << (i ? ", " : "") << p[i];
+        os << ")";
+        return os;
+    }
+
+private:
+    template <typename F, int... I>
+    static constexpr Vec generateImpl(F& f, std::integer_sequence<int, I...>) {
+        return Vec(f(I)...);
+    }
+
+    template <int... I>
+    constexpr std::array<Scalar, N> toArrayImpl(std::integer_sequence<int, I...>) const {
+        return {{(*this)[I]...}};
+    }
+
+    template <int... I>
+    constexpr Scalar dotImpl(const Vec& b, std::integer_sequence<int, I...>) const {
+        return (((*this)[I] * b[I]) + ...);
+    }
+
+    template <int... I>
+    constexpr bool equalImpl(const Vec& b, std::integer_sequence<int, I...>) const {
+        return (((*this)[I] == b[I]) && ...);
+    }
+};
+
+using Vec2d = Vec<double, 2>;
+using Vec3d = Vec<double, 3>;
+using Vec4d = Vec<double, 4>;
+using Vec2f = Vec<float, 2>;
+using Vec3f = Vec<float, 3>;
+using Vec4f = Vec<float, 4>;
+
+// a*s + b，单次乘加
+template <typename S, int N>
+constexpr Vec<S, N> axpy(const Vec<S, N>& a, S s, const Vec<S, N>& b) {
+    return Vec<S, N>::generate([&](int i) { return a[i] * s + b[i]; });
+}
+
+// 二维 / 三维点的齐次坐标 (w*p, w)，不足三维的分量补零
+template <typename S, int N>
+constexpr Vec<S, 4> toHomogeneous(const Vec<S, N>& p, S w) {
+    static_assert(N <= 3, "toHomogeneous: N must be at most 3");
+    return Vec<S, 4>::generate([&](int i) { return i < N ? p[i] * w : (i == 3 ? w : S(0)); });
+}
+
+// 齐次坐标除以权重，取前 N 个分量
+template <int N, typename S>
+constexpr Vec<S, N> fromHomogeneous(const Vec<S, 4>& h) {
+    static_assert(N <= 3, "fromHomogeneous: N must be at most 3");
+    const S inv = S(1) / h.w;
+    return Vec<S, N>::generate([&](int i) { return h[i] * inv; });
+}
+
+static_assert(std::is_trivially_copyable<Vec2d>::value, "Vec must be trivially copyable");
+static_assert(sizeof(Vec2d) == 16 && alignof(Vec2d) == 16, "Vec2d layout");
+static_assert(sizeof(Vec4d) == 32 && alignof(Vec4d) == 32, "Vec4d layout");
+
+} // namespace GeoAlgo
+
+#endif // GEOALGO_VEC_H
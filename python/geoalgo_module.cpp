@@ -0,0 +1,473 @@
+/**
+ * geoalgo：GeoAlgo 的 Python 扩展模块
+ *
+ * - 参数数组按 float64 C 连续读取，已满足时不复制（其余 dtype / 布局由 NumPy 转换一次）
+ * - 结果在 C++ 侧的 std::vector 中算好后直接交给 NumPy（capsule 持有），不再复制；
+ *   Vec3d 按 32 字节对齐，三维结果以行跨度 32 字节的视图返回
+ * - 批量求值、导数与离散在释放 GIL 后进行，大数组按块分给 ThreadPool::shared()
+ * - exact_bounds(curve) 返回精确包围盒 (lo, hi)
+ *
+ * 点数组形状为 (n, dim)，参数数组可为任意形状（按元素顺序展平）
+ */
+#include "AdaptiveTessellator.h"
+#include "BezierCurve.h"
+#include "CurveBounds.h"
+#include "NURBS.h"
+#include "PowerBasisCurve1D.h"
+#include "PowerBasisCurve2D.h"
+#include "PowerBasisCurve3D.h"
+#include "RationalBezierCurve.h"
+#include "ThreadPool.h"
+#include "Vec.h"
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace py = pybind11;
+using namespace GeoAlgo;
+
+namespace {
+
+using DoubleArray = py::array_t<double, py::array::c_style | py::array::forcecast>;
+
+// 单个任务的参数个数，小于该值时不分块
+constexpr std::size_t kGrain = 4096;
+
+// 把 [0, count) 按 kGrain 分块并行执行 fn(k0, k1)
+template <typename F>
+void forEachBlock(std::size_t count, F&& fn) {
+    if (count <= kGrain) {
+        if (count) fn(std::size_t(0), count);
+        return;
+    }
+    ThreadPool::shared().parallelFor((count + kGrain - 1) / kGrain, [&](std::size_t task) {
+        const std::size_t k0 = task * kGrain;
+        fn(k0, std::min(count, k0 + kGrain));
+    });
+}
+
+// 把 vector 的所有权交给 NumPy 数组，形状 (n, dim)
+template <typename T>
+py::array adoptRows(std::vector<T>&& values, std::size_t rows, int dim) {
+    auto* owner = new std::vector<T>(std::move(values));
+    py::capsule capsule(owner, [](void* p) { delete static_cast<std::vector<T>*>(p); });
+    // double 向量按点连续存放 dim 个分量，Vec 向量每个元素即一行
+    const py::ssize_t rowStride = static_cast<py::ssize_t>(sizeof(T) * (std::is_same<T, double>::value ? dim : 1));
+    return py::array_t<double>({static_cast<py::ssize_t>(rows), static_cast<py::ssize_t>(dim)},
+                               {rowStride, static_cast<py::ssize_t>(sizeof(double))},
+                               reinterpret_cast<const double*>(owner->data()), capsule);
+}
+
+py::array adoptValues(std::vector<double>&& values) {
+    auto* owner = new std::vector<double>(std::move(values));
+    py::capsule capsule(owner, [](void* p) { delete static_cast<std::vector<double>*>(p); });
+    return py::array_t<double>(static_cast<py::ssize_t>(owner->size()), owner->data(), capsule);
+}
+
+// (n, dim) 点数组
+std::vector<double> readPoints(const DoubleArray& a, int minDim, int maxDim, const char* what, int& dim) {
+    if (a.ndim() != 2 || a.shape(1) < minDim || a.shape(1) > maxDim)
+        throw std::invalid_argument(std::string(what) + ": points must have shape (n, " + std::to_string(minDim) +
+                                    (minDim == maxDim ? "" : ".." + std::to_string(maxDim)) + ")");
+    dim = static_cast<int>(a.shape(1));
+    return std::vector<double>(a.data(), a.data() + a.size());
+}
+
+std::vector<Point2D> readPoints2D(const DoubleArray& a, const char* what) {
+    int dim = 0;
+    const std::vector<double> v = readPoints(a, 2, 2, what, dim);
+    std::vector<Point2D> points(v.size() / 2);
+    for (std::size_t i = 0; i < points.size(); ++i) points[i] = Point2D(v[2 * i], v[2 * i + 1]);
+    return points;
+}
+
+std::vector<double> readValues(const DoubleArray& a) {
+    return std::vector<double>(a.data(), a.data() + a.size());
+}
+
+template <int N>
+py::array toArray(const Vec<double, N>& p, int dim = N) {
+    py::array_t<double> out(dim);
+    for (int d = 0; d < dim; ++d) out.mutable_at(d) = p[d];
+    return out;
+}
+
+// 包围盒 -> (lo, hi)，各为长度 dim 的数组
+template <int N>
+py::tuple boundsTuple(const Vec<double, N>& lo, const Vec<double, N>& hi, int dim = N) {
+    return py::make_tuple(toArray(lo, dim), toArray(hi, dim));
+}
+
+int checkOrder(int order) {
+    if (order < 0) throw std::invalid_argument("derivative order must be non-negative");
+    return order;
+}
+
+/**
+ * 批量求值的公共部分：在释放 GIL 后分块调用 fn(us + k0, k1 - k0, out + k0)
+ * 输出为 count 个 T，按 (count, dim) 返回
+ */
+template <typename T, typename F>
+py::array evaluateRows(const DoubleArray& us, int dim, F&& fn) {
+    const double* u = us.data();
+    const std::size_t count = static_cast<std::size_t>(us.size());
+    std::vector<T> out;
+    {
+        py::gil_scoped_release release;
+        out.resize(count);
+        forEachBlock(count, [&](std::size_t k0, std::size_t k1) { fn(u + k0, k1 - k0, out.data() + k0); });
+    }
+    return adoptRows(std::move(out), count, dim);
+}
+
+/**
+ * 自适应离散：先按估计容量离散一次，返回值超过容量时以其为新容量重做
+ * 返回 (points, params)
+ */
+template <typename T, typename F>
+py::tuple tessellateRows(int dim, F&& fn) {
+    std::vector<T> points;
+    std::vector<double> params;
+    {
+        py::gil_scoped_release release;
+        std::size_t capacity = 256;
+        for (;;) {
+            points.resize(capacity);
+            params.resize(capacity);
+            const std::size_t n = fn(points.data(), params.data(), capacity);
+            if (n <= capacity) {
+                points.resize(n);
+                params.resize(n);
+                break;
+            }
+            capacity = n;
+        }
+    }
+    const std::size_t n = points.size();
+    return py::make_tuple(adoptRows(std::move(points), n, dim), adoptValues(std::move(params)));
+}
+
+} // namespace
+
+PYBIND11_MODULE(geoalgo, m) {
+    m.doc() = "GeoAlgo curve evaluation: batch calls take and return NumPy arrays and release the GIL";
+
+    // ---------------------------------------------------------------------
+    // BezierCurve（二维）
+    // ---------------------------------------------------------------------
+    py::class_<BezierCurve>(m, "BezierCurve")
+        .def(py::init([](const DoubleArray& points) { return BezierCurve(readPoints2D(points, "BezierCurve")); }),
+             py::arg("control_points"))
+        .def_property_readonly("degree", &BezierCurve::degree)
+        .def_property_readonly("control_points",
+                               [](const BezierCurve& c) {
+                                   std::vector<Point2D> p = c.controlPoints();
+                                   const std::size_t n = p.size();
+                                   return adoptRows(std::move(p), n, 2);
+                               })
+        .def("evaluate", [](const BezierCurve& c, double u) { return toArray(c.evaluate(u)); }, py::arg("u"))
+        .def("evaluate",
+             [](const BezierCurve& c, const DoubleArray& us) {
+                 return evaluateRows<Point2D>(us, 2, [&](const double* u, std::size_t n, Point2D* out) {
+                     c.evaluateMany(u, n, out);
+                 });
+             },
+             py::arg("us"))
+        .def("derivative",
+             [](const BezierCurve& c, const DoubleArray& us, int order) {
+                 // order 阶导数即 order 次 hodograph 曲线
+                 BezierCurve d = c;
+                 for (int j = checkOrder(order); j > 0 && d.degree() > 0; --j) d = d.hodograph();
+                 const bool zero = order > c.degree();
+                 return evaluateRows<Point2D>(us, 2, [&](const double* u, std::size_t n, Point2D* out) {
+                     if (zero) std::fill(out, out + n, Point2D());
+                     else d.evaluateMany(u, n, out);
+                 });
+             },
+             py::arg("us"), py::arg("order") = 1)
+        .def("hodograph", &BezierCurve::hodograph);
+
+    // ---------------------------------------------------------------------
+    // RationalBezierCurve（二维 / 三维）
+    // ---------------------------------------------------------------------
+    py::class_<RationalBezierCurve>(m, "RationalBezierCurve")
+        .def(py::init([](const DoubleArray& points, const DoubleArray& weights) {
+                 int dim = 0;
+                 const std::vector<double> v = readPoints(points, 2, 3, "RationalBezierCurve", dim);
+                 const std::vector<double> w = readValues(weights);
+                 const std::size_t n = v.size() / dim;
+                 if (dim == 2) {
+                     std::vector<Point2D> p(n);
+                     for (std::size_t i = 0; i < n; ++i) p[i] = Point2D(v[2 * i], v[2 * i + 1]);
+                     return RationalBezierCurve(p, w);
+                 }
+                 std::vector<Vec3d> p(n);
+                 for (std::size_t i = 0; i < n; ++i) p[i] = Vec3d(v[3 * i], v[3 * i + 1], v[3 * i + 2]);
+                 return RationalBezierCurve(p, w);
+             }),
+             py::arg("control_points"), py::arg("weights"))
+        .def_property_readonly("degree", &RationalBezierCurve::degree)
+        .def_property_readonly("dimension", &RationalBezierCurve::dimension)
+        .def("evaluate", [](const RationalBezierCurve& c, double u) { return toArray(c.evaluate3D(u), c.dimension()); },
+             py::arg("u"))
+        .def("evaluate",
+             [](const RationalBezierCurve& c, const DoubleArray& us) {
+                 if (c.dimension() == 2)
+                     return evaluateRows<Point2D>(us, 2, [&](const double* u, std::size_t n, Point2D* out) {
+                         c.evaluateMany(u, n, out);
+                     });
+                 return evaluateRows<Vec3d>(us, 3, [&](const double* u, std::size_t n, Vec3d* out) {
+                     c.evaluateMany(u, n, out);
+                 });
+             },
+             py::arg("us"))
+        .def("derivative",
+             [](const RationalBezierCurve& c, const DoubleArray& us) {
+                 return evaluateRows<Vec3d>(us, c.dimension(), [&](const double* u, std::size_t n, Vec3d* out) {
+                     for (std::size_t k = 0; k < n; ++k) out[k] = c.derivative3D(u[k]);
+                 });
+             },
+             py::arg("us"));
+
+    // ---------------------------------------------------------------------
+    // 幂基曲线（SIMD Horner 内核）
+    // ---------------------------------------------------------------------
+    py::class_<PowerBasisCurve1D>(m, "PowerBasisCurve1D")
+        .def(py::init([](const DoubleArray& coeffs) { return PowerBasisCurve1D(readValues(coeffs)); }),
+             py::arg("coefficients"))
+        .def_property_readonly("coefficients",
+                               [](const PowerBasisCurve1D& c) { return adoptValues(std::vector<double>(c.coefficients())); })
+        .def("evaluate", [](const PowerBasisCurve1D& c, double t) { return c.evaluate(t); }, py::arg("t"))
+        .def("evaluate",
+             [](const PowerBasisCurve1D& c, const DoubleArray& ts) {
+                 const double* t = ts.data();
+                 const std::size_t count = static_cast<std::size_t>(ts.size());
+                 std::vector<double> out;
+                 {
+                     py::gil_scoped_release release;
+                     out.resize(count);
+                     forEachBlock(count, [&](std::size_t k0, std::size_t k1) {
+                         c.evaluateMany(t + k0, k1 - k0, out.data() + k0);
+                     });
+                 }
+                 return adoptValues(std::move(out));
+             },
+             py::arg("ts"))
+        .def("derivative", [](const PowerBasisCurve1D& c) { return c.derivative(); });
+
+    py::class_<PowerBasisCurve2D>(m, "PowerBasisCurve2D")
+        .def(py::init([](const DoubleArray& x, const DoubleArray& y) {
+                 return PowerBasisCurve2D(readValues(x), readValues(y));
+             }),
+             py::arg("x_coefficients"), py::arg("y_coefficients"))
+        .def("evaluate", [](const PowerBasisCurve2D& c, double t) { return toArray(c.evaluate(t)); }, py::arg("t"))
+        .def("evaluate",
+             [](const PowerBasisCurve2D& c, const DoubleArray& ts) {
+                 return evaluateRows<Point2D>(ts, 2, [&](const double* t, std::size_t n, Point2D* out) {
+                     // 按块在栈上做 SoA 求值再交错写出
+                     double xs[256], ys[256];
+                     for (std::size_t k0 = 0; k0 < n; k0 += 256) {
+                         const std::size_t m = std::min<std::size_t>(256, n - k0);
+                         c.evaluateMany(t + k0, m, xs, ys);
+                         for (std::size_t k = 0; k < m; ++k) out[k0 + k] = Point2D(xs[k], ys[k]);
+                     }
+                 });
+             },
+             py::arg("ts"))
+        .def("derivative",
+             [](const PowerBasisCurve2D& c, const DoubleArray& ts, int order) {
+                 const int k = checkOrder(order);
+                 return evaluateRows<Point2D>(ts, 2, [&](const double* t, std::size_t n, Point2D* out) {
+                     std::vector<double> buf(2 * (k + 1) * std::min<std::size_t>(n, 256));
+                     std::vector<double*> outs(2 * (k + 1));
+                     std::vector<double> scratch(powerBasisDerivativeTableSize(2, c.degree() + 1, k));
+                     for (std::size_t k0 = 0; k0 < n; k0 += 256) {
+                         const std::size_t m = std::min<std::size_t>(256, n - k0);
+                         for (std::size_t r = 0; r < outs.size(); ++r) outs[r] = buf.data() + r * m;
+                         c.evaluateDerivativesMany(t + k0, m, k, outs.data(), scratch.data());
+                         for (std::size_t i = 0; i < m; ++i) out[k0 + i] = Point2D(outs[2 * k][i], outs[2 * k + 1][i]);
+                     }
+                 });
+             },
+             py::arg("ts"), py::arg("order") = 1);
+
+    py::class_<PowerBasisCurve3D>(m, "PowerBasisCurve3D")
+        .def(py::init([](const DoubleArray& x, const DoubleArray& y, const DoubleArray& z) {
+                 return PowerBasisCurve3D(readValues(x), readValues(y), readValues(z));
+             }),
+             py::arg("x_coefficients"), py::arg("y_coefficients"), py::arg("z_coefficients"))
+        .def("evaluate", [](const PowerBasisCurve3D& c, double t) { return toArray(c.evaluate(t)); }, py::arg("t"))
+        .def("evaluate",
+             [](const PowerBasisCurve3D& c, const DoubleArray& ts) {
+                 return evaluateRows<Vec3d>(ts, 3, [&](const double* t, std::size_t n, Vec3d* out) {
+                     double xs[256], ys[256], zs[256];
+                     for (std::size_t k0 = 0; k0 < n; k0 += 256) {
+                         const std::size_t m = std::min<std::size_t>(256, n - k0);
+                         c.evaluateMany(t + k0, m, xs, ys, zs);
+                         for (std::size_t k = 0; k < m; ++k) out[k0 + k] = Vec3d(xs[k], ys[k], zs[k]);
+                     }
+                 });
+             },
+             py::arg("ts"))
+        .def("derivative",
+             [](const PowerBasisCurve3D& c, const DoubleArray& ts, int order) {
+                 const int k = checkOrder(order);
+                 return evaluateRows<Vec3d>(ts, 3, [&](const double* t, std::size_t n, Vec3d* out) {
+                     std::vector<double> buf(3 * (k + 1) * std::min<std::size_t>(n, 256));
+                     std::vector<double*> outs(3 * (k + 1));
+                     std::vector<double> scratch(powerBasisDerivativeTableSize(3, c.degree() + 1, k));
+                     for (std::size_t k0 = 0; k0 < n; k0 += 256) {
+                         const std::size_t m = std::min<std::size_t>(256, n - k0);
+                         for (std::size_t r = 0; r < outs.size(); ++r) outs[r] = buf.data() + r * m;
+                         c.evaluateDerivativesMany(t + k0, m, k, outs.data(), scratch.data());
+                         for (std::size_t i = 0; i < m; ++i)
+                             out[k0 + i] = Vec3d(outs[3 * k][i], outs[3 * k + 1][i], outs[3 * k + 2][i]);
+                     }
+                 });
+             },
+             py::arg("ts"), py::arg("order") = 1);
+
+    // ---------------------------------------------------------------------
+    // NURBS（一至三维）
+    // ---------------------------------------------------------------------
+    py::class_<NURBS>(m, "NURBS")
+        .def(py::init([](int degree, const DoubleArray& points, const DoubleArray& knots, py::object weights) {
+                 int dim = 0;
+                 const std::vector<double> v = readPoints(points, 1, NURBS::kMaxDim, "NURBS", dim);
+                 std::vector<double> w;
+                 if (!weights.is_none()) w = readValues(weights.cast<DoubleArray>());
+                 return NURBS(degree, dim, v, readValues(knots), w);
+             }),
+             py::arg("degree"), py::arg("control_points"), py::arg("knots"), py::arg("weights") = py::none())
+        .def_static("clamped_uniform_knots", &NURBS::clampedUniformKnots, py::arg("num_control_points"),
+                    py::arg("degree"))
+        .def_property_readonly("degree", &NURBS::degree)
+        .def_property_readonly("dimension", &NURBS::dimension)
+        .def_property_readonly("knots", [](const NURBS& c) { return adoptValues(std::vector<double>(c.knots())); })
+        .def_property_readonly("domain", [](const NURBS& c) { return py::make_tuple(c.firstParam(), c.lastParam()); })
+        .def("evaluate", [](const NURBS& c, double u) { return toArray(c.evaluatePoint3D(u), c.dimension()); },
+             py::arg("u"))
+        .def("evaluate",
+             [](const NURBS& c, const DoubleArray& us) {
+                 // evaluateMany 本身按点连续输出，直接写入结果数组
+                 const int dim = c.dimension();
+                 const double* u = us.data();
+                 const std::size_t count = static_cast<std::size_t>(us.size());
+                 std::vector<double> out;
+                 {
+                     py::gil_scoped_release release;
+                     out.resize(count * dim);
+                     forEachBlock(count, [&](std::size_t k0, std::size_t k1) {
+                         c.evaluateMany(u + k0, k1 - k0, out.data() + k0 * dim);
+                     });
+                 }
+                 return adoptRows(std::move(out), count, dim);
+             },
+             py::arg("us"))
+        .def("derivative",
+             [](const NURBS& c, const DoubleArray& us, int order) {
+                 const int k = checkOrder(order);
+                 return evaluateRows<Vec3d>(us, c.dimension(), [&](const double* u, std::size_t n, Vec3d* out) {
+                     std::vector<Vec3d> ders(static_cast<std::size_t>(k + 1) * std::min<std::size_t>(n, 256));
+                     for (std::size_t k0 = 0; k0 < n; k0 += 256) {
+                         const std::size_t m = std::min<std::size_t>(256, n - k0);
+                         c.evaluateDerivativesMany(u + k0, m, k, ders.data());
+                         for (std::size_t i = 0; i < m; ++i) out[k0 + i] = ders[i * (k + 1) + k];
+                     }
+                 });
+             },
+             py::arg("us"), py::arg("order") = 1)
+        .def("insert_knot", &NURBS::insertKnot, py::arg("u"), py::arg("times") = 1)
+        .def("refine_knots", &NURBS::refineKnots, py::arg("knots"));
+
+    // ---------------------------------------------------------------------
+    // 自适应离散：返回 (points, params)
+    // ---------------------------------------------------------------------
+    py::class_<AdaptiveTessellator>(m, "AdaptiveTessellator")
+        .def(py::init<double, int>(), py::arg("tolerance") = 1e-3, py::arg("max_depth") = 20)
+        .def_property_readonly("tolerance", &AdaptiveTessellator::tolerance)
+        .def_property_readonly("max_depth", &AdaptiveTessellator::maxDepth)
+        .def("tessellate",
+             [](const AdaptiveTessellator& t, const BezierCurve& c) {
+                 return tessellateRows<Point2D>(2, [&](Point2D* out, double* params, std::size_t capacity) {
+                     return t.tessellate(c, out, capacity, params);
+                 });
+             },
+             py::arg("curve"))
+        .def("tessellate",
+             [](const AdaptiveTessellator& t, const RationalBezierCurve& c) {
+                 if (c.degree() > AdaptiveTessellator::kMaxDegree)
+                     throw std::invalid_argument("AdaptiveTessellator: degree exceeds kMaxDegree");
+                 return tessellateRows<Vec3d>(c.dimension(), [&](Vec3d* out, double* params, std::size_t capacity) {
+                     return t.tessellateHomogeneous<3>(c.homogeneousPoints().data(), c.degree(), out, capacity, params);
+                 });
+             },
+             py::arg("curve"))
+        .def("tessellate",
+             [](const AdaptiveTessellator& t, const PowerBasisCurve2D& c, double t0, double t1) {
+                 return tessellateRows<Point2D>(2, [&](Point2D* out, double* params, std::size_t capacity) {
+                     return t.tessellate(c, t0, t1, out, capacity, params);
+                 });
+             },
+             py::arg("curve"), py::arg("t0") = 0.0, py::arg("t1") = 1.0)
+        .def("tessellate",
+             [](const AdaptiveTessellator& t, const PowerBasisCurve3D& c, double t0, double t1) {
+                 return tessellateRows<Vec3d>(3, [&](Vec3d* out, double* params, std::size_t capacity) {
+                     return t.tessellate(c, t0, t1, out, capacity, params);
+                 });
+             },
+             py::arg("curve"), py::arg("t0") = 0.0, py::arg("t1") = 1.0)
+        .def("tessellate",
+             [](const AdaptiveTessellator& t, const NURBS& c, std::size_t maxPoints) {
+                 if (maxPoints < 2) throw std::invalid_argument("AdaptiveTessellator: max_points must be at least 2");
+                 // 有界离散超出当前容量时容量加倍重试，直到 max_points；再超出则为整条曲线上的等距采样
+                 return tessellateRows<Vec3d>(c.dimension(), [&](Vec3d* out, double* params, std::size_t capacity) {
+                     capacity = std::min(capacity, maxPoints);
+                     bool truncated = false;
+                     const std::size_t n = t.tessellateBounded(c, out, capacity, params, &truncated);
+                     return truncated && capacity < maxPoints ? std::min(2 * capacity, maxPoints) : n;
+                 });
+             },
+             py::arg("curve"), py::arg("max_points") = std::size_t(1) << 20);
+
+    // ---------------------------------------------------------------------
+    // 精确包围盒：返回 (lo, hi)
+    // ---------------------------------------------------------------------
+    m.def("exact_bounds",
+          [](const BezierCurve& c) {
+              const Box2D b = exactBounds(c);
+              return boundsTuple(b.lo, b.hi);
+          },
+          py::arg("curve"));
+    m.def("exact_bounds",
+          [](const RationalBezierCurve& c) {
+              const Box3D b = exactBounds3D(c);
+              return boundsTuple(b.lo, b.hi, c.dimension());
+          },
+          py::arg("curve"));
+    m.def("exact_bounds",
+          [](const PowerBasisCurve2D& c, double t0, double t1) {
+              const Box2D b = exactBounds(c, t0, t1);
+              return boundsTuple(b.lo, b.hi);
+          },
+          py::arg("curve"), py::arg("t0") = 0.0, py::arg("t1") = 1.0);
+    m.def("exact_bounds",
+          [](const PowerBasisCurve3D& c, double t0, double t1) {
+              const Box3D b = exactBounds(c, t0, t1);
+              return boundsTuple(b.lo, b.hi);
+          },
+          py::arg("curve"), py::arg("t0") = 0.0, py::arg("t1") = 1.0);
+    m.def("exact_bounds",
+          [](const NURBS& c) {
+              const Box3D b = exactBounds3D(c);
+              return boundsTuple(b.lo, b.hi, c.dimension());
+          },
+          py::arg("curve"));
+}
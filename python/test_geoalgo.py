@@ -0,0 +1,137 @@
+"""
+geoalgo 扩展模块测试（由 ctest 运行，PYTHONPATH 指向模块所在目录）
+
+NumPy 批量结果与 C++ 逐点结果（标量 evaluate、hodograph、derivative 曲线）核对：
+求值、导数、精确包围盒与 NURBS 离散。
+"""
+import numpy as np
+
+import geoalgo
+
+TOL = 1e-12
+rng = np.random.default_rng(7)
+
+
+def close(a, b, tol=TOL):
+    a = np.asarray(a, dtype=float)
+    b = np.asarray(b, dtype=float)
+    assert a.shape == b.shape, (a.shape, b.shape)
+    return np.all(np.abs(a - b) <= tol * (1.0 + np.abs(b)))
+
+
+def scalar_rows(f, us):
+    return np.array([f(float(u)) for u in us])
+
+
+def central_difference(f, us, h=1e-6):
+    return np.array([(np.asarray(f(float(u) + h)) - np.asarray(f(float(u) - h))) / (2 * h) for u in us])
+
+
+def check_bounds(lo, hi, samples, tol):
+    # 精确包围盒包含所有采样点，且只比采样包围盒大采样误差
+    lo, hi = np.asarray(lo), np.asarray(hi)
+    assert np.all(lo <= samples.min(axis=0) + 1e-12) and np.all(hi >= samples.max(axis=0) - 1e-12)
+    assert np.all(lo >= samples.min(axis=0) - tol) and np.all(hi <= samples.max(axis=0) + tol)
+
+
+# 参数数量超过 kGrain（4096）以覆盖分块并行，并含形状与 dtype 的转换
+us = np.linspace(0.0, 1.0, 10001)
+few = rng.uniform(0.0, 1.0, 64)
+dense = np.linspace(0.0, 1.0, 200001)
+
+# BezierCurve
+P = rng.uniform(-5.0, 5.0, (6, 2))
+bezier = geoalgo.BezierCurve(P)
+assert bezier.degree == 5 and close(bezier.control_points, P)
+batch = bezier.evaluate(us)
+assert batch.shape == (us.size, 2)
+assert close(batch, scalar_rows(bezier.evaluate, us))
+assert close(bezier.evaluate(us.reshape(-1, 1)), batch)
+assert close(bezier.evaluate([0, 1]), scalar_rows(bezier.evaluate, [0.0, 1.0]))
+h = bezier
+for order in range(1, 7):
+    h = h.hodograph() if h.degree > 0 else h
+    expected = scalar_rows(h.evaluate, few) if order <= bezier.degree else np.zeros((few.size, 2))
+    assert close(bezier.derivative(few, order), expected, 1e-11)
+parabola = geoalgo.BezierCurve(np.array([[0.0, 0.0], [1.0, 2.0], [2.0, 0.0]]))
+lo, hi = geoalgo.exact_bounds(parabola)
+assert close(lo, [0.0, 0.0]) and close(hi, [2.0, 1.0])
+check_bounds(*geoalgo.exact_bounds(bezier), bezier.evaluate(dense), 1e-6)
+
+# RationalBezierCurve（二维 / 三维）
+for dim in (2, 3):
+    R = rng.uniform(-5.0, 5.0, (5, dim))
+    W = rng.uniform(0.3, 3.0, 5)
+    rational = geoalgo.RationalBezierCurve(R, W)
+    assert rational.dimension == dim and rational.degree == 4
+    batch = rational.evaluate(us)
+    assert batch.shape == (us.size, dim)
+    assert close(batch, scalar_rows(rational.evaluate, us))
+    inner = few * 0.98 + 0.01
+    assert close(rational.derivative(inner), central_difference(rational.evaluate, inner), 1e-6)
+    check_bounds(*geoalgo.exact_bounds(rational), rational.evaluate(dense), 1e-6)
+
+# 幂基曲线
+cx, cy, cz = (rng.uniform(-2.0, 2.0, 7) for _ in range(3))
+p1 = geoalgo.PowerBasisCurve1D(cx)
+assert close(p1.coefficients, cx)
+assert close(p1.evaluate(us), scalar_rows(p1.evaluate, us))
+assert close(p1.evaluate(us), np.polynomial.polynomial.polyval(us, cx))
+
+
+def nth_derivative(coeffs, order):
+    c = geoalgo.PowerBasisCurve1D(coeffs)
+    for _ in range(order):
+        c = c.derivative()
+    return c
+
+
+ts = np.linspace(-1.0, 1.5, 10001)
+p2 = geoalgo.PowerBasisCurve2D(cx, cy[:4])
+assert close(p2.evaluate(ts), scalar_rows(p2.evaluate, ts))
+p3 = geoalgo.PowerBasisCurve3D(cx, cy, cz[:5])
+assert close(p3.evaluate(ts), scalar_rows(p3.evaluate, ts))
+for order in range(0, 9):
+    expected2 = np.column_stack([scalar_rows(nth_derivative(c, order).evaluate, ts) for c in (cx, cy[:4])])
+    assert close(p2.derivative(ts, order), expected2, 1e-11)
+    expected3 = np.column_stack([scalar_rows(nth_derivative(c, order).evaluate, ts) for c in (cx, cy, cz[:5])])
+    assert close(p3.derivative(ts, order), expected3, 1e-11)
+check_bounds(*geoalgo.exact_bounds(p2, -1.0, 1.5), p2.evaluate(np.linspace(-1.0, 1.5, 200001)), 1e-5)
+check_bounds(*geoalgo.exact_bounds(p3), p3.evaluate(dense), 1e-5)
+
+# NURBS（二维 / 三维，非均匀节点与权重）
+for dim in (2, 3):
+    n, p = 8, 3
+    knots = np.array(geoalgo.NURBS.clamped_uniform_knots(n, p))
+    knots[p + 1] = 0.1
+    nurbs = geoalgo.NURBS(p, rng.uniform(-5.0, 5.0, (n, dim)), knots, rng.uniform(0.5, 2.0, n))
+    assert nurbs.dimension == dim and nurbs.domain == (0.0, 1.0)
+    batch = nurbs.evaluate(us)
+    assert batch.shape == (us.size, dim)
+    assert close(batch, scalar_rows(nurbs.evaluate, us))
+    inner = few * 0.98 + 0.01
+    assert close(nurbs.derivative(inner), central_difference(nurbs.evaluate, inner), 1e-6)
+    assert close(nurbs.derivative(us, 0), batch)
+    check_bounds(*geoalgo.exact_bounds(nurbs), nurbs.evaluate(dense), 1e-6)
+
+    # 离散：点在曲线上、参数单调覆盖定义域；超出 max_points 时为整条曲线上的等距采样
+    tess = geoalgo.AdaptiveTessellator(1e-4)
+    points, params = tess.tessellate(nurbs)
+    assert points.shape == (params.size, dim) and params.size > 16
+    assert params[0] == 0.0 and params[-1] == 1.0 and np.all(np.diff(params) > 0)
+    assert close(points, scalar_rows(nurbs.evaluate, params))
+    capped, capped_params = tess.tessellate(nurbs, max_points=16)
+    assert capped.shape == (16, dim)
+    assert close(capped_params, np.linspace(0.0, 1.0, 16))
+    assert close(capped, scalar_rows(nurbs.evaluate, capped_params))
+
+# 非法输入转为 Python 异常
+for bad in (lambda: geoalgo.BezierCurve(np.zeros((3, 3))), lambda: bezier.derivative(few, -1)):
+    try:
+        bad()
+    except ValueError:
+        pass
+    else:
+        raise AssertionError("expected ValueError")
+
+print("✅ Python module test passed!")
@@ -0,0 +1,291 @@
+#include "AdaptiveTessellator.h"
+#include "Instrumentation.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace GeoAlgo {
+
+namespace {
+
+// 显式栈中的一段：齐次控制点及其参数区间
+struct Segment {
+    Vec4d P[AdaptiveTessellator::kMaxDegree + 1];
+    double t0;
+    double t1;
+    int depth;
+};
+
+inline Vec3d project(const Vec4d& h) {
+    return fromHomogeneous<3>(h);
+}
+
+// 点到线段 AB 的距离平方
+inline double squaredDistanceToSegment(const Vec3d& p, const Vec3d& a, const Vec3d& b) {
+    const Vec3d ab = b - a;
+    const double len2 = ab.squaredNorm();
+    if (len2 == 0.0) return p.squaredDistanceTo(a);
+    const double t = std::min(1.0, std::max(0.0, (p - a).dot(ab) / len2));
+    return p.squaredDistanceTo(a + ab * t);
+}
+
+// 控制多边形平坦度：内部控制点到弦的最大距离平方
+inline bool isFlat(const Vec4d* P, int degree, double tol2) {
+    const Vec3d a = project(P[0]);
+    const Vec3d b = project(P[degree]);
+    for (int i = 1; i < degree; ++i)
+        if (squaredDistanceToSegment(project(P[i]), a, b) > tol2) return false;
+    return true;
+}
+
+// 在 u = 0.5 处 de Casteljau 细分
+inline void splitHalf(const Vec4d* P, int degree, Vec4d* left, Vec4d* right) {
+    Vec4d tmp[AdaptiveTessellator::kMaxDegree + 1];
+    std::copy(P, P + degree + 1, tmp);
+    left[0] = tmp[0];
+    right[degree] = tmp[degree];
+    for (int k = 1; k <= degree; ++k) {
+        for (int i = 0; i <= degree - k; ++i) tmp[i] = (tmp[i] + tmp[i + 1]) * 0.5;
+        left[k] = tmp[0];
+        right[degree - k] = tmp[degree - k];
+    }
+}
+
+template <int N>
+inline Vec<double, N> truncate(const Vec3d& p) {
+    return Vec<double, N>::generate([&](int i) { return p[i]; });
+}
+
+// 齐次 Bezier 控制点在 u 处的 de Casteljau 求值
+inline Vec4d evaluateHomogeneousBezier(const Vec4d* P, int degree, double u) {
+    Vec4d tmp[AdaptiveTessellator::kMaxDegree + 1];
+    std::copy(P, P + degree + 1, tmp);
+    for (int k = 1; k <= degree; ++k)
+        for (int i = 0; i <= degree - k; ++i) tmp[i] = tmp[i] * (1.0 - u) + tmp[i + 1] * u;
+    return tmp[0];
+}
+
+constexpr std::size_t kUnlimited = std::numeric_limits<std::size_t>::max();
+
+// 点数超过 limit 时立即停止细分并返回 limit + 1
+template <int N>
+std::size_t tessellateBezier(const Vec4d* Pw, int degree, double t0, double t1,
+                             double tolerance, int maxDepth,
+                             Vec<double, N>* out, std::size_t capacity, double* params,
+                             std::size_t limit = kUnlimited) {
+    if (degree < 0 || degree > AdaptiveTessellator::kMaxDegree)
+        throw std::invalid_argument("AdaptiveTessellator: degree must be in [0, kMaxDegree]");
+
+    std::size_t count = 0;
+    auto emit = [&](const Vec4d& h, double t) {
+        if (count < capacity) {
+            out[count] = truncate<N>(project(h));
+            if (params) params[count] = t;
+        }
+        ++count;
+    };
+
+    const double tol2 = tolerance * tolerance;
+    // 深度优先时栈中最多同时存在 maxDepth + 1 段
+    Segment stack[AdaptiveTessellator::kMaxDepth + 1];
+    int top = 0;
+    std::copy(Pw, Pw + degree + 1, stack[0].P);
+    stack[0].t0 = t0;
+    stack[0].t1 = t1;
+    stack[0].depth = 0;
+    top = 1;
+
+    emit(Pw[0], t0);
+    while (top > 0 && count <= limit) {
+        const Segment& s = stack[top - 1];
+        if (s.depth >= maxDepth || isFlat(s.P, degree, tol2)) {
+            emit(s.P[degree], s.t1);
+            --top;
+            continue;
+        }
+        // 当前段原地替换为右半段，左半段压栈，保证左侧先输出
+        Segment& right = stack[top - 1];
+        Segment& left = stack[top];
+        Vec4d P[AdaptiveTessellator::kMaxDegree + 1];
+        std::copy(right.P, right.P + degree + 1, P);
+        splitHalf(P, degree, left.P, right.P);
+        const double tm = 0.5 * (right.t0 + right.t1);
+        left.t0 = right.t0;
+        left.t1 = tm;
+        right.t0 = tm;
+        left.depth = right.depth = right.depth + 1;
+        ++top;
+    }
+    return count;
+}
+
+// 计数放在每条曲线的公开入口，分段离散（tessellateBounded）只计一次
+std::size_t countCurve(std::size_t points) {
+    GEOALGO_COUNT(Counter::TessellatedCurves);
+    GEOALGO_COUNT_N(Counter::TessellationPoints, points);
+    return points;
+}
+
+} // namespace
+
+AdaptiveTessellator::AdaptiveTessellator(double tolerance, int maxDepth)
+    : tolerance_(tolerance), maxDepth_(maxDepth) {
+    if (!(tolerance > 0.0))
+        throw std::invalid_argument("AdaptiveTessellator: tolerance must be positive");
+    if (maxDepth < 0 || maxDepth > kMaxDepth)
+        throw std::invalid_argument("AdaptiveTessellator: maxDepth must be in [0, kMaxDepth]");
+}
+
+void AdaptiveTessellator::powerToBezier(const Vec3d* coeffs, int degree, double t0, double t1, Vec4d* Pw) {
+    // Taylor 平移：c_k 为 p(t0 + x) 的系数
+    Vec3d c[kMaxDegree + 1];
+    std::copy(coeffs, coeffs + degree + 1, c);
+    for (int k = 0; k < degree; ++k)
+        for (int j = degree - 1; j >= k; --j) c[j] += c[j + 1] * t0;
+    // 缩放到 s ∈ [0,1]：x = (t1 - t0) s
+    const double h = t1 - t0;
+    double hk = 1.0;
+    for (int k = 0; k <= degree; ++k, hk *= h) c[k] *= hk;
+    // 幂基到 Bernstein：b_j = Σ_{i<=j} C(j,i)/C(n,i) c_i
+    for (int j = 0; j <= degree; ++j) {
+        Vec3d b;
+        double cji = 1.0; // C(j,i)
+        double cni = 1.0; // C(n,i)
+        for (int i = 0; i <= j; ++i) {
+            b += c[i] * (cji / cni);
+            cji = cji * (j - i) / (i + 1);
+            cni = cni * (degree - i) / (i + 1);
+        }
+        Pw[j] = toHomogeneous(b, 1.0);
+    }
+}
+
+std::size_t AdaptiveTessellator::tessellate(const BezierCurve& curve,
+                                            Point2D* out, std::size_t capacity, double* params) const {
+    const int n = curve.degree();
+    if (n < 0) return 0;
+    if (n > kMaxDegree)
+        throw std::invalid_argument("AdaptiveTessellator: degree must be in [0, kMaxDegree]");
+    Vec4d Pw[kMaxDegree + 1];
+    for (int i = 0; i <= n; ++i) Pw[i] = toHomogeneous(curve.controlPoints()[i], 1.0);
+    GEOALGO_SCOPED_TIMER(Timer::Tessellation);
+    return countCurve(tessellateBezier<2>(Pw, n, 0.0, 1.0, tolerance_, maxDepth_, out, capacity, params));
+}
+
+std::size_t AdaptiveTessellator::tessellate(const PowerBasisCurve& curve, double t0, double t1,
+                                            Point2D* out, std::size_t capacity, double* params) const {
+    const int n = curve.degree();
+    if (n < 0) return 0;
+    if (n > kMaxDegree)
+        throw std::invalid_argument("AdaptiveTessellator: degree must be in [0, kMaxDegree]");
+    Vec3d c[kMaxDegree + 1];
+    for (int i = 0; i <= n; ++i) c[i] = Vec3d(curve.coefficients()[i].x, curve.coefficients()[i].y, 0.0);
+    Vec4d Pw[kMaxDegree + 1];
+    powerToBezier(c, n, t0, t1, Pw);
+    GEOALGO_SCOPED_TIMER(Timer::Tessellation);
+    return countCurve(tessellateBezier<2>(Pw, n, t0, t1, tolerance_, maxDepth_, out, capacity, params));
+}
+
+std::size_t AdaptiveTessellator::tessellate(const PowerBasisCurve2D& curve, double t0, double t1,
+                                            Point2D* out, std::size_t capacity, double* params) const {
+    const auto& xc = curve.xCurve().coefficients();
+    const auto& yc = curve.yCurve().coefficients();
+    const int n = static_cast<int>(std::max(xc.size(), yc.size())) - 1;
+    if (n < 0) return 0;
+    if (n > kMaxDegree)
+        throw std::invalid_argument("AdaptiveTessellator: degree must be in [0, kMaxDegree]");
+    Vec3d c[kMaxDegree + 1];
+    for (std::size_t i = 0; i < xc.size(); ++i) c[i].x = xc[i];
+    for (std::size_t i = 0; i < yc.size(); ++i) c[i].y = yc[i];
+    Vec4d Pw[kMaxDegree + 1];
+    powerToBezier(c, n, t0, t1, Pw);
+    GEOALGO_SCOPED_TIMER(Timer::Tessellation);
+    return countCurve(tessellateBezier<2>(Pw, n, t0, t1, tolerance_, maxDepth_, out, capacity, params));
+}
+
+std::size_t AdaptiveTessellator::tessellate(const PowerBasisCurve3D& curve, double t0, double t1,
+                                            Vec3d* out, std::size_t capacity, double* params) const {
+    const auto& xc = curve.xCurve().coefficients();
+    const auto& yc = curve.yCurve().coefficients();
+    const auto& zc = curve.zCurve().coefficients();
+    const int n = static_cast<int>(std::max({xc.size(), yc.size(), zc.size()})) - 1;
+    if (n < 0) return 0;
+    if (n > kMaxDegree)
+        throw std::invalid_argument("AdaptiveTessellator: degree must be in [0, kMaxDegree]");
+    Vec3d c[kMaxDegree + 1];
+    for (std::size_t i = 0; i < xc.size(); ++i) c[i].x = xc[i];
+    for (std::size_t i = 0; i < yc.size(); ++i) c[i].y = yc[i];
+    for (std::size_t i = 0; i < zc.size(); ++i) c[i].z = zc[i];
+    Vec4d Pw[kMaxDegree + 1];
+    powerToBezier(c, n, t0, t1, Pw);
+    GEOALGO_SCOPED_TIMER(Timer::Tessellation);
+    return countCurve(tessellateBezier<3>(Pw, n, t0, t1, tolerance_, maxDepth_, out, capacity, params));
+}
+
+template <int N>
+std::size_t AdaptiveTessellator::tessellateHomogeneous(const Vec4d* Pw, int degree,
+                                                       Vec<double, N>* out, std::size_t capacity,
+                                                       double* params) const {
+    GEOALGO_SCOPED_TIMER(Timer::Tessellation);
+    return countCurve(tessellateBezier<N>(Pw, degree, 0.0, 1.0, tolerance_, maxDepth_, out, capacity, params));
+}
+
+std::size_t AdaptiveTessellator::tessellateBounded(const NURBS& curve, Vec3d* out, std::size_t capacity,
+                                                   double* params, bool* truncated) const {
+    const int p = curve.degree();
+    if (p > kMaxDegree)
+        throw std::invalid_argument("AdaptiveTessellator: degree must be in [0, kMaxDegree]");
+    const int segs = curve.numBezierSegments();
+    std::vector<Vec4d> Pw(static_cast<std::size_t>(segs) * (p + 1));
+    std::vector<double> breaks(segs + 1);
+    curve.decomposeToBezier(Pw.data(), breaks.data());
+    return tessellateBounded(Pw.data(), p, breaks.data(), segs, out, capacity, params, truncated);
+}
+
+std::size_t AdaptiveTessellator::tessellateBounded(const Vec4d* Pw, int degree, const double* breaks,
+                                                   int numSegments, Vec3d* out, std::size_t capacity,
+                                                   double* params, bool* truncated) const {
+    if (degree < 0 || degree > kMaxDegree)
+        throw std::invalid_argument("AdaptiveTessellator: degree must be in [0, kMaxDegree]");
+    if (numSegments < 1)
+        throw std::invalid_argument("AdaptiveTessellator: numSegments must be positive");
+    if (capacity < 2)
+        throw std::invalid_argument("AdaptiveTessellator: capacity must be at least 2");
+    GEOALGO_SCOPED_TIMER(Timer::Tessellation);
+    const std::size_t order = static_cast<std::size_t>(degree) + 1;
+    if (truncated) *truncated = false;
+
+    // 逐段离散，后一段的首点覆盖前一段的末点；任一段超出剩余容量即放弃
+    std::size_t count = 0;
+    bool overflow = false;
+    for (int s = 0; s < numSegments && !overflow; ++s) {
+        const std::size_t at = s == 0 ? 0 : count - 1;
+        const std::size_t room = capacity - at;
+        const std::size_t n = tessellateBezier<3>(Pw + s * order, degree, breaks[s], breaks[s + 1], tolerance_,
+                                                  maxDepth_, out + at, room, params ? params + at : nullptr, room);
+        overflow = n > room;
+        count = at + n;
+    }
+    if (!overflow) return countCurve(count);
+
+    // 回退：整个定义域上 capacity 个等距参数，保证输出覆盖整条曲线
+    const double a = breaks[0];
+    const double b = breaks[numSegments];
+    int s = 0;
+    for (std::size_t k = 0; k < capacity; ++k) {
+        const double u = k + 1 == capacity ? b : a + (b - a) * static_cast<double>(k) / static_cast<double>(capacity - 1);
+        while (s + 1 < numSegments && u >= breaks[s + 1]) ++s;
+        const double b0 = breaks[s], b1 = breaks[s + 1];
+        const double local = b1 > b0 ? std::min(1.0, std::max(0.0, (u - b0) / (b1 - b0))) : 0.0;
+        out[k] = project(evaluateHomogeneousBezier(Pw + s * order, degree, local));
+        if (params) params[k] = u;
+    }
+    if (truncated) *truncated = true;
+    return countCurve(capacity);
+}
+
+template std::size_t AdaptiveTessellator::tessellateHomogeneous<2>(const Vec4d*, int, Vec2d*, std::size_t, double*) const;
+template std::size_t AdaptiveTessellator::tessellateHomogeneous<3>(const Vec4d*, int, Vec3d*, std::size_t, double*) const;
+
+} // namespace GeoAlgo
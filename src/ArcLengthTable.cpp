@@ -0,0 +1,113 @@
+#include "ArcLengthTable.h"
+#include "Instrumentation.h"
+#include <limits>
+#include <stdexcept>
+
+namespace GeoAlgo {
+
+namespace {
+
+constexpr int kInitialSplits = 4;  // 每个原始区间先等分的份数
+constexpr int kMaxBuildDepth = 30;
+
+double gauss(const std::function<double(double)>& speed, double a, double b) {
+    const double h = 0.5 * (b - a);
+    const double m = 0.5 * (a + b);
+    double sum = 0.0;
+    for (int i = 0; i < 8; ++i) sum += detail::kGaussWeights[i] * speed(m + h * detail::kGaussNodes[i]);
+    return sum * h;
+}
+
+} // namespace
+
+ArcLengthTable::ArcLengthTable(const BezierCurve& curve, double tolerance) {
+    if (curve.degree() < 0) throw std::invalid_argument("ArcLengthTable: empty Bezier curve");
+    build([&](double t) { return detail::arcSpeed(curve, t); }, {0.0, 1.0}, tolerance);
+}
+
+ArcLengthTable::ArcLengthTable(const PowerBasisCurve2D& curve, double t0, double t1, double tolerance) {
+    if (!(t1 > t0)) throw std::invalid_argument("ArcLengthTable: t1 must be greater than t0");
+    build([&](double t) { return detail::arcSpeed(curve, t); }, {t0, t1}, tolerance);
+}
+
+ArcLengthTable::ArcLengthTable(const PowerBasisCurve3D& curve, double t0, double t1, double tolerance) {
+    if (!(t1 > t0)) throw std::invalid_argument("ArcLengthTable: t1 must be greater than t0");
+    build([&](double t) { return detail::arcSpeed(curve, t); }, {t0, t1}, tolerance);
+}
+
+ArcLengthTable::ArcLengthTable(const NURBS& curve, double tolerance) {
+    // 节点处导数可能不连续，以不重复的节点作为断点
+    std::vector<double> breaks;
+    const std::vector<double>& U = curve.knots();
+    for (int i = curve.degree(); i <= curve.numControlPoints(); ++i)
+        if (breaks.empty() || U[i] > breaks.back()) breaks.push_back(U[i]);
+    if (breaks.size() < 2) throw std::invalid_argument("ArcLengthTable: NURBS has an empty domain");
+    build([&](double t) { return detail::arcSpeed(curve, t); }, breaks, tolerance);
+}
+
+void ArcLengthTable::build(const std::function<double(double)>& speed, const std::vector<double>& breaks,
+                           double tolerance) {
+    if (!(tolerance > 0.0)) throw std::invalid_argument("ArcLengthTable: tolerance must be positive");
+    GEOALGO_SCOPED_TIMER(Timer::ArcLengthBuild);
+
+    // 先粗估总弧长，得到绝对容差
+    double estimate = 0.0;
+    for (std::size_t i = 0; i + 1 < breaks.size(); ++i) estimate += gauss(speed, breaks[i], breaks[i + 1]);
+    const double absTol = tolerance * std::max(estimate, std::numeric_limits<double>::min());
+
+    struct Range {
+        double a, b, whole;
+        int depth;
+    };
+    std::vector<Range> stack;
+    t_.assign(1, breaks.front());
+    s_.assign(1, 0.0);
+    for (std::size_t i = 0; i + 1 < breaks.size(); ++i) {
+        const double a0 = breaks[i];
+        const double h = (breaks[i + 1] - a0) / kInitialSplits;
+        for (int j = 0; j < kInitialSplits; ++j) {
+            const double a = a0 + h * j;
+            const double b = j + 1 == kInitialSplits ? breaks[i + 1] : a + h;
+            stack.push_back({a, b, gauss(speed, a, b), 0});
+            // 左半先出栈，区间按参数顺序追加
+            while (!stack.empty()) {
+                const Range r = stack.back();
+                stack.pop_back();
+                const double mid = 0.5 * (r.a + r.b);
+                const double left = gauss(speed, r.a, mid);
+                const double right = gauss(speed, mid, r.b);
+                const double width = (r.b - r.a) / (breaks.back() - breaks.front());
+                if (std::fabs(left + right - r.whole) <= absTol * width || r.depth >= kMaxBuildDepth) {
+                    t_.push_back(r.b);
+                    s_.push_back(s_.back() + left + right);
+                } else {
+                    stack.push_back({mid, r.b, right, r.depth + 1});
+                    stack.push_back({r.a, mid, left, r.depth + 1});
+                }
+            }
+        }
+    }
+    tol_ = absTol;
+
+    // 弧长均匀分桶，每桶记录桶起点所在的区间
+    const std::size_t M = t_.size() - 1;
+    const double L = s_.back();
+    bucket_.resize(M);
+    std::size_t k = 0;
+    for (std::size_t b = 0; b < M; ++b) {
+        const double target = L * static_cast<double>(b) / M;
+        while (k + 1 < M && s_[k + 1] < target) ++k;
+        bucket_[b] = static_cast<std::uint32_t>(k);
+    }
+}
+
+std::size_t ArcLengthTable::locate(double s) const {
+    const std::size_t M = t_.size() - 1;
+    const double L = s_.back();
+    if (!(L > 0.0)) return 0;
+    std::size_t k = bucket_[std::min(M - 1, static_cast<std::size_t>(s / L * M))];
+    while (k + 1 < M && s_[k + 1] < s) ++k;
+    return k;
+}
+
+} // namespace GeoAlgo
@@ -0,0 +1,96 @@
+#include "BandedMatrix.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace GeoAlgo {
+
+BandedMatrix::BandedMatrix(int n, int lower, int upper) : n_(n), lower_(lower), upper_(upper) {
+    if (n < 0 || lower < 0 || upper < 0)
+        throw std::invalid_argument("BandedMatrix: size and bandwidths must be non-negative");
+    a_.assign(static_cast<std::size_t>(n) * (lower + upper + 1), 0.0);
+}
+
+void BandedMatrix::setZero() {
+    std::fill(a_.begin(), a_.end(), 0.0);
+    factor_ = Factor::None;
+}
+
+void BandedMatrix::factorLU() {
+    if (factor_ != Factor::None) throw std::invalid_argument("BandedMatrix: matrix is already factored");
+    BandedMatrix& A = *this;
+    for (int k = 0; k < n_; ++k) {
+        const double pivot = A(k, k);
+        if (pivot == 0.0 || !std::isfinite(pivot)) throw std::runtime_error("BandedMatrix: zero pivot in LU factorization");
+        const int iEnd = std::min(n_ - 1, k + lower_);
+        const int jEnd = std::min(n_ - 1, k + upper_);
+        for (int i = k + 1; i <= iEnd; ++i) {
+            const double l = A(i, k) / pivot;
+            A(i, k) = l;
+            if (l == 0.0) continue;
+            for (int j = k + 1; j <= jEnd; ++j) A(i, j) -= l * A(k, j);
+        }
+    }
+    factor_ = Factor::LU;
+}
+
+void BandedMatrix::factorCholesky() {
+    if (factor_ != Factor::None) throw std::invalid_argument("BandedMatrix: matrix is already factored");
+    BandedMatrix& A = *this;
+    // 按列计算 L，覆盖下三角；第 j 列只影响其下方 lower 行
+    for (int j = 0; j < n_; ++j) {
+        const int k0 = std::max(0, j - lower_);
+        double d = A(j, j);
+        for (int k = k0; k < j; ++k) d -= A(j, k) * A(j, k);
+        if (!(d > 0.0)) throw std::runtime_error("BandedMatrix: matrix is not positive definite");
+        const double ljj = std::sqrt(d);
+        A(j, j) = ljj;
+        const int iEnd = std::min(n_ - 1, j + lower_);
+        for (int i = j + 1; i <= iEnd; ++i) {
+            double s = A(i, j);
+            for (int k = std::max(k0, i - lower_); k < j; ++k) s -= A(i, k) * A(j, k);
+            A(i, j) = s / ljj;
+        }
+    }
+    factor_ = Factor::Cholesky;
+}
+
+void BandedMatrix::solve(double* B, int nrhs) const {
+    if (factor_ == Factor::None) throw std::invalid_argument("BandedMatrix: solve() requires a factored matrix");
+    const BandedMatrix& A = *this;
+    auto row = [&](int i) { return B + static_cast<std::size_t>(i) * nrhs; };
+
+    // 前代：L y = b（LU 时 L 为单位下三角）
+    for (int i = 0; i < n_; ++i) {
+        double* bi = row(i);
+        for (int k = std::max(0, i - lower_); k < i; ++k) {
+            const double l = A(i, k);
+            const double* bk = row(k);
+            for (int c = 0; c < nrhs; ++c) bi[c] -= l * bk[c];
+        }
+        if (factor_ == Factor::Cholesky)
+            for (int c = 0; c < nrhs; ++c) bi[c] /= A(i, i);
+    }
+
+    // 回代：U x = y，Cholesky 时 U = Lᵀ
+    for (int i = n_ - 1; i >= 0; --i) {
+        double* bi = row(i);
+        if (factor_ == Factor::LU) {
+            for (int j = i + 1; j <= std::min(n_ - 1, i + upper_); ++j) {
+                const double u = A(i, j);
+                const double* bj = row(j);
+                for (int c = 0; c < nrhs; ++c) bi[c] -= u * bj[c];
+            }
+        } else {
+            for (int j = i + 1; j <= std::min(n_ - 1, i + lower_); ++j) {
+                const double u = A(j, i);
+                const double* bj = row(j);
+                for (int c = 0; c < nrhs; ++c) bi[c] -= u * bj[c];
+            }
+        }
+        const double d = A(i, i);
+        for (int c = 0; c < nrhs; ++c) bi[c] /= d;
+    }
+}
+
+} // namespace GeoAlgo
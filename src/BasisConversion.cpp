@@ -0,0 +1,168 @@
+#include "BasisConversion.h"
+#include "CurveKernels.h"
+#include "Instrumentation.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace GeoAlgo {
+
+namespace {
+
+constexpr std::size_t kConversionGrain = 256;
+
+// 各次数的两个转换矩阵连续存放
+struct ConversionTables {
+    std::vector<double> toPower;
+    std::vector<double> toBezier;
+    std::size_t offset[kMaxConversionDegree + 2];
+
+    ConversionTables() {
+        offset[0] = 0;
+        for (int n = 0; n <= kMaxConversionDegree; ++n)
+            offset[n + 1] = offset[n] + static_cast<std::size_t>(n + 1) * (n + 1);
+        toPower.assign(offset[kMaxConversionDegree + 1], 0.0);
+        toBezier.assign(offset[kMaxConversionDegree + 1], 0.0);
+        for (int n = 0; n <= kMaxConversionDegree; ++n) {
+            double* P = toPower.data() + offset[n];
+            double* B = toBezier.data() + offset[n];
+            const double* Cn = binomialTableRow(n);
+            for (int i = 0; i <= n; ++i) {
+                const double* Ci = binomialTableRow(i);
+                for (int j = 0; j <= i; ++j) {
+                    P[i * (n + 1) + j] = ((i - j) % 2 ? -1.0 : 1.0) * Cn[i] * Ci[j];
+                    // b_i = Σ_{j<=i} C(i,j)/C(n,j) a_j
+                    B[i * (n + 1) + j] = Ci[j] / Cn[j];
+                }
+            }
+        }
+    }
+};
+
+const ConversionTables& tables() {
+    static const ConversionTables t;
+    return t;
+}
+
+void checkDegree(int degree) {
+    if (degree < 0 || degree > kMaxConversionDegree)
+        throw std::invalid_argument("BasisConversion: degree must be in [0, kMaxConversionDegree]");
+}
+
+// out[i] = Σ_{j<=i} M[i][j] in[j]
+template <typename T>
+void applyLower(const double* M, int n, const T* in, T* out) {
+    for (int i = 0; i <= n; ++i) {
+        const double* row = M + i * (n + 1);
+        T acc = in[0] * row[0];
+        for (int j = 1; j <= i; ++j) acc += in[j] * row[j];
+        out[i] = acc;
+    }
+}
+
+void applyLower(const double* M, int n, int dim, const double* in, double* out) {
+    for (int i = 0; i <= n; ++i) {
+        const double* row = M + i * (n + 1);
+        for (int d = 0; d < dim; ++d) {
+            double acc = 0.0;
+            for (int j = 0; j <= i; ++j) acc += in[j * dim + d] * row[j];
+            out[i * dim + d] = acc;
+        }
+    }
+}
+
+std::vector<Point2D> convert(const double* M, const std::vector<Point2D>& in) {
+    GEOALGO_COUNT(Counter::BasisConversions);
+    std::vector<Point2D> out(in.size());
+    if (!in.empty()) applyLower(M, static_cast<int>(in.size()) - 1, in.data(), out.data());
+    return out;
+}
+
+template <typename Fn>
+void forEachBlock(std::size_t count, ThreadPool& pool, Fn&& fn) {
+    const std::size_t numTasks = (count + kConversionGrain - 1) / kConversionGrain;
+    pool.parallelFor(numTasks, [&](std::size_t task) {
+        const std::size_t end = std::min(count, (task + 1) * kConversionGrain);
+        for (std::size_t i = task * kConversionGrain; i < end; ++i) fn(i);
+    });
+}
+
+} // namespace
+
+const double* bezierToPowerMatrix(int degree) {
+    checkDegree(degree);
+    return tables().toPower.data() + tables().offset[degree];
+}
+
+const double* powerToBezierMatrix(int degree) {
+    checkDegree(degree);
+    return tables().toBezier.data() + tables().offset[degree];
+}
+
+void bezierToPower(const double* bezier, int degree, int dim, double* power) {
+    GEOALGO_COUNT(Counter::BasisConversions);
+    applyLower(bezierToPowerMatrix(degree), degree, dim, bezier, power);
+}
+
+void powerToBezier(const double* power, int degree, int dim, double* bezier) {
+    GEOALGO_COUNT(Counter::BasisConversions);
+    applyLower(powerToBezierMatrix(degree), degree, dim, power, bezier);
+}
+
+PowerBasisCurve toPowerBasis(const BezierCurve& curve) {
+    if (curve.degree() < 0) return PowerBasisCurve();
+    return PowerBasisCurve(convert(bezierToPowerMatrix(curve.degree()), curve.controlPoints()));
+}
+
+PowerBasisCurve2D toPowerBasis2D(const BezierCurve& curve) {
+    const std::vector<Point2D> a = toPowerBasis(curve).coefficients();
+    std::vector<double> xs(a.size()), ys(a.size());
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        xs[i] = a[i].x;
+        ys[i] = a[i].y;
+    }
+    return PowerBasisCurve2D(xs, ys);
+}
+
+BezierCurve toBezier(const PowerBasisCurve& curve) {
+    if (curve.degree() < 0) return BezierCurve();
+    return BezierCurve(convert(powerToBezierMatrix(curve.degree()), curve.coefficients()));
+}
+
+BezierCurve toBezier(const PowerBasisCurve2D& curve) {
+    const std::vector<double>& xc = curve.xCurve().coefficients();
+    const std::vector<double>& yc = curve.yCurve().coefficients();
+    std::vector<Point2D> a(std::max(xc.size(), yc.size()));
+    for (std::size_t i = 0; i < xc.size(); ++i) a[i].x = xc[i];
+    for (std::size_t i = 0; i < yc.size(); ++i) a[i].y = yc[i];
+    return toBezier(PowerBasisCurve(a));
+}
+
+PowerBasisCurve1D toPowerBasis1D(const std::vector<double>& bezierValues) {
+    std::vector<double> a(bezierValues.size());
+    if (!a.empty()) bezierToPower(bezierValues.data(), static_cast<int>(a.size()) - 1, 1, a.data());
+    return PowerBasisCurve1D(a);
+}
+
+std::vector<double> toBezierValues(const PowerBasisCurve1D& curve) {
+    const std::vector<double>& a = curve.coefficients();
+    std::vector<double> b(a.size());
+    if (!b.empty()) powerToBezier(a.data(), curve.degree(), 1, b.data());
+    return b;
+}
+
+void toPowerBasis(const BezierCurve* curves, std::size_t count, PowerBasisCurve* out, ThreadPool& pool) {
+    GEOALGO_SCOPED_TIMER(Timer::BasisConversion);
+    forEachBlock(count, pool, [&](std::size_t i) { out[i] = toPowerBasis(curves[i]); });
+}
+
+void toPowerBasis2D(const BezierCurve* curves, std::size_t count, PowerBasisCurve2D* out, ThreadPool& pool) {
+    GEOALGO_SCOPED_TIMER(Timer::BasisConversion);
+    forEachBlock(count, pool, [&](std::size_t i) { out[i] = toPowerBasis2D(curves[i]); });
+}
+
+void toBezier(const PowerBasisCurve* curves, std::size_t count, BezierCurve* out, ThreadPool& pool) {
+    GEOALGO_SCOPED_TIMER(Timer::BasisConversion);
+    forEachBlock(count, pool, [&](std::size_t i) { out[i] = toBezier(curves[i]); });
+}
+
+} // namespace GeoAlgo
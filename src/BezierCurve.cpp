@@ -1,8 +1,53 @@
 #include "BezierCurve.h"
-#include <cmath>
+#include "BasisConversion.h"
+#include "Instrumentation.h"
+#include "PowerBasisKernel.h"
+#include <algorithm>
 
 namespace GeoAlgo {
 
+namespace {
+
+constexpr std::size_t kPowerBlock = 256;
+
+// Bernstein 形式的 Horner 递推，scaled[i] = C(n,i) * P_i
+inline Point2D bernsteinHorner(const Point2D* scaled, int n, double u) {
+    const double s = 1.0 - u;
+    double ui = 1.0;
+    Point2D result = scaled[0];
+    for (int i = 1; i <= n; ++i) {
+        ui *= u;
+        result = result * s + scaled[i] * ui;
+    }
+    return result;
+}
+
+} // namespace
+
+BezierCurve::BezierCurve(const std::vector<Point2D>& controlPoints)
+    : ctrlPoints(controlPoints) {
+    int n = degree();
+    scaledPoints.reserve(ctrlPoints.size());
+    for (int i = 0; i <= n; ++i)
+        scaledPoints.push_back(ctrlPoints[i] * binomial(n, i));
+
+    // 逐阶差分：D 为 j 阶导数控制点 n!/(n-j)! * Δ^j P_i
+    if (n >= 1) scaledHodographs.reserve(static_cast<std::size_t>(n) * (n + 1) / 2);
+    std::vector<Point2D> D = ctrlPoints;
+    for (int j = 1; j <= n; ++j) {
+        const int m = n - j;
+        for (int i = 0; i <= m; ++i) D[i] = (D[i + 1] - D[i]) * static_cast<double>(m + 1);
+        for (int i = 0; i <= m; ++i) scaledHodographs.push_back(D[i] * binomial(m, i));
+    }
+}
+
+std::size_t BezierCurve::hodographOffset(int j) const {
+    // Σ_{m=1}^{j-1} (n-m+1)
+    const std::size_t n = static_cast<std::size_t>(degree());
+    const std::size_t k = static_cast<std::size_t>(j - 1);
+    return k * (n + 1) - k * (k + 1) / 2;
+}
+
 double BezierCurve::binomial(int n, int i) {
     if (i < 0 || i > n) return 0;
     double res = 1;
@@ -12,13 +57,88 @@ double BezierCurve::binomial(int n, int i) {
 }
 
 Point2D BezierCurve::evaluate(double u) const {
-    int n = static_cast<int>(ctrlPoints.size()) - 1;
-    Point2D result(0, 0);
+    GEOALGO_COUNT(Counter::BezierEvaluations);
+    if (scaledPoints.empty()) return Point2D(0, 0);
+    return bernsteinHorner(scaledPoints.data(), degree(), u);
+}
+
+void BezierCurve::evaluateMany(const double* us, std::size_t count, Point2D* out) const {
+    if (!powerPacked.empty()) {
+        // 分块走 SoA 内核，再交错写回
+        double xs[kPowerBlock], ys[kPowerBlock];
+        for (std::size_t k0 = 0; k0 < count; k0 += kPowerBlock) {
+            const std::size_t len = std::min(kPowerBlock, count - k0);
+            evaluateMany(us + k0, len, xs, ys);
+            for (std::size_t k = 0; k < len; ++k) out[k0 + k] = Point2D(xs[k], ys[k]);
+        }
+        return;
+    }
+    GEOALGO_COUNT_N(Counter::BezierEvaluations, count);
+    if (scaledPoints.empty()) {
+        for (std::size_t k = 0; k < count; ++k) out[k] = Point2D(0, 0);
+        return;
+    }
+    const Point2D* scaled = scaledPoints.data();
+    const int n = degree();
+    for (std::size_t k = 0; k < count; ++k)
+        out[k] = bernsteinHorner(scaled, n, us[k]);
+}
+
+void BezierCurve::evaluateMany(const double* us, std::size_t count, double* xs, double* ys) const {
+    GEOALGO_COUNT_N(Counter::BezierEvaluations, count);
+    if (!powerPacked.empty()) {
+        double* outs[2] = {xs, ys};
+        evaluatePowerBasisSoA(powerPacked.data(), 2, degree() + 1, us, count, outs);
+        return;
+    }
+    const Point2D* scaled = scaledPoints.data();
+    const int n = degree();
+    for (std::size_t k = 0; k < count; ++k) {
+        const Point2D p = n < 0 ? Point2D(0, 0) : bernsteinHorner(scaled, n, us[k]);
+        xs[k] = p.x;
+        ys[k] = p.y;
+    }
+}
+
+void BezierCurve::cachePowerBasis() {
+    const int n = degree();
+    if (n < 0) return;
+    const std::vector<Point2D> a = toPowerBasis(*this).coefficients();
+    powerPacked.assign(2 * a.size(), 0.0);
     for (int i = 0; i <= n; ++i) {
-        double coeff = binomial(n, i) * std::pow(1 - u, n - i) * std::pow(u, i);
-        result = result + ctrlPoints[i] * coeff;
+        powerPacked[i] = a[i].x;
+        powerPacked[n + 1 + i] = a[i].y;
     }
-    return result;
+}
+
+Point2D BezierCurve::derivative(double u, int order) const {
+    const int n = degree();
+    if (order == 0) return evaluate(u);
+    if (order < 0 || order > n) return Point2D(0, 0);
+    GEOALGO_COUNT(Counter::BezierEvaluations);
+    return bernsteinHorner(scaledHodographs.data() + hodographOffset(order), n - order, u);
+}
+
+void BezierCurve::evaluateDerivatives(double u, int k, Point2D* out) const {
+    const int n = degree();
+    out[0] = evaluate(u);
+    for (int j = 1; j <= k; ++j)
+        out[j] = (j > n) ? Point2D(0, 0)
+                         : bernsteinHorner(scaledHodographs.data() + hodographOffset(j), n - j, u);
+}
+
+void BezierCurve::evaluateDerivativesMany(const double* us, std::size_t count, int k, Point2D* out) const {
+    for (std::size_t i = 0; i < count; ++i)
+        evaluateDerivatives(us[i], k, out + i * (k + 1));
+}
+
+BezierCurve BezierCurve::hodograph() const {
+    GEOALGO_COUNT(Counter::DerivativeConstructions);
+    const int n = degree();
+    if (n < 1) return BezierCurve(std::vector<Point2D>{Point2D(0, 0)});
+    std::vector<Point2D> D(n);
+    for (int i = 0; i < n; ++i) D[i] = (ctrlPoints[i + 1] - ctrlPoints[i]) * static_cast<double>(n);
+    return BezierCurve(D);
 }
 
 } // namespace GeoAlgo
@@ -0,0 +1,132 @@
+#include "BezierSegments.h"
+#include "CurveKernels.h"
+#include "Instrumentation.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace GeoAlgo {
+
+namespace {
+
+constexpr std::size_t kDecomposeGrain = 64;
+// 顺序推进段时最多线性前进的步数，超过后改用二分
+constexpr std::size_t kMaxWalkSteps = 8;
+// 多项式曲线分解后权重只有舍入误差
+constexpr double kWeightTolerance = 1e-12;
+
+} // namespace
+
+BezierSegments::BezierSegments(const NURBS* curves, std::size_t count, ThreadPool& pool)
+    : curveOffset_(count + 1, 0), dims_(count) {
+    GEOALGO_SCOPED_TIMER(Timer::BezierDecomposition);
+    for (std::size_t c = 0; c < count; ++c) {
+        curveOffset_[c + 1] = curveOffset_[c] + curves[c].numBezierSegments();
+        dims_[c] = curves[c].dimension();
+    }
+    segmentOffset_.resize(numSegments() + 1);
+    segmentOffset_[0] = 0;
+    for (std::size_t c = 0; c < count; ++c) {
+        const std::size_t order = curves[c].degree() + 1;
+        for (std::size_t s = curveBegin(c); s < curveEnd(c); ++s) segmentOffset_[s + 1] = segmentOffset_[s] + order;
+    }
+    points_.resize(segmentOffset_.back());
+    breaks_.resize(numSegments() + count);
+
+    const std::size_t numTasks = (count + kDecomposeGrain - 1) / kDecomposeGrain;
+    pool.parallelFor(numTasks, [&](std::size_t task) {
+        const std::size_t end = std::min(count, (task + 1) * kDecomposeGrain);
+        for (std::size_t c = task * kDecomposeGrain; c < end; ++c)
+            curves[c].decomposeToBezier(points_.data() + segmentOffset_[curveBegin(c)],
+                                        breaks_.data() + curveBegin(c) + c);
+    });
+}
+
+Vec4d BezierSegments::evaluateHomogeneous(std::size_t segment, double t) const {
+    // Bernstein 形式的 Horner 递推
+    const Vec4d* P = controlPoints(segment);
+    const int n = degree(segment);
+    const double* C = binomialTableRow(n);
+    const double s = 1.0 - t;
+    double ti = 1.0;
+    Vec4d r = P[0];
+    for (int i = 1; i <= n; ++i) {
+        ti *= t;
+        r = r * s + P[i] * (C[i] * ti);
+    }
+    return r;
+}
+
+std::size_t BezierSegments::curveOf(std::size_t segment) const {
+    return static_cast<std::size_t>(std::upper_bound(curveOffset_.begin(), curveOffset_.end(), segment) -
+                                    curveOffset_.begin()) - 1;
+}
+
+std::size_t BezierSegments::locate(std::size_t curve, double u) const {
+    const double* B = breaks(curve);
+    const std::size_t n = numSegments(curve);
+    return static_cast<std::size_t>(std::upper_bound(B + 1, B + n, u) - (B + 1));
+}
+
+Vec3d BezierSegments::evaluate(std::size_t curve, double u) const {
+    const double* B = breaks(curve);
+    const std::size_t n = numSegments(curve);
+    u = std::clamp(u, B[0], B[n]);
+    const std::size_t k = locate(curve, u);
+    const double t = (u - B[k]) / (B[k + 1] - B[k]);
+    return fromHomogeneous<3>(evaluateHomogeneous(curveBegin(curve) + k, t));
+}
+
+void BezierSegments::evaluateMany(std::size_t curve, const double* us, std::size_t count, Vec3d* out) const {
+    if (count == 0) return;
+    const double* B = breaks(curve);
+    const std::size_t n = numSegments(curve);
+    const std::size_t first = curveBegin(curve);
+    std::size_t k = locate(curve, std::clamp(us[0], B[0], B[n]));
+    for (std::size_t i = 0; i < count; ++i) {
+        const double u = std::clamp(us[i], B[0], B[n]);
+        if (u < B[k]) {
+            k = locate(curve, u);
+        } else {
+            std::size_t step = 0;
+            while (k + 1 < n && u >= B[k + 1]) {
+                if (++step > kMaxWalkSteps) {
+                    k = locate(curve, u);
+                    break;
+                }
+                ++k;
+            }
+        }
+        const double t = (u - B[k]) / (B[k + 1] - B[k]);
+        out[i] = fromHomogeneous<3>(evaluateHomogeneous(first + k, t));
+    }
+}
+
+RationalBezierCurve BezierSegments::rationalBezier(std::size_t segment) const {
+    const Vec4d* P = controlPoints(segment);
+    const int n = degree(segment);
+    std::vector<double> weights(n + 1);
+    for (int i = 0; i <= n; ++i) weights[i] = P[i].w;
+    if (dimension(curveOf(segment)) == 3) {
+        std::vector<Vec3d> pts(n + 1);
+        for (int i = 0; i <= n; ++i) pts[i] = fromHomogeneous<3>(P[i]);
+        return RationalBezierCurve(pts, weights);
+    }
+    std::vector<Point2D> pts(n + 1);
+    for (int i = 0; i <= n; ++i) pts[i] = fromHomogeneous<2>(P[i]);
+    return RationalBezierCurve(pts, weights);
+}
+
+BezierCurve BezierSegments::bezier(std::size_t segment) const {
+    const Vec4d* P = controlPoints(segment);
+    const int n = degree(segment);
+    std::vector<Point2D> pts(n + 1);
+    for (int i = 0; i <= n; ++i) {
+        if (std::fabs(P[i].w - P[0].w) > kWeightTolerance * P[0].w)
+            throw std::invalid_argument("BezierSegments: segment is rational");
+        pts[i] = fromHomogeneous<2>(P[i]);
+    }
+    return BezierCurve(pts);
+}
+
+} // namespace GeoAlgo
@@ -0,0 +1,457 @@
+#include "CurveBVH.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace GeoAlgo {
+
+namespace {
+
+constexpr double kFlatness = 1e-3;
+
+void checkCurve(const BezierCurve& curve) {
+    if (curve.degree() < 0) throw std::invalid_argument("CurveBVH: empty Bezier curve");
+}
+
+void checkCurve(const NURBS& curve) {
+    if (curve.dimension() != 2) throw std::invalid_argument("CurveBVH: NURBS must be two-dimensional");
+    for (const Vec4d& h : curve.homogeneousPoints())
+        if (!(h.w > 0.0)) throw std::invalid_argument("CurveBVH: NURBS weights must be positive");
+}
+
+// 控制多边形近似直线且沿弦方向单调，此时子段上距离函数近似单峰，可直接交给 Newton
+bool isFlat(const Point2D* P, int n) {
+    if (n <= 1) return true;
+    const Point2D chord = P[n] - P[0];
+    const double L2 = chord.squaredNorm();
+    if (!(L2 > 0.0)) return false;
+    for (int i = 1; i < n; ++i) {
+        const Point2D v = P[i] - P[0];
+        const double cross = v.x * chord.y - v.y * chord.x;
+        if (cross * cross > kFlatness * kFlatness * L2 * L2) return false;
+        const double t = v.dot(chord);
+        if (t < 0.0 || t > L2) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int CurveBVH::add(const BezierCurve& curve) {
+    checkCurve(curve);
+    Entry e;
+    e.bezier = std::make_unique<BezierCurve>(curve);
+    e.degree = curve.degree();
+    return addEntry(std::move(e));
+}
+
+int CurveBVH::add(const NURBS& curve) {
+    checkCurve(curve);
+    Entry e;
+    e.nurbs = std::make_unique<NURBS>(curve);
+    e.degree = curve.degree();
+    return addEntry(std::move(e));
+}
+
+int CurveBVH::addEntry(Entry entry) {
+    const int id = static_cast<int>(entries_.size());
+    entries_.push_back(std::move(entry));
+    buildLeaves(id);
+    ++numCurves_;
+    return id;
+}
+
+void CurveBVH::update(int id, const BezierCurve& curve) {
+    entry(id);
+    checkCurve(curve);
+    dropLeaves(id);
+    Entry& e = entries_[id];
+    e.nurbs.reset();
+    e.bezier = std::make_unique<BezierCurve>(curve);
+    e.degree = curve.degree();
+    buildLeaves(id);
+}
+
+void CurveBVH::update(int id, const NURBS& curve) {
+    entry(id);
+    checkCurve(curve);
+    dropLeaves(id);
+    Entry& e = entries_[id];
+    e.bezier.reset();
+    e.nurbs = std::make_unique<NURBS>(curve);
+    e.degree = curve.degree();
+    buildLeaves(id);
+}
+
+void CurveBVH::remove(int id) {
+    entry(id);
+    dropLeaves(id);
+    entries_[id].bezier.reset();
+    entries_[id].nurbs.reset();
+    --numCurves_;
+}
+
+bool CurveBVH::contains(int id) const {
+    return id >= 0 && id < static_cast<int>(entries_.size()) &&
+           (entries_[id].bezier || entries_[id].nurbs);
+}
+
+const CurveBVH::Entry& CurveBVH::entry(int id) const {
+    if (!contains(id)) throw std::invalid_argument("CurveBVH: unknown curve id");
+    return entries_[id];
+}
+
+void CurveBVH::buildLeaves(int id) {
+    // 叶子：参数区间 [t0, t1]、齐次 Bezier 控制点与控制多边形包围盒
+    Entry& e = entries_[id];
+    const int m = e.degree + 1;
+    std::vector<Leaf> pieces;
+    e.segments.clear();
+    if (e.bezier) {
+        for (const Point2D& p : e.bezier->controlPoints()) e.segments.emplace_back(p.x, p.y, 1.0);
+        pieces.push_back(Leaf{id, 0.0, 1.0, 0, -1});
+    } else {
+        const NURBS& c = *e.nurbs;
+        const int count = c.numBezierSegments();
+        std::vector<Vec4d> points(static_cast<std::size_t>(count) * m);
+        std::vector<double> breaks(count + 1);
+        c.decomposeToBezier(points.data(), breaks.data());
+        e.segments.reserve(points.size());
+        for (const Vec4d& h : points) e.segments.emplace_back(h.x, h.y, h.w);
+        for (int s = 0; s < count; ++s) pieces.push_back(Leaf{id, breaks[s], breaks[s + 1], s * m, -1});
+    }
+
+    for (const Leaf& piece : pieces) {
+        Box2D box;
+        for (int i = 0; i < m; ++i) {
+            const Vec3d& h = e.segments[piece.offset + i];
+            box.expand(Point2D(h.x / h.z, h.y / h.z));
+        }
+        int l;
+        if (!freeLeaves_.empty()) {
+            l = freeLeaves_.back();
+            freeLeaves_.pop_back();
+            leaves_[l] = piece;
+        } else {
+            l = static_cast<int>(leaves_.size());
+            leaves_.push_back(piece);
+        }
+        const int n = allocNode();
+        nodes_[n].box = box;
+        nodes_[n].leaf = l;
+        leaves_[l].node = n;
+        insertNode(n);
+        entries_[id].leaves.push_back(l);
+    }
+}
+
+void CurveBVH::dropLeaves(int id) {
+    for (int l : entries_[id].leaves) {
+        const int n = leaves_[l].node;
+        removeNode(n);
+        freeNode(n);
+        freeLeaves_.push_back(l);
+    }
+    entries_[id].leaves.clear();
+}
+
+int CurveBVH::allocNode() {
+    int n;
+    if (!freeNodes_.empty()) {
+        n = freeNodes_.back();
+        freeNodes_.pop_back();
+        nodes_[n] = Node();
+    } else {
+        n = static_cast<int>(nodes_.size());
+        nodes_.emplace_back();
+    }
+    return n;
+}
+
+void CurveBVH::freeNode(int n) {
+    freeNodes_.push_back(n);
+}
+
+void CurveBVH::insertNode(int n) {
+    if (root_ < 0) {
+        root_ = n;
+        nodes_[n].parent = -1;
+        return;
+    }
+
+    // 自根向下选择兄弟节点：新建父节点的代价与继续下降的代价（含祖先的周长增量）比较
+    const Box2D box = nodes_[n].box;
+    int idx = root_;
+    while (nodes_[idx].leaf < 0) {
+        const Node& nd = nodes_[idx];
+        const double perimeter = nd.box.perimeter();
+        const double combined = Box2D::merge(nd.box, box).perimeter();
+        const double cost = 2.0 * combined;
+        const double inherit = 2.0 * (combined - perimeter);
+        auto childCost = [&](int c) {
+            const double merged = Box2D::merge(nodes_[c].box, box).perimeter();
+            return (nodes_[c].leaf >= 0 ? merged : merged - nodes_[c].box.perimeter()) + inherit;
+        };
+        const double costLeft = childCost(nd.left);
+        const double costRight = childCost(nd.right);
+        if (cost < costLeft && cost < costRight) break;
+        idx = costLeft < costRight ? nd.left : nd.right;
+    }
+
+    const int sibling = idx;
+    const int oldParent = nodes_[sibling].parent;
+    const int parent = allocNode();
+    nodes_[parent].parent = oldParent;
+    nodes_[parent].box = Box2D::merge(nodes_[sibling].box, box);
+    nodes_[parent].left = sibling;
+    nodes_[parent].right = n;
+    if (oldParent >= 0) {
+        if (nodes_[oldParent].left == sibling) nodes_[oldParent].left = parent;
+        else nodes_[oldParent].right = parent;
+    } else {
+        root_ = parent;
+    }
+    nodes_[sibling].parent = parent;
+    nodes_[n].parent = parent;
+    refit(oldParent);
+}
+
+void CurveBVH::removeNode(int n) {
+    if (n == root_) {
+        root_ = -1;
+        return;
+    }
+    const int parent = nodes_[n].parent;
+    const int grand = nodes_[parent].parent;
+    const int sibling = nodes_[parent].left == n ? nodes_[parent].right : nodes_[parent].left;
+    if (grand >= 0) {
+        if (nodes_[grand].left == parent) nodes_[grand].left = sibling;
+        else nodes_[grand].right = sibling;
+        nodes_[sibling].parent = grand;
+        refit(grand);
+    } else {
+        root_ = sibling;
+        nodes_[sibling].parent = -1;
+    }
+    freeNode(parent);
+}
+
+void CurveBVH::refit(int n) {
+    while (n >= 0) {
+        Node& nd = nodes_[n];
+        nd.box = Box2D::merge(nodes_[nd.left].box, nodes_[nd.right].box);
+        n = nd.parent;
+    }
+}
+
+void CurveBVH::rebuild() {
+    std::vector<Node> old;
+    old.swap(nodes_);
+    freeNodes_.clear();
+    root_ = -1;
+
+    std::vector<int> leafNodes;
+    for (const Entry& e : entries_) {
+        for (int l : e.leaves) {
+            const int n = allocNode();
+            nodes_[n].box = old[leaves_[l].node].box;
+            nodes_[n].leaf = l;
+            leaves_[l].node = n;
+            leafNodes.push_back(n);
+        }
+    }
+    if (leafNodes.empty()) return;
+    root_ = buildRange(leafNodes.data(), static_cast<int>(leafNodes.size()));
+    nodes_[root_].parent = -1;
+}
+
+int CurveBVH::buildRange(int* nodes, int count) {
+    if (count == 1) return nodes[0];
+
+    // 沿质心分布较长的轴取中位数划分
+    Box2D centers;
+    for (int i = 0; i < count; ++i) centers.expand(nodes_[nodes[i]].box.center());
+    const int axis = (centers.hi.x - centers.lo.x) >= (centers.hi.y - centers.lo.y) ? 0 : 1;
+    const int mid = count / 2;
+    std::nth_element(nodes, nodes + mid, nodes + count, [&](int a, int b) {
+        return nodes_[a].box.center()[axis] < nodes_[b].box.center()[axis];
+    });
+
+    const int left = buildRange(nodes, mid);
+    const int right = buildRange(nodes + mid, count - mid);
+    const int n = allocNode();
+    nodes_[n].left = left;
+    nodes_[n].right = right;
+    nodes_[n].box = Box2D::merge(nodes_[left].box, nodes_[right].box);
+    nodes_[left].parent = n;
+    nodes_[right].parent = n;
+    return n;
+}
+
+int CurveBVH::height() const {
+    if (root_ < 0) return 0;
+    int h = 0;
+    std::vector<std::pair<int, int>> stack{{root_, 1}};
+    while (!stack.empty()) {
+        const auto [n, depth] = stack.back();
+        stack.pop_back();
+        h = std::max(h, depth);
+        if (nodes_[n].leaf < 0) {
+            stack.push_back({nodes_[n].left, depth + 1});
+            stack.push_back({nodes_[n].right, depth + 1});
+        }
+    }
+    return h;
+}
+
+void CurveBVH::evaluate(const Entry& e, double u, Point2D* d, int k) const {
+    if (e.bezier) e.bezier->evaluateDerivatives(u, k, d);
+    else e.nurbs->evaluateDerivatives(u, k, d);
+}
+
+void CurveBVH::newton(const Entry& e, const Point2D& q, double u, double lo, double hi, int curve,
+                      Projection& best, double& bestD2) const {
+    for (int it = 0; it < kMaxNewtonIterations; ++it) {
+        Point2D d[3];
+        evaluate(e, u, d, 2);
+        const Point2D r = d[0] - q;
+        const double dist2 = r.squaredNorm();
+        if (dist2 < bestD2) {
+            bestD2 = dist2;
+            best = Projection{curve, u, d[0], std::sqrt(dist2)};
+        }
+        const double f = d[1].dot(r);
+        const double fp = d[1].squaredNorm() + d[2].dot(r);
+        if (!(fp > 0.0)) break;
+        const double next = std::clamp(u - f / fp, lo, hi);
+        if (std::fabs(next - u) <= 1e-15 * (1.0 + std::fabs(u))) break;
+        u = next;
+    }
+}
+
+void CurveBVH::refineLeaf(const Leaf& leaf, const Point2D& q, Projection& best, double& bestD2,
+                          Scratch& sc) const {
+    const Entry& e = entries_[leaf.curve];
+    const int n = e.degree;
+    const int m = n + 1;
+    const Vec3d* seg = e.segments.data() + leaf.offset;
+    const double span = leaf.t1 - leaf.t0;
+    auto param = [&](double s) { return s >= 1.0 ? leaf.t1 : leaf.t0 + span * s; };
+
+    sc.pieces.assign(1, Piece{0.0, 1.0, 0});
+    sc.points.assign(seg, seg + m);
+    sc.work.resize(3 * m);
+    sc.projected.resize(m);
+    Vec3d* cur = sc.work.data();
+    Vec3d* left = cur + m;
+    Vec3d* right = left + m;
+    Point2D* P = sc.projected.data();
+
+    while (!sc.pieces.empty()) {
+        const Piece pc = sc.pieces.back();
+        sc.pieces.pop_back();
+        std::copy(sc.points.end() - m, sc.points.end(), cur);
+        sc.points.resize(sc.points.size() - m);
+
+        Box2D box;
+        for (int i = 0; i < m; ++i) {
+            P[i] = Point2D(cur[i].x / cur[i].z, cur[i].y / cur[i].z);
+            box.expand(P[i]);
+        }
+        if (box.squaredDistanceTo(q) >= bestD2) continue;
+
+        // 首末控制点在曲线上，先用它们收紧上界
+        for (int i : {0, n}) {
+            const double d2 = P[i].squaredDistanceTo(q);
+            if (d2 < bestD2) {
+                bestD2 = d2;
+                best = Projection{leaf.curve, param(i == 0 ? pc.s0 : pc.s1), P[i], std::sqrt(d2)};
+            }
+        }
+
+        if (pc.depth >= kMaxSubdivisionDepth || isFlat(P, n)) {
+            int nearest = 0;
+            for (int i = 1; i < m; ++i)
+                if (P[i].squaredDistanceTo(q) < P[nearest].squaredDistanceTo(q)) nearest = i;
+            const double s = n > 0 ? pc.s0 + (pc.s1 - pc.s0) * nearest / n : pc.s0;
+            newton(e, q, param(s), param(pc.s0), param(pc.s1), leaf.curve, best, bestD2);
+            continue;
+        }
+
+        // de Casteljau 对半细分
+        left[0] = cur[0];
+        right[n] = cur[n];
+        for (int r = 1; r <= n; ++r) {
+            for (int j = 0; j <= n - r; ++j) cur[j] = (cur[j] + cur[j + 1]) * 0.5;
+            left[r] = cur[0];
+            right[n - r] = cur[n - r];
+        }
+        const double mid = 0.5 * (pc.s0 + pc.s1);
+        const Piece pl{pc.s0, mid, pc.depth + 1};
+        const Piece pr{mid, pc.s1, pc.depth + 1};
+        // 离查询点较近的一半后入栈、先处理
+        const bool leftNear = P[0].squaredDistanceTo(q) <= P[n].squaredDistanceTo(q);
+        sc.points.insert(sc.points.end(), leftNear ? right : left, (leftNear ? right : left) + m);
+        sc.pieces.push_back(leftNear ? pr : pl);
+        sc.points.insert(sc.points.end(), leftNear ? left : right, (leftNear ? left : right) + m);
+        sc.pieces.push_back(leftNear ? pl : pr);
+    }
+}
+
+CurveBVH::Projection CurveBVH::query(const Point2D& q, Scratch& sc) const {
+    Projection best;
+    double bestD2 = std::numeric_limits<double>::infinity();
+    if (root_ < 0) return best;
+
+    std::vector<int>& stack = sc.nodes;
+    stack.clear();
+    stack.push_back(root_);
+    while (!stack.empty()) {
+        const Node& nd = nodes_[stack.back()];
+        stack.pop_back();
+        if (nd.box.squaredDistanceTo(q) >= bestD2) continue;
+        if (nd.leaf >= 0) {
+            refineLeaf(leaves_[nd.leaf], q, best, bestD2, sc);
+            continue;
+        }
+        // 近的子树后入栈、先访问
+        int nearChild = nd.left, farChild = nd.right;
+        double nearD2 = nodes_[nearChild].box.squaredDistanceTo(q);
+        double farD2 = nodes_[farChild].box.squaredDistanceTo(q);
+        if (farD2 < nearD2) {
+            std::swap(nearChild, farChild);
+            std::swap(nearD2, farD2);
+        }
+        if (farD2 < bestD2) stack.push_back(farChild);
+        if (nearD2 < bestD2) stack.push_back(nearChild);
+    }
+    return best;
+}
+
+CurveBVH::Projection CurveBVH::closestPoint(const Point2D& q) const {
+    Scratch sc;
+    return query(q, sc);
+}
+
+void CurveBVH::closestPoints(const Point2D* qs, std::size_t count, Projection* out,
+                             ThreadPool& pool) const {
+    const std::size_t numTasks = (count + kQueryGrain - 1) / kQueryGrain;
+    pool.parallelFor(numTasks, [&](std::size_t task) {
+        Scratch sc;
+        const std::size_t end = std::min(count, (task + 1) * kQueryGrain);
+        for (std::size_t i = task * kQueryGrain; i < end; ++i) out[i] = query(qs[i], sc);
+    });
+}
+
+CurveBVH::Projection CurveBVH::project(int id, const Point2D& q) const {
+    const Entry& e = entry(id);
+    Projection best;
+    double bestD2 = std::numeric_limits<double>::infinity();
+    Scratch sc;
+    for (int l : e.leaves) refineLeaf(leaves_[l], q, best, bestD2, sc);
+    return best;
+}
+
+} // namespace GeoAlgo
@@ -0,0 +1,65 @@
+#include "CurveBatch.h"
+#include <algorithm>
+#include <vector>
+
+namespace GeoAlgo {
+
+CurveBatch::CurveBatch(std::size_t numThreads, std::size_t grainSize)
+    : ownedPool_(std::make_unique<ThreadPool>(numThreads)),
+      pool_(ownedPool_.get()),
+      grain_(std::max<std::size_t>(grainSize, 1)) {}
+
+CurveBatch::CurveBatch(ThreadPool& pool, std::size_t grainSize)
+    : pool_(&pool), grain_(std::max<std::size_t>(grainSize, 1)) {}
+
+void CurveBatch::evaluate(const BezierCurve* curves, std::size_t numCurves,
+                          const double* us, std::size_t count, Point2D* out) const {
+    forEachRange(numCurves, count, [&](std::size_t c, std::size_t k0, std::size_t k1) {
+        curves[c].evaluateMany(us + k0, k1 - k0, out + c * count + k0);
+    });
+}
+
+void CurveBatch::evaluate(const PowerBasisCurve* curves, std::size_t numCurves,
+                          const double* us, std::size_t count, Point2D* out) const {
+    forEachRange(numCurves, count, [&](std::size_t c, std::size_t k0, std::size_t k1) {
+        Point2D* o = out + c * count;
+        for (std::size_t k = k0; k < k1; ++k) o[k] = curves[c].evaluate(us[k]);
+    });
+}
+
+void CurveBatch::evaluate(const PowerBasisCurve1D* curves, std::size_t numCurves,
+                          const double* us, std::size_t count, double* out) const {
+    forEachRange(numCurves, count, [&](std::size_t c, std::size_t k0, std::size_t k1) {
+        curves[c].evaluateMany(us + k0, k1 - k0, out + c * count + k0);
+    });
+}
+
+void CurveBatch::evaluate(const PowerBasisCurve2D* curves, std::size_t numCurves,
+                          const double* us, std::size_t count, double* xs, double* ys) const {
+    forEachRange(numCurves, count, [&](std::size_t c, std::size_t k0, std::size_t k1) {
+        const std::size_t o = c * count + k0;
+        curves[c].evaluateMany(us + k0, k1 - k0, xs + o, ys + o);
+    });
+}
+
+void CurveBatch::evaluate(const PowerBasisCurve3D* curves, std::size_t numCurves,
+                          const double* us, std::size_t count,
+                          double* xs, double* ys, double* zs) const {
+    forEachRange(numCurves, count, [&](std::size_t c, std::size_t k0, std::size_t k1) {
+        const std::size_t o = c * count + k0;
+        curves[c].evaluateMany(us + k0, k1 - k0, xs + o, ys + o, zs + o);
+    });
+}
+
+void CurveBatch::evaluate(const NURBS* curves, std::size_t numCurves,
+                          const double* us, std::size_t count, double* out) const {
+    std::vector<std::size_t> offsets(numCurves + 1, 0);
+    for (std::size_t c = 0; c < numCurves; ++c)
+        offsets[c + 1] = offsets[c] + count * curves[c].dimension();
+    forEachRange(numCurves, count, [&](std::size_t c, std::size_t k0, std::size_t k1) {
+        const std::size_t dim = curves[c].dimension();
+        curves[c].evaluateMany(us + k0, k1 - k0, out + offsets[c] + k0 * dim);
+    });
+}
+
+} // namespace GeoAlgo
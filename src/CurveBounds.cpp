@@ -0,0 +1,230 @@
+#include "CurveBounds.h"
+#include "BasisConversion.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace GeoAlgo {
+
+namespace {
+
+double horner(const double* c, int degree, double t) {
+    double v = c[degree];
+    for (int i = degree - 1; i >= 0; --i) v = v * t + c[i];
+    return v;
+}
+
+// [a, b] 上 f(a)、f(b) 异号（均非零），二分到相邻浮点数
+double bisect(const double* c, int degree, double a, double b, double fa) {
+    for (int it = 0; it < 200; ++it) {
+        const double m = 0.5 * (a + b);
+        if (m <= a || m >= b) break;
+        const double fm = horner(c, degree, m);
+        if (fm == 0.0) return m;
+        if ((fm < 0.0) == (fa < 0.0)) {
+            a = m;
+            fa = fm;
+        } else {
+            b = m;
+        }
+    }
+    return 0.5 * (a + b);
+}
+
+void pushRoot(double* roots, int& n, double t) {
+    if (n == 0 || roots[n - 1] != t) roots[n++] = t;
+}
+
+// 幂基分量在 [t0, t1] 上的值域并入 [lo, hi]
+void expandPolynomial(const double* a, int degree, double t0, double t1, double& lo, double& hi) {
+    auto take = [&](double t) {
+        const double v = degree < 0 ? 0.0 : horner(a, degree, t);
+        lo = std::min(lo, v);
+        hi = std::max(hi, v);
+    };
+    take(t0);
+    take(t1);
+    if (degree < 2) return;
+    if (degree > kMaxRootDegree) throw std::invalid_argument("exactBounds: polynomial degree exceeds kMaxRootDegree");
+    double d[kMaxRootDegree];
+    for (int i = 1; i <= degree; ++i) d[i - 1] = i * a[i];
+    double roots[kMaxRootDegree];
+    const int n = polynomialRoots(d, degree - 1, t0, t1, roots);
+    for (int k = 0; k < n; ++k) take(roots[k]);
+}
+
+// de Casteljau 求齐次 Bezier 段在 t 处的点（投影后）
+Vec3d deCasteljau(const Vec4d* Pw, int degree, double t) {
+    Vec4d Q[kMaxConversionDegree + 1];
+    std::copy(Pw, Pw + degree + 1, Q);
+    for (int r = 1; r <= degree; ++r)
+        for (int i = 0; i <= degree - r; ++i) Q[i] = Q[i] * (1.0 - t) + Q[i + 1] * t;
+    return Vec3d(Q[0].x, Q[0].y, Q[0].z) / Q[0].w;
+}
+
+/**
+ * 齐次 Bezier 段 [0,1] 上前 dim 个分量的包围盒并入 box
+ * 驻点在幂基下求根（非有理时为 A' 的根，有理时为 A'W - AW' 的根），驻点处的值用 de Casteljau 在 Bernstein 形式下计算
+ */
+void expandHomogeneousBezier(const Vec4d* Pw, int degree, int dim, bool rational, Box3D& box) {
+    box.expand(Vec3d(Pw[0].x, Pw[0].y, Pw[0].z) / Pw[0].w);
+    box.expand(Vec3d(Pw[degree].x, Pw[degree].y, Pw[degree].z) / Pw[degree].w);
+    if (degree < 2 && !rational) return;
+    if (degree > kMaxConversionDegree) {
+        for (int i = 1; i < degree; ++i) box.expand(Vec3d(Pw[i].x, Pw[i].y, Pw[i].z) / Pw[i].w);
+        return;
+    }
+    double power[(kMaxConversionDegree + 1) * 4];
+    bezierToPower(reinterpret_cast<const double*>(Pw), degree, 4, power);
+    const double* w = power + 3;
+
+    double numer[2 * kMaxConversionDegree];
+    double roots[2 * kMaxConversionDegree];
+    for (int d = 0; d < dim; ++d) {
+        const double* a = power + d;
+        int numerDegree;
+        if (rational) {
+            // A'W - AW' = Σ (i - j) a_i w_j t^(i+j-1)，i = j 的项恰好为零
+            numerDegree = 2 * degree - 1;
+            std::fill(numer, numer + numerDegree + 1, 0.0);
+            for (int i = 0; i <= degree; ++i)
+                for (int j = 0; j <= degree; ++j)
+                    if (i != j && i + j >= 1) numer[i + j - 1] += (i - j) * a[i * 4] * w[j * 4];
+        } else {
+            numerDegree = degree - 1;
+            for (int i = 1; i <= degree; ++i) numer[i - 1] = i * a[i * 4];
+        }
+        const int n = polynomialRoots(numer, numerDegree, 0.0, 1.0, roots);
+        for (int k = 0; k < n; ++k) box.expand(deCasteljau(Pw, degree, roots[k]));
+    }
+}
+
+Box2D toBox2D(const Box3D& b) {
+    return Box2D(Point2D(b.lo.x, b.lo.y), Point2D(b.hi.x, b.hi.y));
+}
+
+void checkWeights(const std::vector<Vec4d>& Pw, const char* what) {
+    for (const Vec4d& h : Pw)
+        if (!(h.w > 0.0)) throw std::invalid_argument(std::string(what) + ": weights must be positive");
+}
+
+void checkInterval(double t0, double t1) {
+    if (!(t0 <= t1)) throw std::invalid_argument("exactBounds: parameter interval requires t0 <= t1");
+}
+
+} // namespace
+
+int polynomialRoots(const double* coeffs, int degree, double t0, double t1, double* roots) {
+    if (degree > kMaxRootDegree) throw std::invalid_argument("polynomialRoots: degree exceeds kMaxRootDegree");
+    while (degree > 0 && coeffs[degree] == 0.0) --degree;
+    if (degree <= 0 || !(t0 <= t1)) return 0;
+    if (degree == 1) {
+        const double t = -coeffs[0] / coeffs[1];
+        if (t >= t0 && t <= t1) {
+            roots[0] = t;
+            return 1;
+        }
+        return 0;
+    }
+
+    // 导数的根（驻点）把 [t0, t1] 分成单调段
+    double d[kMaxRootDegree];
+    for (int i = 1; i <= degree; ++i) d[i - 1] = i * coeffs[i];
+    double crit[kMaxRootDegree];
+    const int numCrit = polynomialRoots(d, degree - 1, t0, t1, crit);
+
+    int n = 0;
+    double a = t0;
+    double fa = horner(coeffs, degree, a);
+    for (int k = 0; k <= numCrit; ++k) {
+        const double b = k < numCrit ? crit[k] : t1;
+        const double fb = horner(coeffs, degree, b);
+        if (fa == 0.0) pushRoot(roots, n, a);
+        else if (fb != 0.0 && (fa < 0.0) != (fb < 0.0)) pushRoot(roots, n, bisect(coeffs, degree, a, b, fa));
+        a = b;
+        fa = fb;
+    }
+    if (fa == 0.0) pushRoot(roots, n, a);
+    return n;
+}
+
+Box2D exactBounds(const BezierCurve& curve) {
+    const std::vector<Point2D>& P = curve.controlPoints();
+    if (P.empty()) return Box2D();
+    std::vector<Vec4d> Pw(P.size());
+    for (std::size_t i = 0; i < P.size(); ++i) Pw[i] = Vec4d(P[i].x, P[i].y, 0.0, 1.0);
+    Box3D box;
+    expandHomogeneousBezier(Pw.data(), curve.degree(), 2, false, box);
+    return toBox2D(box);
+}
+
+Box2D exactBounds(const RationalBezierCurve& curve) {
+    return toBox2D(exactBounds3D(curve));
+}
+
+Box3D exactBounds3D(const RationalBezierCurve& curve) {
+    Box3D box;
+    if (curve.degree() < 0) return box;
+    checkWeights(curve.homogeneousPoints(), "exactBounds");
+    expandHomogeneousBezier(curve.homogeneousPoints().data(), curve.degree(), curve.dimension(), true, box);
+    return box;
+}
+
+Box2D exactBounds(const PowerBasisCurve& curve, double t0, double t1) {
+    checkInterval(t0, t1);
+    const std::vector<Point2D>& c = curve.coefficients();
+    std::vector<double> xs(c.size()), ys(c.size());
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        xs[i] = c[i].x;
+        ys[i] = c[i].y;
+    }
+    Box2D box;
+    expandPolynomial(xs.data(), curve.degree(), t0, t1, box.lo.x, box.hi.x);
+    expandPolynomial(ys.data(), curve.degree(), t0, t1, box.lo.y, box.hi.y);
+    return box;
+}
+
+std::pair<double, double> exactRange(const PowerBasisCurve1D& curve, double t0, double t1) {
+    checkInterval(t0, t1);
+    std::pair<double, double> range(std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity());
+    const std::vector<double>& c = curve.coefficients();
+    expandPolynomial(c.data(), static_cast<int>(c.size()) - 1, t0, t1, range.first, range.second);
+    return range;
+}
+
+Box2D exactBounds(const PowerBasisCurve2D& curve, double t0, double t1) {
+    const std::pair<double, double> x = exactRange(curve.xCurve(), t0, t1);
+    const std::pair<double, double> y = exactRange(curve.yCurve(), t0, t1);
+    return Box2D(Point2D(x.first, y.first), Point2D(x.second, y.second));
+}
+
+Box3D exactBounds(const PowerBasisCurve3D& curve, double t0, double t1) {
+    const std::pair<double, double> x = exactRange(curve.xCurve(), t0, t1);
+    const std::pair<double, double> y = exactRange(curve.yCurve(), t0, t1);
+    const std::pair<double, double> z = exactRange(curve.zCurve(), t0, t1);
+    return Box3D(Vec3d(x.first, y.first, z.first), Vec3d(x.second, y.second, z.second));
+}
+
+Box2D exactBounds(const NURBS& curve) {
+    return toBox2D(exactBounds3D(curve));
+}
+
+Box3D exactBounds3D(const NURBS& curve) {
+    const std::vector<Vec4d>& H = curve.homogeneousPoints();
+    checkWeights(H, "exactBounds");
+    bool rational = false;
+    for (const Vec4d& h : H) rational = rational || h.w != H[0].w;
+
+    const int p = curve.degree();
+    const int segs = curve.numBezierSegments();
+    std::vector<Vec4d> Pw(static_cast<std::size_t>(segs) * (p + 1));
+    curve.decomposeToBezier(Pw.data());
+    Box3D box;
+    for (int s = 0; s < segs; ++s)
+        expandHomogeneousBezier(Pw.data() + static_cast<std::size_t>(s) * (p + 1), p, curve.dimension(), rational, box);
+    return box;
+}
+
+} // namespace GeoAlgo
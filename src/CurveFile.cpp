@@ -0,0 +1,665 @@
+#include "CurveFile.h"
+#include "CurveKernels.h"
+#include "PowerBasisKernel.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define GEOALGO_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+namespace GeoAlgo {
+
+namespace {
+
+constexpr std::size_t kAlignDoubles = kCurveFileAlignment / sizeof(double);
+constexpr std::size_t kEvalBlock = 256;
+
+std::runtime_error formatError(const std::string& message) {
+    return std::runtime_error("CurveFile: " + message);
+}
+
+#ifndef GEOALGO_HAS_MMAP
+// 无 mmap 时的回退缓冲区；MSVC 没有 std::aligned_alloc，bytes 须为对齐值的整数倍
+void* allocateAligned(std::size_t bytes) {
+#ifdef _MSC_VER
+    return _aligned_malloc(bytes, kCurveFileAlignment);
+#else
+    return std::aligned_alloc(kCurveFileAlignment, bytes);
+#endif
+}
+#endif
+
+void freeAligned(void* p) {
+#ifdef _MSC_VER
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+int components(const CurveFileEntry& e) {
+    return e.dim + ((e.flags & kCurveFileRational) ? 1 : 0);
+}
+
+std::uint64_t numKnots(const CurveFileEntry& e) {
+    return static_cast<std::uint64_t>(e.numPoints) + e.degree + 1;
+}
+
+// 索引项自身的一致性（类型、维数、次数与点数），与偏移无关
+const char* shapeError(const CurveFileEntry& e) {
+    if (e.type > static_cast<std::uint8_t>(CurveFileType::BSpline)) return "unknown curve type";
+    if (e.dim < 1 || e.dim > 3) return "dimension must be in [1, 3]";
+    if (e.flags & ~(kCurveFileRational | kCurveFileKnots)) return "unknown flags";
+    if (e.numPoints == 0) return "curve needs at least one point";
+    const CurveFileType type = static_cast<CurveFileType>(e.type);
+    const bool hasKnots = (e.flags & kCurveFileKnots) != 0;
+    if (hasKnots != (type == CurveFileType::BSpline)) return "knot block present iff the curve is a B-spline";
+    if (type == CurveFileType::BSpline) {
+        if (e.degree > static_cast<std::uint32_t>(NURBS::kMaxDegree)) return "B-spline degree exceeds NURBS::kMaxDegree";
+        if (e.numPoints < e.degree + 1) return "B-spline needs at least degree+1 control points";
+        return nullptr;
+    }
+    if (e.numPoints != e.degree + 1) return "point count must be degree+1";
+    if (type == CurveFileType::PowerBasis && (e.flags & kCurveFileRational)) return "power basis curves cannot be rational";
+    if (type == CurveFileType::Bezier && e.degree > static_cast<std::uint32_t>(kMaxTableDegree))
+        return "Bezier degree exceeds kMaxTableDegree";
+    return nullptr;
+}
+
+bool blockInRange(std::uint64_t offset, std::uint64_t count, std::uint64_t dataSize) {
+    return offset <= dataSize && count <= dataSize - offset;
+}
+
+// 形状与块范围都合法时返回空指针
+const char* entryError(const CurveFileEntry& e, std::uint64_t dataSize) {
+    if (const char* err = shapeError(e)) return err;
+    if (!blockInRange(e.coeffOffset, static_cast<std::uint64_t>(e.numPoints) * components(e), dataSize))
+        return "coefficient block lies outside the data section";
+    if ((e.flags & kCurveFileKnots) && !blockInRange(e.knotOffset, numKnots(e), dataSize))
+        return "knot block lies outside the data section";
+    return nullptr;
+}
+
+// 节点有限、非降且定义域非空时返回空指针
+const char* knotError(const double* U, int degree, int numPoints) {
+    const int m = numPoints + degree + 1;
+    if (!std::all_of(U, U + m, [](double v) { return std::isfinite(v); })) return "non-finite knot";
+    if (!std::is_sorted(U, U + m)) return "knots must be non-decreasing";
+    if (!(U[degree] < U[numPoints])) return "empty parameter domain";
+    return nullptr;
+}
+
+// 索引项合法时的记录视图，不检查节点
+CurveFile::Record recordView(const CurveFileEntry& e, const double* data) {
+    CurveFile::Record r;
+    r.type = static_cast<CurveFileType>(e.type);
+    r.dim = e.dim;
+    r.degree = static_cast<int>(e.degree);
+    r.numPoints = static_cast<int>(e.numPoints);
+    r.rational = (e.flags & kCurveFileRational) != 0;
+    r.coeffs = data + e.coeffOffset;
+    r.knots = (e.flags & kCurveFileKnots) ? data + e.knotOffset : nullptr;
+    return r;
+}
+
+// 各分量系数补零到相同长度后按分量连续拼接
+std::vector<double> packComponents(std::initializer_list<const std::vector<double>*> comps, std::size_t& order) {
+    order = 0;
+    for (const auto* a : comps) order = std::max(order, a->size());
+    std::vector<double> c(order * comps.size(), 0.0);
+    std::size_t d = 0;
+    for (const auto* a : comps) std::copy(a->begin(), a->end(), c.begin() + d++ * order);
+    return c;
+}
+
+template <int K>
+Vec3d project(const Vec<double, K>& h, int dim, bool rational) {
+    Vec3d p;
+    const double inv = rational ? 1.0 / h[dim] : 1.0;
+    for (int d = 0; d < dim; ++d) p[d] = h[d] * inv;
+    return p;
+}
+
+template <int K>
+Vec<double, K> bsplinePoint(const CurveFile::Record& r, double u) {
+    using V = Vec<double, K>;
+    const double* U = r.knots;
+    u = std::min(std::max(u, U[r.degree]), U[r.numPoints]);
+    const int span = NURBS::findSpan(U, r.numKnots(), r.degree, u);
+    double N[NURBS::kMaxDegree + 1];
+    NURBS::basisFunctions(U, r.degree, span, u, N);
+    const double* P = r.coeffs + static_cast<std::size_t>(span - r.degree) * K;
+    V c = V::generate([&](int d) { return P[d] * N[0]; });
+    for (int j = 1; j <= r.degree; ++j)
+        for (int d = 0; d < K; ++d) c[d] += P[j * K + d] * N[j];
+    return c;
+}
+
+// 按点连续的 Bezier / BSpline 记录，每点 K 个分量
+template <int K>
+Vec3d evaluatePointMajor(const CurveFile::Record& r, double u) {
+    if (r.type == CurveFileType::Bezier) return project(bezierPoint<K>(r.coeffs, r.degree, u), r.dim, r.rational);
+    return project(bsplinePoint<K>(r, u), r.dim, r.rational);
+}
+
+} // namespace
+
+Vec3d evaluateRecord(const CurveFile::Record& r, double u) {
+    if (r.type == CurveFileType::PowerBasis) {
+        // 按分量连续的系数，逐分量 Horner
+        Vec3d p;
+        for (int d = 0; d < r.dim; ++d) {
+            const double* a = r.coeffs + static_cast<std::size_t>(d) * r.numPoints;
+            double v = a[r.degree];
+            for (int i = r.degree - 1; i >= 0; --i) v = v * u + a[i];
+            p[d] = v;
+        }
+        return p;
+    }
+    switch (r.dim + (r.rational ? 1 : 0)) {
+    case 1:  return evaluatePointMajor<1>(r, u);
+    case 2:  return evaluatePointMajor<2>(r, u);
+    case 3:  return evaluatePointMajor<3>(r, u);
+    default: return evaluatePointMajor<4>(r, u);
+    }
+}
+
+void evaluateRecordMany(const CurveFile::Record& r, const double* us, std::size_t count, Vec3d* out) {
+    if (r.type != CurveFileType::PowerBasis) {
+        for (std::size_t k = 0; k < count; ++k) out[k] = evaluateRecord(r, us[k]);
+        return;
+    }
+    // 分块走 SoA 内核，再交错写回
+    double buf[3][kEvalBlock];
+    double* outs[3] = {buf[0], buf[1], buf[2]};
+    for (std::size_t k0 = 0; k0 < count; k0 += kEvalBlock) {
+        const std::size_t len = std::min(kEvalBlock, count - k0);
+        evaluatePowerBasisSoA(r.coeffs, r.dim, r.numPoints, us + k0, len, outs);
+        for (std::size_t k = 0; k < len; ++k) {
+            Vec3d p;
+            for (int d = 0; d < r.dim; ++d) p[d] = buf[d][k];
+            out[k0 + k] = p;
+        }
+    }
+}
+
+const char* CurveFile::Record::error() const {
+    CurveFileEntry e = {};
+    e.type = static_cast<std::uint8_t>(type);
+    e.dim = static_cast<std::uint8_t>(std::min(std::max(dim, 0), 255));
+    e.flags = static_cast<std::uint8_t>((rational ? kCurveFileRational : 0) | (knots ? kCurveFileKnots : 0));
+    if (degree < 0 || numPoints < 0) return "negative degree or point count";
+    e.numPoints = static_cast<std::uint32_t>(numPoints);
+    e.degree = static_cast<std::uint32_t>(degree);
+    return shapeError(e);
+}
+
+// ---------------------------------------------------------------------------
+// CurveFile
+// ---------------------------------------------------------------------------
+
+CurveFile::CurveFile(const std::string& path) {
+#ifdef GEOALGO_HAS_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw formatError("cannot open " + path);
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw formatError("cannot stat " + path);
+    }
+    const std::size_t size = static_cast<std::size_t>(st.st_size);
+    if (size == 0) {
+        ::close(fd);
+        throw formatError("file too small for a header: " + path);
+    }
+    void* map = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) throw formatError("cannot map " + path);
+    mapping_ = map;
+    mappingSize_ = size;
+    mapped_ = true;
+#else
+    // 无 mmap 的平台整体读入一块对齐缓冲区
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) throw formatError("cannot open " + path);
+    const std::size_t size = static_cast<std::size_t>(in.tellg());
+    in.seekg(0);
+    const std::size_t padded = (std::max<std::size_t>(size, 1) + kCurveFileAlignment - 1) / kCurveFileAlignment *
+                               kCurveFileAlignment;
+    mapping_ = allocateAligned(padded);
+    if (!mapping_) throw std::bad_alloc();
+    mappingSize_ = size;
+    if (!in.read(static_cast<char*>(mapping_), static_cast<std::streamsize>(size))) {
+        release();
+        throw formatError("cannot read " + path);
+    }
+#endif
+    try {
+        attach(static_cast<const unsigned char*>(mapping_), size);
+    } catch (...) {
+        release();
+        throw;
+    }
+}
+
+CurveFile CurveFile::fromMemory(const void* data, std::size_t size) {
+    CurveFile f;
+    f.attach(static_cast<const unsigned char*>(data), size);
+    return f;
+}
+
+CurveFile::CurveFile(CurveFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+CurveFile& CurveFile::operator=(CurveFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        base_ = other.base_;
+        size_ = other.size_;
+        numCurves_ = other.numCurves_;
+        index_ = other.index_;
+        data_ = other.data_;
+        dataSize_ = other.dataSize_;
+        mapping_ = other.mapping_;
+        mappingSize_ = other.mappingSize_;
+        mapped_ = other.mapped_;
+        badKnots_ = std::move(other.badKnots_);
+        other.mapping_ = nullptr;
+        other.release();
+    }
+    return *this;
+}
+
+CurveFile::~CurveFile() {
+    release();
+}
+
+void CurveFile::release() {
+    if (mapping_) {
+#ifdef GEOALGO_HAS_MMAP
+        if (mapped_) ::munmap(mapping_, mappingSize_);
+#endif
+        if (!mapped_) freeAligned(mapping_);
+    }
+    mapping_ = nullptr;
+    mappingSize_ = 0;
+    mapped_ = false;
+    base_ = nullptr;
+    size_ = numCurves_ = dataSize_ = 0;
+    index_ = nullptr;
+    data_ = nullptr;
+    badKnots_.clear();
+}
+
+void CurveFile::attach(const unsigned char* data, std::size_t size) {
+    if (reinterpret_cast<std::uintptr_t>(data) % alignof(double) != 0)
+        throw std::invalid_argument("CurveFile: buffer must be 8-byte aligned");
+    if (size < sizeof(CurveFileHeader)) throw formatError("file too small for a header");
+    CurveFileHeader h;
+    std::memcpy(&h, data, sizeof(h));
+    if (std::memcmp(h.magic, kCurveFileMagic, sizeof(h.magic)) != 0) throw formatError("bad magic");
+    if (h.endianTag != kCurveFileEndianTag) throw formatError("byte order does not match this machine");
+    if (h.version != kCurveFileVersion) throw formatError("unsupported version " + std::to_string(h.version));
+    if (h.headerSize != sizeof(CurveFileHeader)) throw formatError("unexpected header size");
+    if (h.dataOffset < sizeof(CurveFileHeader) || h.dataOffset % alignof(double) != 0 || h.dataOffset > size ||
+        h.dataSize > (size - h.dataOffset) / sizeof(double))
+        throw formatError("data section lies outside the file");
+    if (h.indexOffset < sizeof(CurveFileHeader) || h.indexOffset % alignof(double) != 0 || h.indexOffset > size ||
+        h.numCurves > (size - h.indexOffset) / sizeof(CurveFileEntry))
+        throw formatError("index lies outside the file");
+
+    base_ = data;
+    size_ = size;
+    numCurves_ = static_cast<std::size_t>(h.numCurves);
+    index_ = reinterpret_cast<const CurveFileEntry*>(data + h.indexOffset);
+    data_ = reinterpret_cast<const double*>(data + h.dataOffset);
+    dataSize_ = static_cast<std::size_t>(h.dataSize);
+
+    // 节点只在这里检查一次，record() 查表即可；越界的索引项留给 record() 报告
+    for (std::size_t i = 0; i < numCurves_; ++i) {
+        const CurveFileEntry& e = index_[i];
+        if (!(e.flags & kCurveFileKnots) || entryError(e, dataSize_)) continue;
+        const Record r = recordView(e, data_);
+        if (knotError(r.knots, r.degree, r.numPoints)) badKnots_.push_back(i);
+    }
+}
+
+const CurveFileEntry& CurveFile::entry(std::size_t i) const {
+    if (i >= numCurves_) throw std::invalid_argument("CurveFile: curve index out of range");
+    return index_[i];
+}
+
+CurveFile::Record CurveFile::record(std::size_t i) const {
+    const CurveFileEntry& e = entry(i);
+    if (const char* err = entryError(e, dataSize_))
+        throw formatError("curve " + std::to_string(i) + ": " + err);
+    const Record r = recordView(e, data_);
+    if (!badKnots_.empty() && std::binary_search(badKnots_.begin(), badKnots_.end(), i))
+        throw formatError("curve " + std::to_string(i) + ": " + knotError(r.knots, r.degree, r.numPoints));
+    return r;
+}
+
+const CurveFileHeader& CurveFile::header() const {
+    if (!base_) throw std::invalid_argument("CurveFile: no file is attached");
+    return *reinterpret_cast<const CurveFileHeader*>(base_);
+}
+
+Vec3d CurveFile::evaluate(std::size_t i, double u) const {
+    return evaluateRecord(record(i), u);
+}
+
+void CurveFile::evaluateMany(std::size_t i, const double* us, std::size_t count, Vec3d* out) const {
+    evaluateRecordMany(record(i), us, count, out);
+}
+
+void CurveFile::evaluateMany(std::size_t i, const double* us, std::size_t count, double* const* outs) const {
+    const Record r = record(i);
+    if (r.type == CurveFileType::PowerBasis) {
+        evaluatePowerBasisSoA(r.coeffs, r.dim, r.numPoints, us, count, outs);
+        return;
+    }
+    for (std::size_t k = 0; k < count; ++k) {
+        const Vec3d p = evaluateRecord(r, us[k]);
+        for (int d = 0; d < r.dim; ++d) outs[d][k] = p[d];
+    }
+}
+
+BezierCurve CurveFile::bezierCurve(std::size_t i) const {
+    const Record r = record(i);
+    if (r.type != CurveFileType::Bezier || r.rational || r.dim != 2)
+        throw std::invalid_argument("CurveFile: curve is not a polynomial 2D Bezier curve");
+    std::vector<Point2D> pts(r.numPoints);
+    for (int j = 0; j < r.numPoints; ++j) pts[j] = Point2D(r.coeffs[2 * j], r.coeffs[2 * j + 1]);
+    return BezierCurve(pts);
+}
+
+RationalBezierCurve CurveFile::rationalBezier(std::size_t i) const {
+    const Record r = record(i);
+    if (r.type != CurveFileType::Bezier || r.dim < 2)
+        throw std::invalid_argument("CurveFile: curve is not a 2D or 3D Bezier curve");
+    const int K = r.dim + (r.rational ? 1 : 0);
+    std::vector<Vec3d> pts(r.numPoints);
+    std::vector<double> w(r.numPoints, 1.0);
+    for (int j = 0; j < r.numPoints; ++j) {
+        const double* h = r.coeffs + static_cast<std::size_t>(j) * K;
+        if (r.rational) w[j] = h[r.dim];
+        for (int d = 0; d < r.dim; ++d) pts[j][d] = h[d] / w[j];
+    }
+    if (r.dim == 3) return RationalBezierCurve(pts, w);
+    std::vector<Point2D> pts2(r.numPoints);
+    for (int j = 0; j < r.numPoints; ++j) pts2[j] = Point2D(pts[j].x, pts[j].y);
+    return RationalBezierCurve(pts2, w);
+}
+
+PowerBasisCurve CurveFile::powerBasis(std::size_t i) const {
+    const Record r = record(i);
+    if (r.type != CurveFileType::PowerBasis || r.dim != 2)
+        throw std::invalid_argument("CurveFile: curve is not a 2D power basis curve");
+    std::vector<Point2D> a(r.numPoints);
+    for (int j = 0; j < r.numPoints; ++j) a[j] = Point2D(r.coeffs[j], r.coeffs[r.numPoints + j]);
+    return PowerBasisCurve(a);
+}
+
+PowerBasisCurve1D CurveFile::powerBasis1D(std::size_t i, int component) const {
+    const Record r = record(i);
+    if (r.type != CurveFileType::PowerBasis || component < 0 || component >= r.dim)
+        throw std::invalid_argument("CurveFile: curve is not a power basis curve with the requested component");
+    const double* a = r.coeffs + static_cast<std::size_t>(component) * r.numPoints;
+    return PowerBasisCurve1D(std::vector<double>(a, a + r.numPoints));
+}
+
+PowerBasisCurve2D CurveFile::powerBasis2D(std::size_t i) const {
+    const Record r = record(i);
+    if (r.type != CurveFileType::PowerBasis || r.dim != 2)
+        throw std::invalid_argument("CurveFile: curve is not a 2D power basis curve");
+    const double* a = r.coeffs;
+    const std::size_t n = r.numPoints;
+    return PowerBasisCurve2D(std::vector<double>(a, a + n), std::vector<double>(a + n, a + 2 * n));
+}
+
+PowerBasisCurve3D CurveFile::powerBasis3D(std::size_t i) const {
+    const Record r = record(i);
+    if (r.type != CurveFileType::PowerBasis || r.dim != 3)
+        throw std::invalid_argument("CurveFile: curve is not a 3D power basis curve");
+    const double* a = r.coeffs;
+    const std::size_t n = r.numPoints;
+    return PowerBasisCurve3D(std::vector<double>(a, a + n), std::vector<double>(a + n, a + 2 * n),
+                             std::vector<double>(a + 2 * n, a + 3 * n));
+}
+
+NURBS CurveFile::nurbs(std::size_t i) const {
+    const Record r = record(i);
+    if (r.type != CurveFileType::BSpline) throw std::invalid_argument("CurveFile: curve is not a B-spline");
+    return toNURBS(r);
+}
+
+NURBS toNURBS(const CurveFile::Record& r) {
+    if (r.type != CurveFileType::BSpline) throw std::invalid_argument("CurveFile: curve is not a B-spline");
+    const int K = r.dim + (r.rational ? 1 : 0);
+    std::vector<double> pts(static_cast<std::size_t>(r.numPoints) * r.dim);
+    std::vector<double> w;
+    if (r.rational) w.resize(r.numPoints);
+    for (int j = 0; j < r.numPoints; ++j) {
+        const double* h = r.coeffs + static_cast<std::size_t>(j) * K;
+        const double inv = r.rational ? 1.0 / h[r.dim] : 1.0;
+        if (r.rational) w[j] = h[r.dim];
+        for (int d = 0; d < r.dim; ++d) pts[static_cast<std::size_t>(j) * r.dim + d] = h[d] * inv;
+    }
+    return NURBS(r.degree, r.dim, pts, std::vector<double>(r.knots, r.knots + r.numKnots()), w);
+}
+
+std::vector<std::string> CurveFile::validate(std::size_t maxIssues) const {
+    std::vector<std::string> issues;
+    if (!base_) return issues;
+    const std::size_t limit = maxIssues ? maxIssues : std::numeric_limits<std::size_t>::max();
+    auto report = [&](std::size_t i, const std::string& message) {
+        if (issues.size() < limit) issues.push_back("curve " + std::to_string(i) + ": " + message);
+    };
+    const CurveFileHeader& h = header();
+    if (h.dataOffset % kCurveFileAlignment != 0) issues.push_back("data section is not 64-byte aligned");
+
+    for (std::size_t i = 0; i < numCurves_ && issues.size() < limit; ++i) {
+        const CurveFileEntry& e = index_[i];
+        if (const char* err = entryError(e, dataSize_)) {
+            report(i, err);
+            continue;
+        }
+        const Record r = recordView(e, data_);
+        if (e.coeffOffset % kAlignDoubles != 0 || ((e.flags & kCurveFileKnots) && e.knotOffset % kAlignDoubles != 0))
+            report(i, "block is not 64-byte aligned");
+        const int K = r.dim + (r.rational ? 1 : 0);
+        const std::size_t numCoeffs = static_cast<std::size_t>(r.numPoints) * K;
+        if (!std::all_of(r.coeffs, r.coeffs + numCoeffs, [](double v) { return std::isfinite(v); }))
+            report(i, "non-finite coefficient");
+        if (r.rational) {
+            for (int j = 0; j < r.numPoints; ++j) {
+                if (!(r.coeffs[static_cast<std::size_t>(j) * K + r.dim] > 0.0)) {
+                    report(i, "weights must be positive");
+                    break;
+                }
+            }
+        }
+        if (r.knots)
+            if (const char* err = knotError(r.knots, r.degree, r.numPoints)) report(i, err);
+    }
+    return issues;
+}
+
+// ---------------------------------------------------------------------------
+// CurveFileWriter
+// ---------------------------------------------------------------------------
+
+CurveFileWriter::CurveFileWriter(const std::string& path)
+    : out_(path, std::ios::binary | std::ios::trunc), path_(path) {
+    if (!out_) throw std::runtime_error("CurveFileWriter: cannot open " + path);
+    // 文件头占位，finish() 时回填
+    const char zeros[sizeof(CurveFileHeader)] = {};
+    out_.write(zeros, sizeof(zeros));
+}
+
+CurveFileWriter::~CurveFileWriter() {
+    if (finished_) return;
+    try {
+        finish();
+    } catch (...) {
+    }
+}
+
+std::uint64_t CurveFileWriter::writeBlock(const double* values, std::size_t count) {
+    const std::uint64_t offset = dataSize_;
+    out_.write(reinterpret_cast<const char*>(values), static_cast<std::streamsize>(count * sizeof(double)));
+    dataSize_ += count;
+    // 下一块从 64 字节边界开始
+    const std::size_t pad = (kAlignDoubles - dataSize_ % kAlignDoubles) % kAlignDoubles;
+    const double zeros[kAlignDoubles] = {};
+    out_.write(reinterpret_cast<const char*>(zeros), static_cast<std::streamsize>(pad * sizeof(double)));
+    dataSize_ += pad;
+    if (!out_) throw std::runtime_error("CurveFileWriter: write failed for " + path_);
+    return offset;
+}
+
+std::size_t CurveFileWriter::add(CurveFileType type, int dim, int degree, int numPoints, bool rational,
+                                 const double* coeffs, const double* knots) {
+    if (finished_) throw std::invalid_argument("CurveFileWriter: writer already finished");
+    if (dim < 1 || dim > 3 || degree < 0 || numPoints < 1)
+        throw std::invalid_argument("CurveFileWriter: invalid dimension, degree or point count");
+    CurveFileEntry e = {};
+    e.type = static_cast<std::uint8_t>(type);
+    e.dim = static_cast<std::uint8_t>(dim);
+    e.flags = static_cast<std::uint8_t>((rational ? kCurveFileRational : 0) |
+                                        (type == CurveFileType::BSpline ? kCurveFileKnots : 0));
+    e.numPoints = static_cast<std::uint32_t>(numPoints);
+    e.degree = static_cast<std::uint32_t>(degree);
+    if (const char* err = shapeError(e)) throw std::invalid_argument(std::string("CurveFileWriter: ") + err);
+    if (!coeffs || (type == CurveFileType::BSpline && !knots))
+        throw std::invalid_argument("CurveFileWriter: missing coefficient or knot data");
+
+    e.coeffOffset = writeBlock(coeffs, static_cast<std::size_t>(numPoints) * components(e));
+    if (type == CurveFileType::BSpline) e.knotOffset = writeBlock(knots, static_cast<std::size_t>(numKnots(e)));
+    entries_.push_back(e);
+    return entries_.size() - 1;
+}
+
+std::size_t CurveFileWriter::add(const BezierCurve& curve) {
+    const std::vector<Point2D>& P = curve.controlPoints();
+    std::vector<double> c(2 * P.size());
+    for (std::size_t j = 0; j < P.size(); ++j) {
+        c[2 * j] = P[j].x;
+        c[2 * j + 1] = P[j].y;
+    }
+    return add(CurveFileType::Bezier, 2, curve.degree(), static_cast<int>(P.size()), false, c.data());
+}
+
+std::size_t CurveFileWriter::add(const RationalBezierCurve& curve) {
+    const std::vector<Vec4d>& H = curve.homogeneousPoints();
+    const int dim = curve.dimension();
+    std::vector<double> c;
+    c.reserve(H.size() * (dim + 1));
+    for (const Vec4d& h : H) {
+        for (int d = 0; d < dim; ++d) c.push_back(h[d]);
+        c.push_back(h.w);
+    }
+    return add(CurveFileType::Bezier, dim, curve.degree(), static_cast<int>(H.size()), true, c.data());
+}
+
+std::size_t CurveFileWriter::add(const PowerBasisCurve& curve) {
+    const std::vector<Point2D>& a = curve.coefficients();
+    const std::size_t n = a.size();
+    std::vector<double> c(2 * n);
+    for (std::size_t j = 0; j < n; ++j) {
+        c[j] = a[j].x;
+        c[n + j] = a[j].y;
+    }
+    return add(CurveFileType::PowerBasis, 2, curve.degree(), static_cast<int>(n), false, c.data());
+}
+
+std::size_t CurveFileWriter::add(const PowerBasisCurve1D& curve) {
+    const std::vector<double>& a = curve.coefficients();
+    return add(CurveFileType::PowerBasis, 1, curve.degree(), static_cast<int>(a.size()), false, a.data());
+}
+
+std::size_t CurveFileWriter::add(const PowerBasisCurve2D& curve) {
+    std::size_t n = 0;
+    const std::vector<double> c =
+        packComponents({&curve.xCurve().coefficients(), &curve.yCurve().coefficients()}, n);
+    return add(CurveFileType::PowerBasis, 2, static_cast<int>(n) - 1, static_cast<int>(n), false, c.data());
+}
+
+std::size_t CurveFileWriter::add(const PowerBasisCurve3D& curve) {
+    std::size_t n = 0;
+    const std::vector<double> c = packComponents(
+        {&curve.xCurve().coefficients(), &curve.yCurve().coefficients(), &curve.zCurve().coefficients()}, n);
+    return add(CurveFileType::PowerBasis, 3, static_cast<int>(n) - 1, static_cast<int>(n), false, c.data());
+}
+
+std::size_t CurveFileWriter::add(const NURBS& curve) {
+    const std::vector<Vec4d>& H = curve.homogeneousPoints();
+    const int dim = curve.dimension();
+    const bool rational = std::any_of(H.begin(), H.end(), [](const Vec4d& h) { return h.w != 1.0; });
+    std::vector<double> c;
+    c.reserve(H.size() * (dim + 1));
+    for (const Vec4d& h : H) {
+        for (int d = 0; d < dim; ++d) c.push_back(h[d]);
+        if (rational) c.push_back(h.w);
+    }
+    return add(CurveFileType::BSpline, dim, curve.degree(), static_cast<int>(H.size()), rational, c.data(),
+               curve.knots().data());
+}
+
+template <int Dim>
+void CurveFileWriter::add(const CurveStoreT<Dim>& store) {
+    std::vector<double> c;
+    for (std::size_t i = 0; i < store.size(); ++i) {
+        const int n = store.degree(i) + 1;
+        const double* P = store.data(i);
+        if (store.kind(i) == CurveKind::Bezier) {
+            add(CurveFileType::Bezier, Dim, n - 1, n, false, P);
+            continue;
+        }
+        // 仓库按点连续存放幂基系数，文件按分量连续
+        c.resize(static_cast<std::size_t>(n) * Dim);
+        for (int j = 0; j < n; ++j)
+            for (int d = 0; d < Dim; ++d) c[static_cast<std::size_t>(d) * n + j] = P[j * Dim + d];
+        add(CurveFileType::PowerBasis, Dim, n - 1, n, false, c.data());
+    }
+}
+
+template void CurveFileWriter::add<2>(const CurveStoreT<2>&);
+template void CurveFileWriter::add<3>(const CurveStoreT<3>&);
+
+void CurveFileWriter::finish() {
+    if (finished_) return;
+    finished_ = true;
+    CurveFileHeader h = {};
+    std::memcpy(h.magic, kCurveFileMagic, sizeof(h.magic));
+    h.version = kCurveFileVersion;
+    h.headerSize = sizeof(CurveFileHeader);
+    h.endianTag = kCurveFileEndianTag;
+    h.numCurves = entries_.size();
+    h.dataOffset = sizeof(CurveFileHeader);
+    h.dataSize = dataSize_;
+    // 系数区已按 64 字节对齐收尾，索引紧随其后
+    h.indexOffset = h.dataOffset + dataSize_ * sizeof(double);
+    out_.write(reinterpret_cast<const char*>(entries_.data()),
+               static_cast<std::streamsize>(entries_.size() * sizeof(CurveFileEntry)));
+    out_.seekp(0);
+    out_.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    out_.close();
+    if (!out_) throw std::runtime_error("CurveFileWriter: write failed for " + path_);
+}
+
+} // namespace GeoAlgo
@@ -0,0 +1,278 @@
+#include "CurveFitting.h"
+#include "BandedMatrix.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace GeoAlgo {
+
+namespace {
+
+// 一个组装任务的局部结果：控制点 [row0, row0 + rows) 对应的法方程下带与右端项
+struct AssemblyBlock {
+    int row0 = 0;
+    int rows = 0;
+    std::vector<double> band; // band[r*(p+1) + (i - j)] = Σ N_i N_j，i = row0 + r，j <= i
+    std::vector<double> rhs;  // rhs[r*dim + d]
+};
+
+class LeastSquaresFit {
+public:
+    LeastSquaresFit(const double* Q, std::size_t count, int dim, const std::vector<double>& params, int degree,
+                    bool ends, std::size_t grain, ThreadPool& pool)
+        : Q_(Q), count_(count), dim_(dim), params_(params), p_(degree), ends_(ends),
+          grain_(std::max<std::size_t>(grain, 1)), pool_(pool) {}
+
+    // 固定节点下求解控制点（按点连续），并写出每个数据点的误差
+    void solve(const std::vector<double>& knots, std::vector<double>& ctrl, std::vector<double>& errors) const;
+
+private:
+    std::size_t numTasks() const { return (count_ + grain_ - 1) / grain_; }
+
+    const double* Q_;
+    std::size_t count_;
+    int dim_;
+    const std::vector<double>& params_;
+    int p_;
+    bool ends_;
+    std::size_t grain_;
+    ThreadPool& pool_;
+};
+
+void LeastSquaresFit::solve(const std::vector<double>& knots, std::vector<double>& ctrl,
+                            std::vector<double>& errors) const {
+    const int p = p_, dim = dim_;
+    const int numKnots = static_cast<int>(knots.size());
+    const int n = numKnots - p - 1;
+    // 未知控制点为 [first, last]；固定首末点时它们移到右端项
+    const int first = ends_ ? 1 : 0;
+    const int last = ends_ ? n - 2 : n - 1;
+    const double* Q0 = Q_;
+    const double* Qm = Q_ + (count_ - 1) * dim;
+    ctrl.assign(static_cast<std::size_t>(n) * dim, 0.0);
+    if (ends_) {
+        std::copy(Q0, Q0 + dim, ctrl.begin());
+        std::copy(Qm, Qm + dim, ctrl.begin() + static_cast<std::size_t>(n - 1) * dim);
+    }
+
+    const int nu = last - first + 1;
+    if (nu > 0) {
+        std::vector<AssemblyBlock> blocks(numTasks());
+        pool_.parallelFor(blocks.size(), [&](std::size_t task) {
+            const std::size_t k0 = task * grain_, k1 = std::min(count_, k0 + grain_);
+            AssemblyBlock& b = blocks[task];
+            int span = NURBS::findSpan(knots.data(), numKnots, p, params_[k0]);
+            const int spanLast = NURBS::findSpan(knots.data(), numKnots, p, params_[k1 - 1]);
+            b.row0 = span - p;
+            b.rows = spanLast - span + p + 1;
+            b.band.assign(static_cast<std::size_t>(b.rows) * (p + 1), 0.0);
+            b.rhs.assign(static_cast<std::size_t>(b.rows) * dim, 0.0);
+            double N[NURBS::kMaxDegree + 1];
+            double R[NURBS::kMaxDim];
+            for (std::size_t k = k0; k < k1; ++k) {
+                const double u = params_[k];
+                while (span < n - 1 && u >= knots[span + 1]) ++span;
+                NURBS::basisFunctions(knots.data(), p, span, u, N);
+                for (int d = 0; d < dim; ++d) R[d] = Q_[k * dim + d];
+                if (ends_) {
+                    for (int a = 0; a <= p; ++a) {
+                        const int i = span - p + a;
+                        if (i == 0)
+                            for (int d = 0; d < dim; ++d) R[d] -= N[a] * Q0[d];
+                        if (i == n - 1)
+                            for (int d = 0; d < dim; ++d) R[d] -= N[a] * Qm[d];
+                    }
+                }
+                for (int a = 0; a <= p; ++a) {
+                    const int i = span - p + a;
+                    if (i < first || i > last || N[a] == 0.0) continue;
+                    const int r = i - b.row0;
+                    for (int d = 0; d < dim; ++d) b.rhs[static_cast<std::size_t>(r) * dim + d] += N[a] * R[d];
+                    for (int c = 0; c <= a; ++c)
+                        if (span - p + c >= first) b.band[static_cast<std::size_t>(r) * (p + 1) + (a - c)] += N[a] * N[c];
+                }
+            }
+        });
+
+        // 按块序合并，结果与线程数无关
+        BandedMatrix A(nu, p, 0);
+        std::vector<double> B(static_cast<std::size_t>(nu) * dim, 0.0);
+        for (const AssemblyBlock& b : blocks) {
+            for (int r = 0; r < b.rows; ++r) {
+                const int i = b.row0 + r;
+                if (i < first || i > last) continue;
+                for (int d = 0; d < dim; ++d) B[static_cast<std::size_t>(i - first) * dim + d] += b.rhs[static_cast<std::size_t>(r) * dim + d];
+                for (int off = 0; off <= p && i - off >= first; ++off)
+                    A(i - first, i - off - first) += b.band[static_cast<std::size_t>(r) * (p + 1) + off];
+            }
+        }
+        A.factorCholesky();
+        A.solve(B.data(), dim);
+        std::copy(B.begin(), B.end(), ctrl.begin() + static_cast<std::size_t>(first) * dim);
+    }
+
+    // 各数据点到其参数处曲线点的距离
+    errors.resize(count_);
+    pool_.parallelFor(numTasks(), [&](std::size_t task) {
+        const std::size_t k0 = task * grain_, k1 = std::min(count_, k0 + grain_);
+        int span = NURBS::findSpan(knots.data(), numKnots, p, params_[k0]);
+        double N[NURBS::kMaxDegree + 1];
+        for (std::size_t k = k0; k < k1; ++k) {
+            const double u = params_[k];
+            while (span < n - 1 && u >= knots[span + 1]) ++span;
+            NURBS::basisFunctions(knots.data(), p, span, u, N);
+            double e2 = 0.0;
+            for (int d = 0; d < dim; ++d) {
+                double c = 0.0;
+                for (int a = 0; a <= p; ++a) c += N[a] * ctrl[static_cast<std::size_t>(span - p + a) * dim + d];
+                const double diff = c - Q_[k * dim + d];
+                e2 += diff * diff;
+            }
+            errors[k] = std::sqrt(e2);
+        }
+    });
+}
+
+/**
+ * 在最大误差超过 tol 的节点区间内插入节点（该区间数据参数的中位数），至多 budget 个，
+ * 误差大的区间优先；返回插入的个数
+ */
+int refineKnots(std::vector<double>& knots, int p, const std::vector<double>& params,
+                const std::vector<double>& errors, double tol, int budget) {
+    const int n = static_cast<int>(knots.size()) - p - 1;
+    std::vector<std::pair<double, double>> candidates; // (区间最大误差, 新节点)
+    std::size_t k = 0;
+    const std::size_t count = params.size();
+    for (int span = p; span < n && k < count; ++span) {
+        // 本区间的数据点 [k, end)；最后一个区间包含右端点
+        std::size_t end = k;
+        while (end < count && (params[end] < knots[span + 1] || span == n - 1)) ++end;
+        double worst = 0.0;
+        for (std::size_t j = k; j < end; ++j) worst = std::max(worst, errors[j]);
+        if (worst > tol && end - k >= 2) {
+            const double u = params[k + (end - k) / 2];
+            if (u > knots[span] && u < knots[span + 1] && params[k] < u) candidates.emplace_back(worst, u);
+        }
+        k = end;
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [](const std::pair<double, double>& a, const std::pair<double, double>& b) { return a.first > b.first; });
+    const int inserted = std::min(budget, static_cast<int>(candidates.size()));
+    for (int i = 0; i < inserted; ++i) knots.push_back(candidates[i].second);
+    std::sort(knots.begin(), knots.end());
+    return inserted;
+}
+
+} // namespace
+
+std::vector<double> parameterize(const double* points, std::size_t count, int dim, Parameterization method) {
+    std::vector<double> t(count, 0.0);
+    if (count < 2) return t;
+    if (method != Parameterization::Uniform) {
+        for (std::size_t k = 1; k < count; ++k) {
+            double d2 = 0.0;
+            for (int d = 0; d < dim; ++d) {
+                const double diff = points[k * dim + d] - points[(k - 1) * dim + d];
+                d2 += diff * diff;
+            }
+            const double step = method == Parameterization::ChordLength ? std::sqrt(d2) : std::sqrt(std::sqrt(d2));
+            t[k] = t[k - 1] + step;
+        }
+    }
+    const double total = t.back();
+    if (total > 0.0) {
+        for (double& v : t) v /= total;
+    } else {
+        for (std::size_t k = 0; k < count; ++k) t[k] = static_cast<double>(k) / static_cast<double>(count - 1);
+    }
+    t.back() = 1.0;
+    return t;
+}
+
+std::vector<double> approximationKnots(const std::vector<double>& params, int numControlPoints, int degree) {
+    const int n = numControlPoints, p = degree;
+    if (p < 1 || n < p + 1 || static_cast<std::size_t>(n) > params.size())
+        throw std::invalid_argument("approximationKnots: need degree+1 <= numControlPoints <= number of parameters");
+    std::vector<double> knots(static_cast<std::size_t>(n) + p + 1);
+    std::fill(knots.begin(), knots.begin() + p + 1, params.front());
+    std::fill(knots.end() - (p + 1), knots.end(), params.back());
+    const double d = static_cast<double>(params.size()) / (n - p);
+    for (int j = 1; j < n - p; ++j) {
+        const int i = static_cast<int>(j * d);
+        const double alpha = j * d - i;
+        knots[p + j] = (1.0 - alpha) * params[i - 1] + alpha * params[i];
+    }
+    return knots;
+}
+
+CurveFitResult fitBSpline(const double* points, std::size_t count, int dim, const CurveFitOptions& options) {
+    const int p = options.degree;
+    if (dim < 1 || dim > NURBS::kMaxDim) throw std::invalid_argument("fitBSpline: dimension must be in [1, 3]");
+    if (p < 1 || p > NURBS::kMaxDegree) throw std::invalid_argument("fitBSpline: degree must be in [1, NURBS::kMaxDegree]");
+    if (count < static_cast<std::size_t>(p) + 1) throw std::invalid_argument("fitBSpline: need at least degree+1 points");
+
+    std::vector<double> params = parameterize(points, count, dim, options.parameterization);
+    std::vector<double> knots;
+    if (options.knots.empty()) {
+        knots = approximationKnots(params, std::max(options.numControlPoints, p + 1), p);
+    } else {
+        knots = options.knots;
+        const int n = static_cast<int>(knots.size()) - p - 1;
+        if (n < p + 1 || static_cast<std::size_t>(n) > count || !std::is_sorted(knots.begin(), knots.end()) ||
+            !(knots[p] < knots[n]))
+            throw std::invalid_argument("fitBSpline: invalid knot vector");
+        // 参数映射到节点向量的定义域
+        const double a = knots[p], b = knots[n];
+        for (double& u : params) u = a + (b - a) * u;
+        params.back() = b;
+    }
+    const int maxCtrl = options.maxControlPoints > 0 ? std::min<int>(options.maxControlPoints, static_cast<int>(count))
+                                                     : static_cast<int>(std::min<std::size_t>(count, 1u << 30));
+
+    ThreadPool& pool = options.pool ? *options.pool : ThreadPool::shared();
+    const LeastSquaresFit fit(points, count, dim, params, p, options.interpolateEnds, options.grainPoints, pool);
+    std::vector<double> ctrl, errors;
+    int iterations = 0;
+    double maxError = 0.0, sum2 = 0.0;
+    for (;;) {
+        fit.solve(knots, ctrl, errors);
+        ++iterations;
+        maxError = 0.0;
+        sum2 = 0.0;
+        for (double e : errors) {
+            maxError = std::max(maxError, e);
+            sum2 += e * e;
+        }
+        const int n = static_cast<int>(knots.size()) - p - 1;
+        if (options.tolerance <= 0.0 || maxError <= options.tolerance || iterations >= options.maxIterations ||
+            n >= maxCtrl)
+            break;
+        if (refineKnots(knots, p, params, errors, options.tolerance, maxCtrl - n) == 0) break;
+    }
+
+    CurveFitResult result{NURBS(p, dim, ctrl, knots), std::move(params), maxError,
+                          std::sqrt(sum2 / static_cast<double>(count)), iterations};
+    return result;
+}
+
+CurveFitResult fitBSpline(const std::vector<Point2D>& points, const CurveFitOptions& options) {
+    std::vector<double> raw(points.size() * 2);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        raw[2 * i] = points[i].x;
+        raw[2 * i + 1] = points[i].y;
+    }
+    return fitBSpline(raw.data(), points.size(), 2, options);
+}
+
+CurveFitResult fitBSpline(const std::vector<Vec3d>& points, const CurveFitOptions& options) {
+    std::vector<double> raw(points.size() * 3);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        raw[3 * i] = points[i].x;
+        raw[3 * i + 1] = points[i].y;
+        raw[3 * i + 2] = points[i].z;
+    }
+    return fitBSpline(raw.data(), points.size(), 3, options);
+}
+
+} // namespace GeoAlgo
@@ -0,0 +1,198 @@
+#include "CurveInterpolation.h"
+#include "BandedMatrix.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace GeoAlgo {
+
+namespace {
+
+constexpr std::size_t kInterpolateGrain = 16;
+
+void requireIncreasing(const std::vector<double>& params, const char* who) {
+    for (std::size_t k = 1; k < params.size(); ++k)
+        if (!(params[k] > params[k - 1])) throw std::invalid_argument(std::string(who) + ": consecutive points coincide");
+}
+
+// 求插值控制点（按点连续）与节点向量
+void solveInterpolation(const double* Q, std::size_t count, int dim, int p, Parameterization method,
+                        std::vector<double>& ctrl, std::vector<double>& knots) {
+    if (dim < 1 || dim > NURBS::kMaxDim) throw std::invalid_argument("interpolateBSpline: dimension must be in [1, 3]");
+    if (p < 1 || p > NURBS::kMaxDegree)
+        throw std::invalid_argument("interpolateBSpline: degree must be in [1, NURBS::kMaxDegree]");
+    if (count < static_cast<std::size_t>(p) + 1)
+        throw std::invalid_argument("interpolateBSpline: need at least degree+1 points");
+    const std::vector<double> t = parameterize(Q, count, dim, method);
+    requireIncreasing(t, "interpolateBSpline");
+
+    const int n = static_cast<int>(count);
+    const int numKnots = n + p + 1;
+    knots.assign(numKnots, 0.0);
+    std::fill(knots.end() - (p + 1), knots.end(), 1.0);
+    // 滑动窗口求 p 个相邻参数之和
+    double window = 0.0;
+    for (int i = 1; i <= p; ++i) window += t[i];
+    for (int j = 1; j < n - p; ++j) {
+        knots[p + j] = window / p;
+        window += t[j + p] - t[j];
+    }
+
+    // 配置矩阵：第 k 行的非零元在 [span-p, span]，半带宽小于 p
+    BandedMatrix A(n, p, p);
+    int span = p;
+    double N[NURBS::kMaxDegree + 1];
+    for (int k = 0; k < n; ++k) {
+        while (span < n - 1 && t[k] >= knots[span + 1]) ++span;
+        NURBS::basisFunctions(knots.data(), p, span, t[k], N);
+        for (int a = 0; a <= p; ++a) {
+            const int i = span - p + a;
+            if (N[a] == 0.0) continue;
+            if (!A.inBand(k, i)) throw std::runtime_error("interpolateBSpline: collocation matrix is not banded");
+            A(k, i) = N[a];
+        }
+    }
+    ctrl.assign(Q, Q + count * dim);
+    A.factorLU();
+    A.solve(ctrl.data(), dim);
+}
+
+std::vector<double> flatten(const std::vector<Point2D>& points) {
+    std::vector<double> raw(points.size() * 2);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        raw[2 * i] = points[i].x;
+        raw[2 * i + 1] = points[i].y;
+    }
+    return raw;
+}
+
+std::vector<double> segmentParams(const std::vector<Point2D>& points, Parameterization method, const char* who) {
+    if (points.size() < 2) throw std::invalid_argument(std::string(who) + ": need at least 2 points");
+    const std::vector<double> raw = flatten(points);
+    std::vector<double> t = parameterize(raw.data(), points.size(), 2, method);
+    requireIncreasing(t, who);
+    return t;
+}
+
+} // namespace
+
+NURBS interpolateBSpline(const double* points, std::size_t count, int dim, int degree, Parameterization method) {
+    std::vector<double> ctrl, knots;
+    solveInterpolation(points, count, dim, degree, method, ctrl, knots);
+    return NURBS(degree, dim, ctrl, knots);
+}
+
+NURBS interpolateBSpline(const std::vector<Point2D>& points, int degree, Parameterization method) {
+    const std::vector<double> raw = flatten(points);
+    return interpolateBSpline(raw.data(), points.size(), 2, degree, method);
+}
+
+NURBS interpolateBSpline(const std::vector<Vec3d>& points, int degree, Parameterization method) {
+    std::vector<double> raw(points.size() * 3);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        raw[3 * i] = points[i].x;
+        raw[3 * i + 1] = points[i].y;
+        raw[3 * i + 2] = points[i].z;
+    }
+    return interpolateBSpline(raw.data(), points.size(), 3, degree, method);
+}
+
+std::vector<NURBS> interpolateBSplines(const double* points, const std::size_t* offsets, std::size_t numSequences,
+                                       int dim, int degree, Parameterization method, ThreadPool& pool) {
+    for (std::size_t s = 0; s < numSequences; ++s)
+        if (offsets[s + 1] < offsets[s]) throw std::invalid_argument("interpolateBSplines: offsets must be non-decreasing");
+    // NURBS 没有默认构造，先并行求解，再按序构造
+    std::vector<std::vector<double>> ctrl(numSequences), knots(numSequences);
+    const std::size_t numTasks = (numSequences + kInterpolateGrain - 1) / kInterpolateGrain;
+    pool.parallelFor(numTasks, [&](std::size_t task) {
+        const std::size_t end = std::min(numSequences, (task + 1) * kInterpolateGrain);
+        for (std::size_t s = task * kInterpolateGrain; s < end; ++s)
+            solveInterpolation(points + offsets[s] * dim, offsets[s + 1] - offsets[s], dim, degree, method, ctrl[s],
+                               knots[s]);
+    });
+    std::vector<NURBS> curves;
+    curves.reserve(numSequences);
+    for (std::size_t s = 0; s < numSequences; ++s) curves.emplace_back(degree, dim, ctrl[s], knots[s]);
+    return curves;
+}
+
+std::vector<NURBS> interpolateBSplines(const std::vector<std::vector<Point2D>>& sequences, int degree,
+                                       Parameterization method, ThreadPool& pool) {
+    std::vector<std::size_t> offsets(sequences.size() + 1, 0);
+    for (std::size_t s = 0; s < sequences.size(); ++s) offsets[s + 1] = offsets[s] + sequences[s].size();
+    std::vector<double> raw(offsets.back() * 2);
+    for (std::size_t s = 0; s < sequences.size(); ++s)
+        for (std::size_t i = 0; i < sequences[s].size(); ++i) {
+            raw[2 * (offsets[s] + i)] = sequences[s][i].x;
+            raw[2 * (offsets[s] + i) + 1] = sequences[s][i].y;
+        }
+    return interpolateBSplines(raw.data(), offsets.data(), sequences.size(), 2, degree, method, pool);
+}
+
+std::vector<BezierCurve> hermiteSegments(const std::vector<Point2D>& points, const std::vector<Point2D>& tangents,
+                                         const std::vector<double>& params) {
+    if (tangents.size() != points.size() || params.size() != points.size())
+        throw std::invalid_argument("hermiteSegments: points, tangents and params must have the same size");
+    std::vector<BezierCurve> segments;
+    if (points.size() < 2) return segments;
+    segments.reserve(points.size() - 1);
+    for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+        const double h = (params[i + 1] - params[i]) / 3.0;
+        segments.emplace_back(std::vector<Point2D>{points[i], points[i] + tangents[i] * h,
+                                                   points[i + 1] - tangents[i + 1] * h, points[i + 1]});
+    }
+    return segments;
+}
+
+std::vector<BezierCurve> catmullRomSegments(const std::vector<Point2D>& points, Parameterization method) {
+    const std::vector<double> t = segmentParams(points, method, "catmullRomSegments");
+    const std::size_t n = points.size();
+    std::vector<Point2D> m(n);
+    if (n == 2) {
+        m[0] = m[1] = (points[1] - points[0]) / (t[1] - t[0]);
+    } else {
+        for (std::size_t i = 1; i + 1 < n; ++i) {
+            const double h0 = t[i] - t[i - 1], h1 = t[i + 1] - t[i];
+            const Point2D s0 = (points[i] - points[i - 1]) / h0, s1 = (points[i + 1] - points[i]) / h1;
+            m[i] = (s0 * h1 + s1 * h0) / (h0 + h1);
+        }
+        // 端点：过前（后）三点的抛物线在端点的导数
+        m[0] = (points[1] - points[0]) / (t[1] - t[0]) * 2.0 - m[1];
+        m[n - 1] = (points[n - 1] - points[n - 2]) / (t[n - 1] - t[n - 2]) * 2.0 - m[n - 2];
+    }
+    return hermiteSegments(points, m, t);
+}
+
+std::vector<BezierCurve> cubicSplineSegments(const std::vector<Point2D>& points, Parameterization method) {
+    const std::vector<double> t = segmentParams(points, method, "cubicSplineSegments");
+    const int n = static_cast<int>(points.size());
+    BandedMatrix A(n, 1, 1);
+    std::vector<double> rhs(static_cast<std::size_t>(n) * 2);
+    auto slope = [&](int i) { return (points[i + 1] - points[i]) / (t[i + 1] - t[i]); };
+    auto setRhs = [&](int i, const Point2D& v) {
+        rhs[2 * i] = v.x;
+        rhs[2 * i + 1] = v.y;
+    };
+    // 自然端点条件：2 m_0 + m_1 = 3 s_0，m_{n-2} + 2 m_{n-1} = 3 s_{n-2}
+    A(0, 0) = 2.0;
+    A(0, 1) = 1.0;
+    setRhs(0, slope(0) * 3.0);
+    for (int i = 1; i + 1 < n; ++i) {
+        const double h0 = t[i] - t[i - 1], h1 = t[i + 1] - t[i];
+        A(i, i - 1) = h1;
+        A(i, i) = 2.0 * (h0 + h1);
+        A(i, i + 1) = h0;
+        setRhs(i, (slope(i - 1) * h1 + slope(i) * h0) * 3.0);
+    }
+    A(n - 1, n - 2) = 1.0;
+    A(n - 1, n - 1) = 2.0;
+    setRhs(n - 1, slope(n - 2) * 3.0);
+    A.factorLU();
+    A.solve(rhs.data(), 2);
+
+    std::vector<Point2D> m(n);
+    for (int i = 0; i < n; ++i) m[i] = Point2D(rhs[2 * i], rhs[2 * i + 1]);
+    return hermiteSegments(points, m, t);
+}
+
+} // namespace GeoAlgo
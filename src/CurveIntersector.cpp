@@ -0,0 +1,397 @@
+#include "CurveIntersector.h"
+#include "BasisConversion.h"
+#include "Instrumentation.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace GeoAlgo {
+
+namespace {
+
+constexpr double kFlatness = 1e-3;
+constexpr double kParamTol = 1e-14;
+constexpr double kParamMerge = 1e-7;
+constexpr int kMaxClips = 200;
+constexpr int kMaxNewtonIterations = 16;
+constexpr int kMaxApproachIterations = 32;
+
+double cross(const Point2D& a, const Point2D& b) { return a.x * b.y - a.y * b.x; }
+
+// de Casteljau：在 t 处把 c[0..n] 分成左右两段
+template <typename T>
+void split(const T* c, int n, double t, T* left, T* right, T* work) {
+    std::copy(c, c + n + 1, work);
+    left[0] = work[0];
+    right[n] = work[n];
+    for (int r = 1; r <= n; ++r) {
+        for (int j = 0; j <= n - r; ++j) work[j] = work[j] * (1.0 - t) + work[j + 1] * t;
+        left[r] = work[0];
+        right[n - r] = work[n - r];
+    }
+}
+
+Box2D polygonBox(const Point2D* P, int m) {
+    Box2D box;
+    for (int i = 0; i < m; ++i) box.expand(P[i]);
+    return box;
+}
+
+// 点到线段的距离（线段退化为点时取点距）
+double pointSegmentDistance(const Point2D& p, const Point2D& a, const Point2D& b, double* param = nullptr) {
+    const Point2D ab = b - a;
+    const double L2 = ab.squaredNorm();
+    const double u = L2 > 0.0 ? std::clamp((p - a).dot(ab) / L2, 0.0, 1.0) : 0.0;
+    if (param) *param = u;
+    return p.distanceTo(a + ab * u);
+}
+
+// 内部控制点到弦所在线段的最大距离
+double deviation(const Point2D* P, int n) {
+    double d = 0.0;
+    for (int i = 1; i < n; ++i) d = std::max(d, pointSegmentDistance(P[i], P[0], P[n]));
+    return d;
+}
+
+double segmentDistance(const Point2D& a0, const Point2D& a1, const Point2D& b0, const Point2D& b1) {
+    const Point2D r = a1 - a0;
+    const Point2D q = b1 - b0;
+    const double denom = cross(r, q);
+    if (denom != 0.0) {
+        const double s = cross(b0 - a0, q) / denom;
+        const double t = cross(b0 - a0, r) / denom;
+        if (s >= 0.0 && s <= 1.0 && t >= 0.0 && t <= 1.0) return 0.0;
+    }
+    return std::min({pointSegmentDistance(a0, b0, b1), pointSegmentDistance(a1, b0, b1),
+                     pointSegmentDistance(b0, a0, a1), pointSegmentDistance(b1, a0, a1)});
+}
+
+} // namespace
+
+CurveIntersector::CurveIntersector(double tolerance, int maxDepth)
+    : tolerance_(tolerance), maxDepth_(maxDepth) {
+    if (!(tolerance > 0.0)) throw std::invalid_argument("CurveIntersector: tolerance must be positive");
+    if (maxDepth < 1) throw std::invalid_argument("CurveIntersector: maxDepth must be positive");
+}
+
+void CurveIntersector::intersect(const BezierCurve& curve, const Point2D& p0, const Point2D& p1,
+                                 std::vector<LineHit>& out) const {
+    const int n = curve.degree();
+    if (n < 0) return;
+    const Point2D dir = p1 - p0;
+    const double len = dir.norm();
+    if (!(len > 0.0)) throw std::invalid_argument("CurveIntersector: degenerate line segment");
+
+    const std::size_t first = out.size();
+    auto addHit = [&](double u) {
+        const Point2D p = curve.evaluate(u);
+        double s = (p - p0).dot(dir) / (len * len);
+        const double slack = tolerance_ / len;
+        if (s < -slack || s > 1.0 + slack) return;
+        s = std::clamp(s, 0.0, 1.0);
+        for (std::size_t i = first; i < out.size(); ++i)
+            if (std::fabs(out[i].t - u) <= kParamMerge || out[i].point.distanceTo(p) <= tolerance_) return;
+        out.push_back(LineHit{u, s, p});
+    };
+
+    // 到直线的有符号距离作为一维 Bezier 函数
+    const int m = n + 1;
+    std::vector<double> stack;
+    struct Range {
+        double u0, u1;
+        int depth, clips;
+    };
+    std::vector<Range> ranges{{0.0, 1.0, 0, 0}};
+    for (const Point2D& P : curve.controlPoints()) stack.push_back(cross(dir, P - p0) / len);
+    std::vector<double> c(m), left(m), right(m), work(m);
+
+    while (!ranges.empty()) {
+        const Range rg = ranges.back();
+        ranges.pop_back();
+        std::copy(stack.end() - m, stack.end(), c.begin());
+        stack.resize(stack.size() - m);
+
+        // 整段落在直线上：报告两端
+        double maxAbs = 0.0;
+        for (double v : c) maxAbs = std::max(maxAbs, std::fabs(v));
+        if (maxAbs <= tolerance_) {
+            addHit(rg.u0);
+            addHit(rg.u1);
+            continue;
+        }
+
+        // 控制多边形凸包与 u 轴的交 [lo, hi]
+        double lo = std::numeric_limits<double>::infinity();
+        double hi = -lo;
+        for (int i = 0; i <= n; ++i) {
+            const double xi = n > 0 ? double(i) / n : 0.0;
+            if (std::fabs(c[i]) <= tolerance_) {
+                lo = std::min(lo, xi);
+                hi = std::max(hi, xi);
+            }
+            for (int j = i + 1; j <= n; ++j) {
+                if ((c[i] < 0.0) == (c[j] < 0.0)) continue;
+                const double x = xi + (double(j) / n - xi) * c[i] / (c[i] - c[j]);
+                lo = std::min(lo, x);
+                hi = std::max(hi, x);
+            }
+        }
+        if (lo > hi) continue;
+
+        const double width = rg.u1 - rg.u0;
+        if (width * (hi - lo) <= kParamTol || rg.depth >= maxDepth_ || rg.clips >= kMaxClips) {
+            addHit(rg.u0 + width * 0.5 * (lo + hi));
+            continue;
+        }
+        if (hi - lo > 0.8) {
+            // 收缩不足，可能有多个根：对半细分
+            split(c.data(), n, 0.5, left.data(), right.data(), work.data());
+            const double mid = rg.u0 + 0.5 * width;
+            stack.insert(stack.end(), right.begin(), right.end());
+            ranges.push_back({mid, rg.u1, rg.depth + 1, rg.clips});
+            stack.insert(stack.end(), left.begin(), left.end());
+            ranges.push_back({rg.u0, mid, rg.depth + 1, rg.clips});
+        } else {
+            // 裁剪到 [lo, hi]
+            split(c.data(), n, hi, left.data(), right.data(), work.data());
+            if (hi > 0.0) split(left.data(), n, lo / hi, c.data(), right.data(), work.data());
+            stack.insert(stack.end(), right.begin(), right.end());
+            ranges.push_back({rg.u0 + width * lo, rg.u0 + width * hi, rg.depth, rg.clips + 1});
+        }
+    }
+
+    std::sort(out.begin() + first, out.end(), [](const LineHit& a, const LineHit& b) { return a.t < b.t; });
+}
+
+void CurveIntersector::intersect(const BezierCurve& a, const BezierCurve& b, std::vector<Hit>& out) const {
+    const std::size_t first = out.size();
+    Scratch sc;
+    intersectPair(a, b, 0, 1, out, sc);
+    std::sort(out.begin() + first, out.end(), [](const Hit& x, const Hit& y) { return x.tA < y.tA; });
+}
+
+bool CurveIntersector::newton(const BezierCurve& a, const BezierCurve& b, double& s, double& t) const {
+    const double tol2 = tolerance_ * tolerance_;
+    for (int it = 0; it <= kMaxNewtonIterations; ++it) {
+        Point2D A[2], B[2];
+        a.evaluateDerivatives(s, 1, A);
+        b.evaluateDerivatives(t, 1, B);
+        const Point2D F = A[0] - B[0];
+        if (F.squaredNorm() <= tol2) return true;
+        if (it == kMaxNewtonIterations) break;
+        // [A' -B'] (ds, dt)^T = -F
+        const double det = cross(A[1], -B[1]);
+        if (!(std::fabs(det) > 1e-14 * A[1].norm() * B[1].norm())) return false;
+        const double ds = cross(-F, -B[1]) / det;
+        const double dt = cross(A[1], -F) / det;
+        s = std::clamp(s + ds, 0.0, 1.0);
+        t = std::clamp(t + dt, 0.0, 1.0);
+    }
+    return false;
+}
+
+bool CurveIntersector::closestApproach(const BezierCurve& a, const BezierCurve& b, double& s, double& t) const {
+    // 交替投影：固定一条曲线上的点，在另一条曲线上做一步 Newton 投影
+    auto step = [](const BezierCurve& c, double& u, const Point2D& q) {
+        Point2D d[3];
+        c.evaluateDerivatives(u, 2, d);
+        const Point2D r = d[0] - q;
+        const double fp = d[1].squaredNorm() + d[2].dot(r);
+        if (fp > 0.0) u = std::clamp(u - d[1].dot(r) / fp, 0.0, 1.0);
+    };
+    for (int it = 0; it < kMaxApproachIterations; ++it) {
+        step(a, s, b.evaluate(t));
+        step(b, t, a.evaluate(s));
+    }
+    return a.evaluate(s).distanceTo(b.evaluate(t)) <= tolerance_;
+}
+
+void CurveIntersector::addHit(std::vector<Hit>& out, std::size_t first, const Hit& hit, double radius) const {
+    for (std::size_t i = first; i < out.size(); ++i) {
+        const Hit& h = out[i];
+        if (std::fabs(h.tA - hit.tA) <= kParamMerge && std::fabs(h.tB - hit.tB) <= kParamMerge) return;
+        if (h.point.distanceTo(hit.point) <= radius) return;
+    }
+    out.push_back(hit);
+}
+
+void CurveIntersector::intersectPair(const BezierCurve& a, const BezierCurve& b, int ia, int ib,
+                                     std::vector<Hit>& out, Scratch& sc) const {
+    const int na = a.degree();
+    const int nb = b.degree();
+    if (na < 0 || nb < 0) return;
+    const int ma = na + 1;
+    const int mb = nb + 1;
+    const std::size_t first = out.size();
+
+    sc.pieces.assign(1, Piece{0, ma, 0.0, 1.0, 0.0, 1.0, 0});
+    sc.points.assign(a.controlPoints().begin(), a.controlPoints().end());
+    sc.points.insert(sc.points.end(), b.controlPoints().begin(), b.controlPoints().end());
+    const int mw = std::max(ma, mb);
+    sc.work.resize(ma + mb + 3 * mw);
+    Point2D* PA = sc.work.data();
+    Point2D* PB = PA + ma;
+    Point2D* left = PB + mb;
+    Point2D* right = left + mw;
+    Point2D* work = right + mw;
+
+    auto record = [&](double s, double t) {
+        addHit(out, first, Hit{ia, ib, s, t, a.evaluate(s)}, tolerance_);
+    };
+    // 相切交点的参数只能精确到约 sqrt(tolerance)，按此半径合并
+    auto recordContact = [&](double s, double t) {
+        addHit(out, first, Hit{ia, ib, s, t, a.evaluate(s)}, std::sqrt(tolerance_));
+    };
+
+    while (!sc.pieces.empty()) {
+        const Piece pc = sc.pieces.back();
+        sc.pieces.pop_back();
+        std::copy(sc.points.begin() + pc.offsetA, sc.points.begin() + pc.offsetA + ma, PA);
+        std::copy(sc.points.begin() + pc.offsetB, sc.points.begin() + pc.offsetB + mb, PB);
+        sc.points.resize(pc.offsetA);
+
+        const Box2D boxA = polygonBox(PA, ma);
+        const Box2D boxB = polygonBox(PB, mb);
+        const Point2D grow = Point2D::filled(tolerance_);
+        if (!Box2D(boxA.lo - grow, boxA.hi + grow).overlaps(boxB)) continue;
+
+        const double devA = deviation(PA, na);
+        const double devB = deviation(PB, nb);
+        const double lenA = PA[na].distanceTo(PA[0]);
+        const double lenB = PB[nb].distanceTo(PB[0]);
+        const bool flatA = devA <= std::max(tolerance_, kFlatness * lenA);
+        const bool flatB = devB <= std::max(tolerance_, kFlatness * lenB);
+
+        if (flatA && flatB) {
+            // 曲线段落在各自弦的 dev 邻域内
+            const double slack = devA + devB + tolerance_;
+            if (segmentDistance(PA[0], PA[na], PB[0], PB[nb]) > slack) continue;
+            const Point2D r = PA[na] - PA[0];
+            const Point2D q = PB[nb] - PB[0];
+            const double denom = cross(r, q);
+            if (std::fabs(denom) > 1e-12 * lenA * lenB) {
+                const double sA = std::clamp(cross(PB[0] - PA[0], q) / denom, 0.0, 1.0);
+                const double sB = std::clamp(cross(PB[0] - PA[0], r) / denom, 0.0, 1.0);
+                double s = pc.a0 + (pc.a1 - pc.a0) * sA;
+                double t = pc.b0 + (pc.b1 - pc.b0) * sB;
+                const double wa = pc.a1 - pc.a0;
+                const double wb = pc.b1 - pc.b0;
+                auto inWindow = [&] {
+                    return s >= pc.a0 - wa && s <= pc.a1 + wa && t >= pc.b0 - wb && t <= pc.b1 + wb;
+                };
+                if (newton(a, b, s, t) && inWindow()) {
+                    record(s, t);
+                    continue;
+                }
+                // Newton 在切点处退化：改求两曲线最近点，距离在容差内即为相切交点
+                s = pc.a0 + wa * sA;
+                t = pc.b0 + wb * sB;
+                if (closestApproach(a, b, s, t) && inWindow()) {
+                    recordContact(s, t);
+                    continue;
+                }
+            } else {
+                // 平行且相距在容差内：共线重叠，报告重叠区间的端点
+                for (int e = 0; e < 2; ++e) {
+                    double u;
+                    const Point2D& pa = e ? PA[na] : PA[0];
+                    if (pointSegmentDistance(pa, PB[0], PB[nb], &u) <= slack)
+                        record(e ? pc.a1 : pc.a0, pc.b0 + (pc.b1 - pc.b0) * u);
+                    const Point2D& pb = e ? PB[nb] : PB[0];
+                    if (pointSegmentDistance(pb, PA[0], PA[na], &u) <= slack)
+                        record(pc.a0 + (pc.a1 - pc.a0) * u, e ? pc.b1 : pc.b0);
+                }
+                continue;
+            }
+        }
+
+        const double diagA = (boxA.hi - boxA.lo).norm();
+        const double diagB = (boxB.hi - boxB.lo).norm();
+        if ((diagA <= tolerance_ && diagB <= tolerance_) || pc.depth >= maxDepth_) {
+            // 子段已缩到容差以内
+            recordContact(0.5 * (pc.a0 + pc.a1), 0.5 * (pc.b0 + pc.b1));
+            continue;
+        }
+
+        // 细分包围盒较大的一段
+        const int offset = static_cast<int>(sc.points.size());
+        if (diagA >= diagB) {
+            split(PA, na, 0.5, left, right, work);
+            const double mid = 0.5 * (pc.a0 + pc.a1);
+            sc.points.insert(sc.points.end(), right, right + ma);
+            sc.points.insert(sc.points.end(), PB, PB + mb);
+            sc.points.insert(sc.points.end(), left, left + ma);
+            sc.points.insert(sc.points.end(), PB, PB + mb);
+            sc.pieces.push_back(Piece{offset, offset + ma, mid, pc.a1, pc.b0, pc.b1, pc.depth + 1});
+            sc.pieces.push_back(Piece{offset + ma + mb, offset + 2 * ma + mb, pc.a0, mid, pc.b0, pc.b1,
+                                      pc.depth + 1});
+        } else {
+            split(PB, nb, 0.5, left, right, work);
+            const double mid = 0.5 * (pc.b0 + pc.b1);
+            sc.points.insert(sc.points.end(), PA, PA + ma);
+            sc.points.insert(sc.points.end(), right, right + mb);
+            sc.points.insert(sc.points.end(), PA, PA + ma);
+            sc.points.insert(sc.points.end(), left, left + mb);
+            sc.pieces.push_back(Piece{offset, offset + ma, pc.a0, pc.a1, mid, pc.b1, pc.depth + 1});
+            sc.pieces.push_back(Piece{offset + ma + mb, offset + 2 * ma + mb, pc.a0, pc.a1, pc.b0, mid,
+                                      pc.depth + 1});
+        }
+    }
+}
+
+std::vector<CurveIntersector::Hit> CurveIntersector::intersectAll(const BezierCurve* curves, std::size_t count,
+                                                                  ThreadPool& pool) const {
+    GEOALGO_SCOPED_TIMER(Timer::Intersection);
+    // 包围盒按 lo.x 排序（相同时按下标），扫描 x 区间重叠的曲线
+    std::vector<Box2D> boxes(count);
+    std::vector<int> order;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (curves[i].degree() < 0) continue;
+        const std::vector<Point2D>& P = curves[i].controlPoints();
+        boxes[i] = polygonBox(P.data(), static_cast<int>(P.size()));
+        boxes[i].lo -= Point2D(tolerance_, tolerance_);
+        boxes[i].hi += Point2D(tolerance_, tolerance_);
+        order.push_back(static_cast<int>(i));
+    }
+    std::sort(order.begin(), order.end(), [&](int x, int y) {
+        return boxes[x].lo.x < boxes[y].lo.x || (boxes[x].lo.x == boxes[y].lo.x && x < y);
+    });
+
+    const std::size_t m = order.size();
+    const std::size_t numTasks = (m + kSweepGrain - 1) / kSweepGrain;
+    std::vector<std::vector<Hit>> results(numTasks);
+    pool.parallelFor(numTasks, [&](std::size_t task) {
+        Scratch sc;
+        const std::size_t end = std::min(m, (task + 1) * kSweepGrain);
+        for (std::size_t k = task * kSweepGrain; k < end; ++k) {
+            const int i = order[k];
+            for (std::size_t l = k + 1; l < m && boxes[order[l]].lo.x <= boxes[i].hi.x; ++l) {
+                const int j = order[l];
+                if (!boxes[i].overlaps(boxes[j])) continue;
+                const int ia = std::min(i, j);
+                const int ib = std::max(i, j);
+                intersectPair(curves[ia], curves[ib], ia, ib, results[task], sc);
+            }
+        }
+    });
+
+    std::vector<Hit> hits;
+    for (const auto& r : results) hits.insert(hits.end(), r.begin(), r.end());
+    std::sort(hits.begin(), hits.end(), [](const Hit& x, const Hit& y) {
+        if (x.curveA != y.curveA) return x.curveA < y.curveA;
+        if (x.curveB != y.curveB) return x.curveB < y.curveB;
+        if (x.tA != y.tA) return x.tA < y.tA;
+        return x.tB < y.tB;
+    });
+    return hits;
+}
+
+std::vector<CurveIntersector::Hit> CurveIntersector::intersectAll(const PowerBasisCurve* curves, std::size_t count,
+                                                                  ThreadPool& pool) const {
+    std::vector<BezierCurve> bezier(count);
+    toBezier(curves, count, bezier.data(), pool);
+    return intersectAll(bezier.data(), count, pool);
+}
+
+} // namespace GeoAlgo
@@ -0,0 +1,24 @@
+#include "CurveKernels.h"
+#include <stdexcept>
+#include <vector>
+
+namespace GeoAlgo {
+
+const double* binomialTableRow(int n) {
+    // 行 n 起始于 n*(n+1)/2
+    static const std::vector<double> table = [] {
+        std::vector<double> t((kMaxTableDegree + 1) * (kMaxTableDegree + 2) / 2);
+        for (int r = 0; r <= kMaxTableDegree; ++r) {
+            double* row = t.data() + r * (r + 1) / 2;
+            const double* prev = t.data() + (r - 1) * r / 2;
+            row[0] = row[r] = 1.0;
+            for (int i = 1; i < r; ++i) row[i] = prev[i - 1] + prev[i];
+        }
+        return t;
+    }();
+    if (n < 0 || n > kMaxTableDegree)
+        throw std::out_of_range("binomialTableRow: degree exceeds kMaxTableDegree");
+    return table.data() + n * (n + 1) / 2;
+}
+
+} // namespace GeoAlgo
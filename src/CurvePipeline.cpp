@@ -0,0 +1,456 @@
+#include "CurvePipeline.h"
+#include "BasisConversion.h"
+#include "Instrumentation.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace GeoAlgo {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/**
+ * 阶段间的阻塞队列：close() 后取完剩余元素即结束，abort() 立即结束
+ */
+template <typename T>
+class Channel {
+public:
+    void push(T value) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            items_.push_back(value);
+        }
+        cv_.notify_one();
+    }
+
+    bool pop(T& value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [&] { return !items_.empty() || closed_; });
+        if (aborted_ || items_.empty()) return false;
+        value = items_.front();
+        items_.pop_front();
+        return true;
+    }
+
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        cv_.notify_all();
+    }
+
+    void abort() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = aborted_ = true;
+        }
+        cv_.notify_all();
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<T> items_;
+    bool closed_ = false;
+    bool aborted_ = false;
+};
+
+// 定义域上 count 个等距参数
+void sampleParams(const CurveFile::Record& r, std::size_t count, double* ts) {
+    const double t0 = r.firstParam(), t1 = r.lastParam();
+    if (count == 1) {
+        ts[0] = t0;
+        return;
+    }
+    const double step = (t1 - t0) / static_cast<double>(count - 1);
+    for (std::size_t k = 0; k < count; ++k) ts[k] = t0 + step * static_cast<double>(k);
+    ts[count - 1] = t1;
+}
+
+/**
+ * 记录转为齐次 Bezier 控制点后有界离散，至多写入 capacity 个点，返回写入的点数
+ * 超出上限时离散器改为整个定义域上的等距采样，truncated 置为 true
+ */
+std::size_t tessellateRecord(const AdaptiveTessellator& tess, const CurveFile::Record& r, Vec3d* out,
+                             double* params, std::size_t capacity, std::vector<Vec4d>& scratch, bool& truncated) {
+    if (r.degree > AdaptiveTessellator::kMaxDegree)
+        throw std::invalid_argument("CurvePipeline: curve degree exceeds AdaptiveTessellator::kMaxDegree");
+    const int p = r.degree;
+    if (r.type == CurveFileType::BSpline)
+        return tess.tessellateBounded(toNURBS(r), out, capacity, params, &truncated);
+
+    scratch.resize(p + 1);
+    if (r.type == CurveFileType::Bezier) {
+        const int K = r.dim + (r.rational ? 1 : 0);
+        for (int i = 0; i <= p; ++i) {
+            const double* h = r.coeffs + static_cast<std::size_t>(i) * K;
+            Vec4d& P = scratch[i];
+            P = Vec4d();
+            for (int d = 0; d < r.dim; ++d) P[d] = h[d];
+            P.w = r.rational ? h[r.dim] : 1.0;
+        }
+    } else {
+        // 按分量连续的幂基系数先转为按点连续，再换成 Bezier 控制点
+        double power[(AdaptiveTessellator::kMaxDegree + 1) * 3];
+        double bezier[(AdaptiveTessellator::kMaxDegree + 1) * 3];
+        for (int i = 0; i <= p; ++i)
+            for (int d = 0; d < r.dim; ++d) power[i * r.dim + d] = r.coeffs[static_cast<std::size_t>(d) * r.numPoints + i];
+        powerToBezier(power, p, r.dim, bezier);
+        for (int i = 0; i <= p; ++i) {
+            Vec4d& P = scratch[i];
+            P = Vec4d();
+            for (int d = 0; d < r.dim; ++d) P[d] = bezier[i * r.dim + d];
+            P.w = 1.0;
+        }
+    }
+    const double breaks[2] = { 0.0, 1.0 };
+    return tess.tessellateBounded(scratch.data(), p, breaks, 1, out, capacity, params, &truncated);
+}
+
+std::runtime_error parseError(std::size_t line, const std::string& message) {
+    return std::runtime_error("CurveTextSource: line " + std::to_string(line) + ": " + message);
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// 来源与输出
+// ---------------------------------------------------------------------------
+
+CurveFileSource::CurveFileSource(const CurveFile& file, std::size_t first, std::size_t count)
+    : file_(file), next_(std::min(first, file.size())), end_(next_ + std::min(count, file.size() - next_)) {}
+
+std::size_t CurveFileSource::read(CurveChunk& chunk, std::size_t maxCurves) {
+    const std::size_t n = std::min(maxCurves, end_ - next_);
+    for (std::size_t i = 0; i < n; ++i) chunk.records.push_back(file_.record(next_ + i));
+    next_ += n;
+    return n;
+}
+
+CurveTextSource::CurveTextSource(std::istream& in) : in_(in) {}
+
+std::size_t CurveTextSource::read(CurveChunk& chunk, std::size_t maxCurves) {
+    coeffOffsets_.clear();
+    knotOffsets_.clear();
+    while (chunk.records.size() < maxCurves && std::getline(in_, buffer_)) {
+        ++line_;
+        const char* s = buffer_.c_str();
+        while (*s == ' ' || *s == '\t' || *s == '\r') ++s;
+        if (*s == '\0' || *s == '#') continue;
+        const char* word = s;
+        while (*s && *s != ' ' && *s != '\t') ++s;
+        const std::string type(word, s);
+
+        values_.clear();
+        for (;;) {
+            char* end = nullptr;
+            const double v = std::strtod(s, &end);
+            if (end == s) break;
+            if (!std::isfinite(v)) throw parseError(line_, "numbers must be finite");
+            values_.push_back(v);
+            s = end;
+        }
+        while (*s == ' ' || *s == '\t' || *s == '\r') ++s;
+        if (*s != '\0') throw parseError(line_, "unexpected token '" + std::string(s) + "'");
+
+        CurveFile::Record r = {};
+        bool weighted = false, spline = false;
+        if (type == "bezier") {
+            r.type = CurveFileType::Bezier;
+        } else if (type == "rbezier") {
+            r.type = CurveFileType::Bezier;
+            weighted = true;
+        } else if (type == "power") {
+            r.type = CurveFileType::PowerBasis;
+        } else if (type == "bspline") {
+            r.type = CurveFileType::BSpline;
+            spline = true;
+        } else if (type == "nurbs") {
+            r.type = CurveFileType::BSpline;
+            spline = weighted = true;
+        } else {
+            throw parseError(line_, "unknown curve type '" + type + "'");
+        }
+        const std::size_t numHeader = spline ? 3 : 2;
+        if (values_.size() < numHeader) throw parseError(line_, "missing dimension, degree or point count");
+        for (std::size_t i = 0; i < numHeader; ++i)
+            if (!(values_[i] >= 0.0 && values_[i] <= 1e6 && values_[i] == static_cast<int>(values_[i])))
+                throw parseError(line_, "dimension, degree and point count must be non-negative integers");
+        r.dim = static_cast<int>(values_[0]);
+        r.degree = static_cast<int>(values_[1]);
+        r.numPoints = spline ? static_cast<int>(values_[2]) : r.degree + 1;
+        r.rational = weighted;
+        // 形状检查只关心 knots 是否为空，此处先指向任意非空地址
+        r.knots = spline ? values_.data() : nullptr;
+        if (const char* err = r.error()) throw parseError(line_, err);
+
+        const int textComps = r.dim + (weighted ? 1 : 0);
+        const std::size_t numKnots = spline ? static_cast<std::size_t>(r.numPoints) + r.degree + 1 : 0;
+        const std::size_t expected = numHeader + static_cast<std::size_t>(r.numPoints) * textComps + numKnots;
+        if (values_.size() != expected)
+            throw parseError(line_, "expected " + std::to_string(expected - numHeader) + " numbers, got " +
+                                        std::to_string(values_.size() - numHeader));
+
+        const double* v = values_.data() + numHeader;
+        coeffOffsets_.push_back(chunk.storage.size());
+        if (r.type == CurveFileType::PowerBasis) {
+            // 文本按点连续，存储按分量连续
+            const std::size_t base = chunk.storage.size();
+            chunk.storage.resize(base + static_cast<std::size_t>(r.numPoints) * r.dim);
+            for (int i = 0; i < r.numPoints; ++i)
+                for (int d = 0; d < r.dim; ++d)
+                    chunk.storage[base + static_cast<std::size_t>(d) * r.numPoints + i] = v[i * r.dim + d];
+        } else {
+            for (int i = 0; i < r.numPoints; ++i, v += textComps) {
+                // 有理曲线存为齐次坐标 (w*P, w)
+                const double w = weighted ? v[r.dim] : 1.0;
+                if (!(w > 0.0)) throw parseError(line_, "weights must be positive");
+                for (int d = 0; d < r.dim; ++d) chunk.storage.push_back(v[d] * w);
+                if (weighted) chunk.storage.push_back(w);
+            }
+        }
+        knotOffsets_.push_back(chunk.storage.size());
+        if (spline) {
+            const double* U = values_.data() + numHeader + static_cast<std::size_t>(r.numPoints) * textComps;
+            if (!std::is_sorted(U, U + numKnots)) throw parseError(line_, "knots must be non-decreasing");
+            if (!(U[r.degree] < U[r.numPoints])) throw parseError(line_, "empty parameter domain");
+            chunk.storage.insert(chunk.storage.end(), U, U + numKnots);
+        }
+        chunk.records.push_back(r);
+    }
+    for (std::size_t i = 0; i < chunk.records.size(); ++i) {
+        CurveFile::Record& r = chunk.records[i];
+        r.coeffs = chunk.storage.data() + coeffOffsets_[i];
+        if (r.knots) r.knots = chunk.storage.data() + knotOffsets_[i];
+    }
+    next_ += chunk.records.size();
+    return chunk.records.size();
+}
+
+TextPointSink::TextPointSink(std::ostream& out, int precision) : out_(out), precision_(precision) {}
+
+void TextPointSink::write(const PointChunk& chunk) {
+    const std::streamsize saved = out_.precision(precision_);
+    for (std::size_t c = 0; c < chunk.numCurves(); ++c) {
+        const std::size_t curve = chunk.firstCurve + c;
+        for (std::size_t k = chunk.offsets[c]; k < chunk.offsets[c + 1]; ++k) {
+            out_ << curve << ' ' << chunk.params[k];
+            for (int d = 0; d < chunk.dims[c]; ++d) out_ << ' ' << chunk.points[k][d];
+            out_ << '\n';
+        }
+    }
+    out_.precision(saved);
+    if (!out_) throw std::runtime_error("TextPointSink: write failed");
+}
+
+void BinaryPointSink::write(const PointChunk& chunk) {
+    for (std::size_t c = 0; c < chunk.numCurves(); ++c) {
+        const std::uint64_t header[2] = {chunk.firstCurve + c, chunk.offsets[c + 1] - chunk.offsets[c]};
+        out_.write(reinterpret_cast<const char*>(header), sizeof(header));
+        const int dim = chunk.dims[c];
+        buffer_.clear();
+        for (std::size_t k = chunk.offsets[c]; k < chunk.offsets[c + 1]; ++k)
+            for (int d = 0; d < dim; ++d) buffer_.push_back(chunk.points[k][d]);
+        out_.write(reinterpret_cast<const char*>(buffer_.data()),
+                   static_cast<std::streamsize>(buffer_.size() * sizeof(double)));
+    }
+    if (!out_) throw std::runtime_error("BinaryPointSink: write failed");
+}
+
+std::string PipelineStats::toText() const {
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(3);
+    os << "curves " << curves << ", points " << points << ", chunks " << chunks;
+    if (truncatedCurves) os << ", truncated " << truncatedCurves;
+    os << "\ntime " << seconds << " s (read " << readSeconds << ", compute " << computeSeconds << ", write "
+       << writeSeconds << ")\nthroughput " << std::setprecision(0) << curvesPerSecond() << " curves/s, "
+       << pointsPerSecond() << " points/s\nbuffers " << std::setprecision(2) << bufferBytes / (1024.0 * 1024.0)
+       << " MiB\n";
+    return os.str();
+}
+
+// ---------------------------------------------------------------------------
+// 流水线
+// ---------------------------------------------------------------------------
+
+CurvePipeline::CurvePipeline(const CurvePipelineOptions& options)
+    : options_(options), tessellator_(options.tolerance, options.maxDepth) {
+    if (options.chunkCurves == 0) throw std::invalid_argument("CurvePipeline: chunkCurves must be positive");
+    if (options.mode == CurvePipelineOptions::Mode::Evaluate && options.samplesPerCurve == 0)
+        throw std::invalid_argument("CurvePipeline: samplesPerCurve must be positive");
+    if (options.mode == CurvePipelineOptions::Mode::Tessellate && options.maxPointsPerCurve < 2)
+        throw std::invalid_argument("CurvePipeline: maxPointsPerCurve must be at least 2");
+    if (options.chunkBytes == 0) throw std::invalid_argument("CurvePipeline: chunkBytes must be positive");
+    // 每条曲线在输出块中占 slot 个点和参数，块内曲线数受 chunkBytes 限制
+    const std::size_t slot = options.mode == CurvePipelineOptions::Mode::Tessellate ? options.maxPointsPerCurve
+                                                                                   : options.samplesPerCurve;
+    const std::size_t perCurve = slot * (sizeof(Vec3d) + sizeof(double));
+    chunkCurves_ = std::min(options.chunkCurves, std::max<std::size_t>(1, options.chunkBytes / perCurve));
+}
+
+void CurvePipeline::compute(const CurveChunk& in, PointChunk& out, std::size_t& truncated) const {
+    const std::size_t n = in.size();
+    const bool tessellate = options_.mode == CurvePipelineOptions::Mode::Tessellate;
+    // 每条曲线在输出缓冲区中先占一个定长槽位
+    const std::size_t slot = tessellate ? options_.maxPointsPerCurve : options_.samplesPerCurve;
+    out.firstCurve = in.firstCurve;
+    out.dims.resize(n);
+    out.offsets.assign(n + 1, 0);
+    if (out.points.size() < n * slot) {
+        out.points.resize(n * slot);
+        out.params.resize(n * slot);
+    }
+
+    ThreadPool& pool = options_.pool ? *options_.pool : ThreadPool::shared();
+    const std::size_t grain = std::max<std::size_t>(options_.grainCurves, 1);
+    std::atomic<std::size_t> numTruncated{0};
+    pool.parallelFor((n + grain - 1) / grain, [&](std::size_t task) {
+        std::vector<Vec4d> scratch;
+        const std::size_t c1 = std::min(n, (task + 1) * grain);
+        for (std::size_t c = task * grain; c < c1; ++c) {
+            const CurveFile::Record& r = in.records[c];
+            Vec3d* P = out.points.data() + c * slot;
+            double* T = out.params.data() + c * slot;
+            out.dims[c] = r.dim;
+            std::size_t count = slot;
+            if (tessellate) {
+                bool capped = false;
+                count = tessellateRecord(tessellator_, r, P, T, slot, scratch, capped);
+                if (capped) numTruncated.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                sampleParams(r, slot, T);
+                evaluateRecordMany(r, T, slot, P);
+            }
+            out.offsets[c + 1] = count;
+        }
+    });
+
+    // 前缀和得到偏移，离散结果再向前压紧（目标位置不超过源位置）
+    for (std::size_t c = 0; c < n; ++c) {
+        const std::size_t count = out.offsets[c + 1];
+        out.offsets[c + 1] = out.offsets[c] + count;
+        if (tessellate && out.offsets[c] != c * slot) {
+            std::copy(out.points.begin() + c * slot, out.points.begin() + c * slot + count,
+                      out.points.begin() + out.offsets[c]);
+            std::copy(out.params.begin() + c * slot, out.params.begin() + c * slot + count,
+                      out.params.begin() + out.offsets[c]);
+        }
+    }
+    truncated += numTruncated.load();
+}
+
+PipelineStats CurvePipeline::run(CurveSource& source, PointSink& sink) const {
+    const Clock::time_point start = Clock::now();
+    PipelineStats stats;
+
+    CurveChunk inBuffers[2];
+    PointChunk outBuffers[2];
+    Channel<CurveChunk*> freeIn, fullIn;
+    Channel<PointChunk*> freeOut, fullOut;
+    for (int i = 0; i < 2; ++i) {
+        freeIn.push(&inBuffers[i]);
+        freeOut.push(&outBuffers[i]);
+    }
+
+    std::mutex errorMutex;
+    std::exception_ptr error;
+    auto fail = [&](std::exception_ptr e) {
+        {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) error = e;
+        }
+        freeIn.abort();
+        fullIn.abort();
+        freeOut.abort();
+        fullOut.abort();
+    };
+
+    double readSeconds = 0.0, writeSeconds = 0.0;
+    std::thread reader([&] {
+        try {
+            std::size_t next = 0;
+            CurveChunk* chunk = nullptr;
+            while (freeIn.pop(chunk)) {
+                const Clock::time_point t = Clock::now();
+                chunk->clear();
+                chunk->firstCurve = next;
+                const std::size_t n = source.read(*chunk, chunkCurves_);
+                readSeconds += secondsSince(t);
+                if (n == 0) break;
+                next += n;
+                fullIn.push(chunk);
+            }
+            fullIn.close();
+        } catch (...) {
+            fail(std::current_exception());
+        }
+    });
+    std::thread writer([&] {
+        try {
+            PointChunk* chunk = nullptr;
+            while (fullOut.pop(chunk)) {
+                const Clock::time_point t = Clock::now();
+                sink.write(*chunk);
+                writeSeconds += secondsSince(t);
+                freeOut.push(chunk);
+            }
+        } catch (...) {
+            fail(std::current_exception());
+        }
+    });
+
+    try {
+        CurveChunk* in = nullptr;
+        PointChunk* out = nullptr;
+        while (fullIn.pop(in) && freeOut.pop(out)) {
+            const Clock::time_point t = Clock::now();
+            {
+                GEOALGO_SCOPED_TIMER(Timer::BatchEvaluation);
+                compute(*in, *out, stats.truncatedCurves);
+            }
+            stats.computeSeconds += secondsSince(t);
+            stats.curves += in->size();
+            stats.points += out->numPoints();
+            ++stats.chunks;
+            freeIn.push(in);
+            fullOut.push(out);
+        }
+        fullOut.close();
+    } catch (...) {
+        fail(std::current_exception());
+    }
+    reader.join();
+    writer.join();
+    if (error) std::rethrow_exception(error);
+
+    stats.readSeconds = readSeconds;
+    stats.writeSeconds = writeSeconds;
+    stats.seconds = secondsSince(start);
+    // 缓冲区容量只增不减，结束时即为峰值
+    for (const CurveChunk& c : inBuffers)
+        stats.bufferBytes += c.records.capacity() * sizeof(CurveFile::Record) + c.storage.capacity() * sizeof(double);
+    for (const PointChunk& c : outBuffers)
+        stats.bufferBytes += c.points.capacity() * sizeof(Vec3d) + c.params.capacity() * sizeof(double) +
+                             c.offsets.capacity() * sizeof(std::size_t) + c.dims.capacity() * sizeof(int);
+    return stats;
+}
+
+} // namespace GeoAlgo
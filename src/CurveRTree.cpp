@@ -0,0 +1,184 @@
+#include "CurveRTree.h"
+#include "CurveBounds.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace GeoAlgo {
+
+namespace {
+
+// 并行计算包围盒与打包节点时每个任务处理的条目数
+constexpr std::size_t kBuildGrain = 1024;
+
+template <typename Curve>
+std::vector<Box2D> curveBounds(const std::vector<Curve>& curves, ThreadPool& pool) {
+    const std::size_t n = curves.size();
+    std::vector<Box2D> boxes(n);
+    pool.parallelFor((n + kBuildGrain - 1) / kBuildGrain, [&](std::size_t task) {
+        const std::size_t c1 = std::min(n, (task + 1) * kBuildGrain);
+        for (std::size_t c = task * kBuildGrain; c < c1; ++c) boxes[c] = exactBounds(curves[c]);
+    });
+    return boxes;
+}
+
+/**
+ * STR 排序：条目（下标为 boxes 的下标）按中心 x 排序后切成竖带，带内按中心 y 排序
+ * 竖带长度是 kNodeCapacity 的整数倍，排序后每 kNodeCapacity 个连续条目即一个节点
+ * 中心相同时按下标排序，结果与线程数无关
+ */
+std::vector<int> strOrder(const std::vector<Box2D>& boxes, ThreadPool& pool) {
+    constexpr std::size_t M = CurveRTree::kNodeCapacity;
+    const std::size_t n = boxes.size();
+    std::vector<Point2D> centers(n);
+    for (std::size_t i = 0; i < n; ++i) centers[i] = boxes[i].center();
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return std::make_pair(centers[a].x, a) < std::make_pair(centers[b].x, b);
+    });
+
+    const std::size_t numNodes = (n + M - 1) / M;
+    const std::size_t numSlabs = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(numNodes))));
+    const std::size_t slab = (numNodes + numSlabs - 1) / numSlabs * M;
+    pool.parallelFor((n + slab - 1) / slab, [&](std::size_t s) {
+        auto first = order.begin() + s * slab;
+        auto last = order.begin() + std::min(n, (s + 1) * slab);
+        std::sort(first, last, [&](int a, int b) {
+            return std::make_pair(centers[a].y, a) < std::make_pair(centers[b].y, b);
+        });
+    });
+    return order;
+}
+
+} // namespace
+
+CurveRTree::CurveRTree(std::vector<Box2D> boxes, ThreadPool& pool) : boxes_(std::move(boxes)) {
+    build(pool);
+}
+
+CurveRTree::CurveRTree(const std::vector<BezierCurve>& curves, ThreadPool& pool)
+    : boxes_(curveBounds(curves, pool)) {
+    build(pool);
+}
+
+CurveRTree::CurveRTree(const std::vector<PowerBasisCurve2D>& curves, ThreadPool& pool)
+    : boxes_(curveBounds(curves, pool)) {
+    build(pool);
+}
+
+CurveRTree::CurveRTree(const std::vector<NURBS>& curves, ThreadPool& pool) : boxes_(curveBounds(curves, pool)) {
+    build(pool);
+}
+
+void CurveRTree::build(ThreadPool& pool) {
+    constexpr std::size_t M = kNodeCapacity;
+    levels_.clear();
+    // 空包围盒（如空曲线）不参与排序与打包，中心为 NaN 会破坏排序的严格弱序
+    std::vector<int> live;
+    std::vector<Box2D> liveBoxes;
+    live.reserve(boxes_.size());
+    liveBoxes.reserve(boxes_.size());
+    for (std::size_t i = 0; i < boxes_.size(); ++i) {
+        const Box2D& b = boxes_[i];
+        if (std::isnan(b.lo.x) || std::isnan(b.lo.y) || std::isnan(b.hi.x) || std::isnan(b.hi.y))
+            throw std::invalid_argument("CurveRTree: bounding box has NaN coordinates");
+        if (b.empty()) continue;
+        live.push_back(static_cast<int>(i));
+        liveBoxes.push_back(b);
+    }
+    items_.clear();
+    if (live.empty()) return;
+    items_ = strOrder(liveBoxes, pool);
+    for (int& item : items_) item = live[item];
+
+    // 把 count 个已按 STR 排好的条目每 M 个打包成一个节点
+    auto pack = [&](std::size_t count, auto&& boxOf) {
+        std::vector<Node> nodes((count + M - 1) / M);
+        pool.parallelFor((nodes.size() + kBuildGrain - 1) / kBuildGrain, [&](std::size_t task) {
+            const std::size_t i1 = std::min(nodes.size(), (task + 1) * kBuildGrain);
+            for (std::size_t i = task * kBuildGrain; i < i1; ++i) {
+                Node& nd = nodes[i];
+                nd.first = static_cast<int>(i * M);
+                nd.count = static_cast<int>(std::min(M, count - i * M));
+                for (int j = nd.first; j < nd.first + nd.count; ++j) nd.box.expand(boxOf(j));
+            }
+        });
+        return nodes;
+    };
+
+    levels_.push_back(pack(items_.size(), [&](int j) -> const Box2D& { return boxes_[items_[j]]; }));
+    while (levels_.back().size() > 1) {
+        // 本层节点按 STR 重新排列（子区间随节点移动），再打包出上一层
+        std::vector<Node>& lower = levels_.back();
+        std::vector<Box2D> boxes(lower.size());
+        for (std::size_t i = 0; i < lower.size(); ++i) boxes[i] = lower[i].box;
+        const std::vector<int> order = strOrder(boxes, pool);
+        std::vector<Node> sorted(lower.size());
+        for (std::size_t i = 0; i < order.size(); ++i) sorted[i] = lower[order[i]];
+        lower.swap(sorted);
+        std::vector<Node> upper = pack(lower.size(), [&](int j) -> const Box2D& { return levels_.back()[j].box; });
+        levels_.push_back(std::move(upper));
+    }
+}
+
+std::size_t CurveRTree::query(const Box2D& window, std::vector<int>& out) const {
+    const std::size_t before = out.size();
+    if (levels_.empty()) return 0;
+    // 深度优先；子节点逆序入栈，输出按 STR 顺序
+    std::vector<std::pair<int, int>> stack;
+    stack.emplace_back(height() - 1, 0);
+    while (!stack.empty()) {
+        const std::pair<int, int> top = stack.back();
+        stack.pop_back();
+        const Node& nd = levels_[top.first][top.second];
+        if (!nd.box.overlaps(window)) continue;
+        if (top.first == 0) {
+            for (int j = nd.first; j < nd.first + nd.count; ++j)
+                if (boxes_[items_[j]].overlaps(window)) out.push_back(items_[j]);
+        } else {
+            for (int j = nd.first + nd.count - 1; j >= nd.first; --j) stack.emplace_back(top.first - 1, j);
+        }
+    }
+    return out.size() - before;
+}
+
+std::vector<CurveRTree::Neighbor> CurveRTree::nearest(const Point2D& q, std::size_t k,
+                                                      const std::function<double(int, const Point2D&)>& distance) const {
+    std::vector<Neighbor> result;
+    if (levels_.empty() || k == 0) return result;
+
+    // (距离平方, 种类, 层, 下标)：种类 0 为待展开的节点或只有下界的对象（层 -1，下标为编号），
+    // 种类 1 为距离已确定的对象；距离相同时先展开，保证结果按 (距离, 编号) 有序
+    using Entry = std::tuple<double, int, int, int>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    heap.emplace(levels_.back()[0].box.squaredDistanceTo(q), 0, height() - 1, 0);
+    while (!heap.empty() && result.size() < k) {
+        const Entry e = heap.top();
+        heap.pop();
+        const int kind = std::get<1>(e), level = std::get<2>(e), index = std::get<3>(e);
+        if (kind == 1) {
+            result.push_back(Neighbor{index, std::sqrt(std::get<0>(e))});
+        } else if (level < 0) {
+            const double d = distance(index, q);
+            heap.emplace(d * d, 1, -1, index);
+        } else {
+            const Node& nd = levels_[level][index];
+            for (int j = nd.first; j < nd.first + nd.count; ++j) {
+                if (level > 0) {
+                    heap.emplace(levels_[level - 1][j].box.squaredDistanceTo(q), 0, level - 1, j);
+                } else {
+                    const int id = items_[j];
+                    heap.emplace(boxes_[id].squaredDistanceTo(q), distance ? 0 : 1, -1, id);
+                }
+            }
+        }
+    }
+    return result;
+}
+
+} // namespace GeoAlgo
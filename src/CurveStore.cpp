@@ -0,0 +1,170 @@
+#include "CurveStore.h"
+#include "PowerBasisKernel.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace GeoAlgo {
+
+template <int Dim>
+void CurveStoreT<Dim>::reserve(std::size_t numCurves, std::size_t numPoints) {
+    kinds_.reserve(numCurves);
+    offsets_.reserve(numCurves + 1);
+    coords_.reserve(numPoints * Dim);
+}
+
+template <int Dim>
+void CurveStoreT<Dim>::clear() {
+    coords_.clear();
+    kinds_.clear();
+    offsets_.assign(1, 0);
+    releaseSoA();
+}
+
+template <int Dim>
+std::size_t CurveStoreT<Dim>::append(CurveKind kind, const double* coords, std::size_t numPoints) {
+    if (numPoints == 0)
+        throw std::invalid_argument("CurveStore: curve needs at least one point");
+    if (numPoints > static_cast<std::size_t>(kMaxTableDegree) + 1)
+        throw std::invalid_argument("CurveStore: degree exceeds kMaxTableDegree");
+    coords_.insert(coords_.end(), coords, coords + numPoints * Dim);
+    offsets_.push_back(offsets_.back() + numPoints);
+    kinds_.push_back(static_cast<std::uint8_t>(kind));
+    soaValid_ = false;
+    return kinds_.size() - 1;
+}
+
+template <int Dim>
+std::size_t CurveStoreT<Dim>::append(CurveKind kind, const std::vector<Point>& points) {
+    std::vector<double> flat;
+    flat.reserve(points.size() * Dim);
+    for (const auto& p : points)
+        for (int d = 0; d < Dim; ++d) flat.push_back(p[d]);
+    return append(kind, flat.data(), points.size());
+}
+
+template <int Dim>
+std::size_t CurveStoreT<Dim>::append(const BezierCurve& curve) {
+    std::vector<Point> pts;
+    for (const auto& p : curve.controlPoints())
+        pts.push_back(Point::generate([&](int d) { return d < 2 ? p[d] : 0.0; }));
+    return append(CurveKind::Bezier, pts);
+}
+
+template <int Dim>
+std::size_t CurveStoreT<Dim>::append(const PowerBasisCurve& curve) {
+    std::vector<Point> pts;
+    for (const auto& p : curve.coefficients())
+        pts.push_back(Point::generate([&](int d) { return d < 2 ? p[d] : 0.0; }));
+    return append(CurveKind::PowerBasis, pts);
+}
+
+template <int Dim>
+std::size_t CurveStoreT<Dim>::append(const PowerBasisCurve2D& curve) {
+    const std::vector<double>* comps[2] = {&curve.xCurve().coefficients(), &curve.yCurve().coefficients()};
+    const std::size_t order = std::max(comps[0]->size(), comps[1]->size());
+    std::vector<Point> pts(order);
+    for (int d = 0; d < 2; ++d)
+        for (std::size_t i = 0; i < comps[d]->size(); ++i) pts[i][d] = (*comps[d])[i];
+    return append(CurveKind::PowerBasis, pts);
+}
+
+template <int Dim>
+std::size_t CurveStoreT<Dim>::append(const PowerBasisCurve3D& curve) {
+    if constexpr (Dim != 3) {
+        (void)curve;
+        throw std::invalid_argument("CurveStore: PowerBasisCurve3D requires a 3D store");
+    } else {
+        const std::vector<double>* comps[3] = {&curve.xCurve().coefficients(), &curve.yCurve().coefficients(),
+                                               &curve.zCurve().coefficients()};
+        const std::size_t order = std::max({comps[0]->size(), comps[1]->size(), comps[2]->size()});
+        std::vector<Point> pts(order);
+        for (int d = 0; d < 3; ++d)
+            for (std::size_t i = 0; i < comps[d]->size(); ++i) pts[i][d] = (*comps[d])[i];
+        return append(CurveKind::PowerBasis, pts);
+    }
+}
+
+template <int Dim>
+void CurveStoreT<Dim>::bulkLoad(const double* coords, const std::size_t* offsets, std::size_t numCurves,
+                                const CurveKind* kinds, CurveKind kind) {
+    if (offsets[0] != 0)
+        throw std::invalid_argument("CurveStore: offsets must start at 0");
+    for (std::size_t c = 0; c < numCurves; ++c) {
+        const std::size_t n = offsets[c + 1] - offsets[c];
+        if (offsets[c + 1] <= offsets[c] || n > static_cast<std::size_t>(kMaxTableDegree) + 1)
+            throw std::invalid_argument("CurveStore: invalid curve size in offsets");
+    }
+    const std::size_t base = offsets_.back();
+    const std::size_t numPoints = offsets[numCurves];
+    coords_.insert(coords_.end(), coords, coords + numPoints * Dim);
+    offsets_.reserve(offsets_.size() + numCurves);
+    kinds_.reserve(kinds_.size() + numCurves);
+    for (std::size_t c = 0; c < numCurves; ++c) {
+        offsets_.push_back(base + offsets[c + 1]);
+        kinds_.push_back(static_cast<std::uint8_t>(kinds ? kinds[c] : kind));
+    }
+    soaValid_ = false;
+}
+
+template <int Dim>
+typename CurveStoreT<Dim>::Point CurveStoreT<Dim>::point(std::size_t c, int i) const {
+    const double* p = data(c) + i * Dim;
+    return Point::generate([&](int d) { return p[d]; });
+}
+
+template <int Dim>
+void CurveStoreT<Dim>::buildSoA() {
+    soa_.resize(coords_.size());
+    for (std::size_t c = 0; c < size(); ++c) {
+        const std::size_t order = offsets_[c + 1] - offsets_[c];
+        const double* src = data(c);
+        double* dst = soa_.data() + offsets_[c] * Dim;
+        for (std::size_t i = 0; i < order; ++i)
+            for (int d = 0; d < Dim; ++d) dst[d * order + i] = src[i * Dim + d];
+    }
+    soaValid_ = true;
+}
+
+template <int Dim>
+void CurveStoreT<Dim>::releaseSoA() {
+    std::vector<double>().swap(soa_);
+    soaValid_ = false;
+}
+
+template <int Dim>
+typename CurveStoreT<Dim>::Point CurveStoreT<Dim>::evaluate(std::size_t c, double u) const {
+    return kind(c) == CurveKind::Bezier ? bezierPoint<Dim>(data(c), degree(c), u)
+                                        : powerBasisPoint<Dim>(data(c), degree(c), u);
+}
+
+template <int Dim>
+void CurveStoreT<Dim>::evaluateMany(std::size_t c, const double* us, std::size_t count, Point* out) const {
+    const double* P = data(c);
+    const int n = degree(c);
+    if (kind(c) == CurveKind::Bezier) {
+        for (std::size_t k = 0; k < count; ++k) out[k] = bezierPoint<Dim>(P, n, us[k]);
+    } else {
+        for (std::size_t k = 0; k < count; ++k) out[k] = powerBasisPoint<Dim>(P, n, us[k]);
+    }
+}
+
+template <int Dim>
+void CurveStoreT<Dim>::evaluateMany(std::size_t c, const double* us, std::size_t count,
+                                    double* const* outs) const {
+    if (kind(c) == CurveKind::PowerBasis && soaValid_) {
+        evaluatePowerBasisSoA(soaData(c), Dim, degree(c) + 1, us, count, outs);
+        return;
+    }
+    const double* P = data(c);
+    const int n = degree(c);
+    const bool bezier = kind(c) == CurveKind::Bezier;
+    for (std::size_t k = 0; k < count; ++k) {
+        const Point p = bezier ? bezierPoint<Dim>(P, n, us[k]) : powerBasisPoint<Dim>(P, n, us[k]);
+        for (int d = 0; d < Dim; ++d) outs[d][k] = p[d];
+    }
+}
+
+template class CurveStoreT<2>;
+template class CurveStoreT<3>;
+
+} // namespace GeoAlgo
@@ -0,0 +1,216 @@
+#include "Instrumentation.h"
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <vector>
+
+namespace GeoAlgo {
+namespace instrumentation {
+
+namespace {
+
+// 与 Counter / Timer 的枚举顺序一致
+const char* const kCounterNames[kNumCounters] = {
+    "bezier_evaluations",       "power_basis_evaluations",  "rational_evaluations", "nurbs_evaluations",
+    "nurbs_basis_computations", "derivative_constructions", "tessellated_curves",   "tessellation_points",
+    "basis_conversions",        "knot_insertions",          "bezier_decompositions", "allocations",
+    "allocated_bytes",          "deallocations"};
+
+const char* const kTimerNames[kNumTimers] = {
+    "batch_evaluation", "tessellation",     "basis_conversion",
+    "bezier_decomposition", "intersection", "arc_length_build"};
+
+/**
+ * 线程计数块登记表
+ * 可能在 operator new 内部、静态初始化之前或静态析构之后被访问，
+ * 因此放在静态存储中就地构造且从不析构；计数块用 malloc 分配，避免递归进入 operator new
+ */
+struct Registry {
+    std::mutex mutex;
+    std::vector<detail::ThreadBlock*> live;
+    Snapshot retired; // 已退出线程的累计值
+};
+
+Registry& registry() {
+    alignas(Registry) static unsigned char storage[sizeof(Registry)];
+    static Registry* r = new (storage) Registry();
+    return *r;
+}
+
+void accumulate(Snapshot& s, const detail::ThreadBlock& b) {
+    for (int i = 0; i < kNumCounters; ++i) s.counters[i] += b.counters[i].load(std::memory_order_relaxed);
+    for (int i = 0; i < kNumTimers; ++i) {
+        s.timers[i].calls += b.timerCalls[i].load(std::memory_order_relaxed);
+        s.timers[i].nanoseconds += b.timerNanos[i].load(std::memory_order_relaxed);
+    }
+}
+
+void clear(detail::ThreadBlock& b) {
+    for (auto& a : b.counters) a.store(0, std::memory_order_relaxed);
+    for (auto& a : b.timerCalls) a.store(0, std::memory_order_relaxed);
+    for (auto& a : b.timerNanos) a.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * 线程的 ThreadGuard 已析构（线程退出或静态析构阶段）
+ * 之后的 operator new/delete 仍可能计数，此时不再登记新块；平凡类型的 thread_local 没有析构，随时可读
+ */
+thread_local bool tlsDestroyed = false;
+
+// 线程退出后的计数落到这里，从不汇总
+detail::ThreadBlock& discardBlock() {
+    alignas(detail::ThreadBlock) static unsigned char storage[sizeof(detail::ThreadBlock)];
+    static detail::ThreadBlock* b = new (storage) detail::ThreadBlock();
+    return *b;
+}
+
+// 线程退出时把计数块并入累计值并注销
+struct ThreadGuard {
+    ~ThreadGuard() {
+        tlsDestroyed = true;
+        detail::ThreadBlock* b = detail::tlsBlock;
+        if (!b) return;
+        {
+            Registry& r = registry();
+            std::lock_guard<std::mutex> lock(r.mutex);
+            accumulate(r.retired, *b);
+            for (std::size_t i = 0; i < r.live.size(); ++i) {
+                if (r.live[i] == b) {
+                    r.live[i] = r.live.back();
+                    r.live.pop_back();
+                    break;
+                }
+            }
+        }
+        detail::tlsBlock = nullptr;
+        b->~ThreadBlock();
+        std::free(b);
+    }
+};
+
+} // namespace
+
+namespace detail {
+
+ThreadBlock* registerThread() {
+    if (tlsDestroyed) return &discardBlock();
+    void* mem = std::malloc(sizeof(ThreadBlock));
+    if (!mem) throw std::bad_alloc();
+    ThreadBlock* b = new (mem) ThreadBlock();
+    clear(*b);
+    // 先设置线程指针，登记时 vector 扩容触发的 operator new 计数直接落到本块
+    tlsBlock = b;
+    static thread_local ThreadGuard guard;
+    (void)guard;
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.live.push_back(b);
+    return b;
+}
+
+} // namespace detail
+
+const char* counterName(Counter c) {
+    const int i = static_cast<int>(c);
+    return i >= 0 && i < kNumCounters ? kCounterNames[i] : "unknown";
+}
+
+const char* timerName(Timer t) {
+    const int i = static_cast<int>(t);
+    return i >= 0 && i < kNumTimers ? kTimerNames[i] : "unknown";
+}
+
+bool libraryInstrumented() {
+    return kEnabled;
+}
+
+Snapshot Snapshot::operator-(const Snapshot& base) const {
+    Snapshot d;
+    for (int i = 0; i < kNumCounters; ++i) d.counters[i] = counters[i] - base.counters[i];
+    for (int i = 0; i < kNumTimers; ++i) {
+        d.timers[i].calls = timers[i].calls - base.timers[i].calls;
+        d.timers[i].nanoseconds = timers[i].nanoseconds - base.timers[i].nanoseconds;
+    }
+    return d;
+}
+
+std::string Snapshot::toText() const {
+    std::ostringstream os;
+    for (int i = 0; i < kNumCounters; ++i) os << kCounterNames[i] << ' ' << counters[i] << '\n';
+    for (int i = 0; i < kNumTimers; ++i)
+        os << kTimerNames[i] << ' ' << timers[i].calls << " calls " << timers[i].nanoseconds << " ns\n";
+    return os.str();
+}
+
+std::string Snapshot::toJson() const {
+    std::ostringstream os;
+    os << "{\"counters\": {";
+    for (int i = 0; i < kNumCounters; ++i)
+        os << (i ? ", " : "") << '"' << kCounterNames[i] << "\": " << counters[i];
+    os << "}, \"timers\": {";
+    for (int i = 0; i < kNumTimers; ++i)
+        os << (i ? ", " : "") << '"' << kTimerNames[i] << "\": {\"calls\": " << timers[i].calls
+           << ", \"ns\": " << timers[i].nanoseconds << '}';
+    os << "}}";
+    return os.str();
+}
+
+Snapshot snapshot() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    Snapshot s = r.retired;
+    for (const detail::ThreadBlock* b : r.live) accumulate(s, *b);
+    return s;
+}
+
+void reset() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.retired = Snapshot();
+    for (detail::ThreadBlock* b : r.live) clear(*b);
+}
+
+} // namespace instrumentation
+} // namespace GeoAlgo
+
+#ifdef GEOALGO_ENABLE_INSTRUMENTATION
+
+// 全局分配计数：替换 operator new / delete，数组与 nothrow 版本默认转发到这里
+void* operator new(std::size_t size) {
+    GEOALGO_COUNT(Counter::Allocations);
+    GEOALGO_COUNT_N(Counter::AllocatedBytes, size);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    if (!p) return;
+    GEOALGO_COUNT(Counter::Deallocations);
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    ::operator delete(p);
+}
+
+// 超对齐类型（如 Vec4d）走对齐版本
+void* operator new(std::size_t size, std::align_val_t align) {
+    GEOALGO_COUNT(Counter::Allocations);
+    GEOALGO_COUNT_N(Counter::AllocatedBytes, size);
+    // aligned_alloc 要求字节数为对齐值的整数倍
+    const std::size_t a = static_cast<std::size_t>(align);
+    const std::size_t bytes = (size + a - 1) / a * a;
+    if (void* p = std::aligned_alloc(a, bytes ? bytes : a)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    ::operator delete(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+    ::operator delete(p);
+}
+
+#endif
@@ -1,17 +1,486 @@
 #include "NURBS.h"
+#include "CurveKernels.h"
+#include "Instrumentation.h"
+#include <algorithm>
 #include <stdexcept>
+#include <utility>
 
 namespace GeoAlgo {
 
+namespace {
+
+// 顺序推进区间时最多线性前进的步数，超过后改用二分
+constexpr int kMaxWalkSteps = 8;
+
+int multiplicity(const std::vector<double>& U, double u) {
+    const auto range = std::equal_range(U.begin(), U.end(), u);
+    return static_cast<int>(range.second - range.first);
+}
+
+} // namespace
+
 NURBS::NURBS(const std::vector<double>& ctrl, int deg)
-    : controlPoints_(ctrl), degree_(deg) {}
+    : NURBS(deg, 1, ctrl, clampedUniformKnots(static_cast<int>(ctrl.size()), deg)) {}
+
+NURBS::NURBS(int degree, int dim,
+             const std::vector<double>& controlPoints,
+             const std::vector<double>& knots,
+             const std::vector<double>& weights)
+    : degree_(degree), dim_(dim), knots_(knots) {
+    if (dim < 1 || dim > kMaxDim)
+        throw std::invalid_argument("NURBS: dimension must be in [1, kMaxDim]");
+    if (controlPoints.size() % dim != 0)
+        throw std::invalid_argument("NURBS: control point array size is not a multiple of dim");
+    initHomogeneous(controlPoints.data(), controlPoints.size() / dim, weights);
+}
+
+NURBS::NURBS(int degree,
+             const std::vector<Point2D>& controlPoints,
+             const std::vector<double>& knots,
+             const std::vector<double>& weights)
+    : degree_(degree), dim_(2), knots_(knots) {
+    std::vector<double> flat;
+    flat.reserve(controlPoints.size() * 2);
+    for (const auto& p : controlPoints) {
+        flat.push_back(p.x);
+        flat.push_back(p.y);
+    }
+    initHomogeneous(flat.data(), controlPoints.size(), weights);
+}
+
+std::vector<double> NURBS::clampedUniformKnots(int numControlPoints, int degree) {
+    if (numControlPoints <= degree || degree < 0)
+        throw std::invalid_argument("NURBS: need at least degree+1 control points");
+    const int n = numControlPoints - 1;
+    const int m = n + degree + 1;
+    std::vector<double> U(m + 1);
+    const int interior = n - degree; // 内部节点个数
+    for (int i = 0; i <= m; ++i) {
+        if (i <= degree) U[i] = 0.0;
+        else if (i >= m - degree) U[i] = 1.0;
+        else U[i] = static_cast<double>(i - degree) / (interior + 1);
+    }
+    return U;
+}
+
+NURBS::NURBS(int degree, int dim, std::vector<double> knots, std::vector<Vec4d> Pw, HomogeneousTag)
+    : degree_(degree), dim_(dim), knots_(std::move(knots)), Pw_(std::move(Pw)) {}
+
+void NURBS::initHomogeneous(const double* points, std::size_t count, const std::vector<double>& weights) {
+    if (degree_ < 0 || degree_ > kMaxDegree)
+        throw std::invalid_argument("NURBS: degree must be in [0, kMaxDegree]");
+    if (count < static_cast<std::size_t>(degree_) + 1)
+        throw std::invalid_argument("NURBS: need at least degree+1 control points");
+    if (knots_.size() != count + degree_ + 1)
+        throw std::invalid_argument("NURBS: knot vector size must be n+p+1");
+    if (!weights.empty() && weights.size() != count)
+        throw std::invalid_argument("NURBS: weight count does not match control points");
+    if (!std::is_sorted(knots_.begin(), knots_.end()))
+        throw std::invalid_argument("NURBS: knot vector must be non-decreasing");
+    if (!(knots_[degree_] < knots_[count]))
+        throw std::invalid_argument("NURBS: empty parameter domain");
+
+    Pw_.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const double w = weights.empty() ? 1.0 : weights[i];
+        if (!(w > 0.0))
+            throw std::invalid_argument("NURBS: weights must be positive");
+        Vec3d p;
+        for (int d = 0; d < dim_; ++d) p[d] = points[i * dim_ + d];
+        Pw_[i] = toHomogeneous(p, w);
+    }
+}
+
+double NURBS::clampParam(double u) const {
+    return std::min(std::max(u, firstParam()), lastParam());
+}
+
+int NURBS::findSpan(double u) const {
+    return findSpan(knots_, degree_, u);
+}
+
+int NURBS::findSpan(const std::vector<double>& knots, int degree, double u) {
+    return findSpan(knots.data(), static_cast<int>(knots.size()), degree, u);
+}
+
+int NURBS::findSpan(const double* knots, int numKnots, int degree, double u) {
+    const int n = numKnots - degree - 2;
+    if (u >= knots[n + 1]) return n;
+    if (u <= knots[degree]) return degree;
+    // 在 [u_{p+1}, u_{n+1}) 中找第一个大于 u 的节点
+    const double* it = std::upper_bound(knots + degree + 1, knots + n + 1, u);
+    return static_cast<int>(it - knots) - 1;
+}
+
+int NURBS::advanceSpan(int span, double u) const {
+    const int n = numControlPoints() - 1;
+    if (u < knots_[span]) return findSpan(u);
+    for (int step = 0; span < n && u >= knots_[span + 1]; ++step) {
+        if (step == kMaxWalkSteps) return findSpan(u);
+        ++span;
+    }
+    return span;
+}
+
+void NURBS::basisFunctions(int span, double u, double* N) const {
+    basisFunctions(knots_, degree_, span, u, N);
+}
+
+void NURBS::basisFunctions(const std::vector<double>& knots, int degree, int span, double u, double* N) {
+    basisFunctions(knots.data(), degree, span, u, N);
+}
+
+void NURBS::basisFunctions(const double* knots, int degree, int span, double u, double* N) {
+    GEOALGO_COUNT(Counter::NURBSBasisComputations);
+    double left[kMaxDegree + 1];
+    double right[kMaxDegree + 1];
+    N[0] = 1.0;
+    for (int j = 1; j <= degree; ++j) {
+        left[j] = u - knots[span + 1 - j];
+        right[j] = knots[span + j] - u;
+        double saved = 0.0;
+        for (int r = 0; r < j; ++r) {
+            const double temp = N[r] / (right[r + 1] + left[j - r]);
+            N[r] = saved + right[r + 1] * temp;
+            saved = left[j - r] * temp;
+        }
+        N[j] = saved;
+    }
+}
+
+Vec4d NURBS::homogeneousInSpan(int span, double u) const {
+    GEOALGO_COUNT(Counter::NURBSEvaluations);
+    double N[kMaxDegree + 1];
+    basisFunctions(span, u, N);
+
+    const Vec4d* P = Pw_.data() + (span - degree_);
+    Vec4d Cw = P[0] * N[0];
+    for (int j = 1; j <= degree_; ++j) Cw += P[j] * N[j];
+    return Cw;
+}
 
 double NURBS::evaluate(double u) const {
-    // 暂时返回一个简单结果，便于验证工程
-    if (controlPoints_.empty()) return 0.0;
-    size_t idx = static_cast<size_t>(u * (controlPoints_.size() - 1));
-    if (idx >= controlPoints_.size()) idx = controlPoints_.size() - 1;
-    return controlPoints_[idx];
+    return evaluatePoint3D(u).x;
+}
+
+void NURBS::evaluate(double u, double* out) const {
+    const Vec3d p = evaluatePoint3D(u);
+    for (int d = 0; d < dim_; ++d) out[d] = p[d];
+}
+
+Vec4d NURBS::evaluateHomogeneous(double u) const {
+    u = clampParam(u);
+    return homogeneousInSpan(findSpan(u), u);
+}
+
+Point2D NURBS::evaluatePoint(double u) const {
+    return fromHomogeneous<2>(evaluateHomogeneous(u));
+}
+
+Vec3d NURBS::evaluatePoint3D(double u) const {
+    return fromHomogeneous<3>(evaluateHomogeneous(u));
+}
+
+void NURBS::evaluateMany(const double* us, std::size_t count, double* out) const {
+    if (count == 0) return;
+    int span = findSpan(clampParam(us[0]));
+    for (std::size_t k = 0; k < count; ++k, out += dim_) {
+        const double u = clampParam(us[k]);
+        span = advanceSpan(span, u);
+        const Vec3d p = fromHomogeneous<3>(homogeneousInSpan(span, u));
+        for (int d = 0; d < dim_; ++d) out[d] = p[d];
+    }
+}
+
+void NURBS::basisFunctionDerivatives(const std::vector<double>& knots, int degree, int span,
+                                     double u, int n, double* ders) {
+    GEOALGO_COUNT(Counter::NURBSBasisComputations);
+    const int p = degree;
+    const int order = p + 1;
+    double ndu[(kMaxDegree + 1) * (kMaxDegree + 1)]; // ndu[j*order + r]
+    double a[2][kMaxDegree + 1];
+    double left[kMaxDegree + 1];
+    double right[kMaxDegree + 1];
+    auto NDU = [&](int row, int col) -> double& { return ndu[row * order + col]; };
+
+    // 基函数与节点差（下三角存节点差，上三角存基函数）
+    NDU(0, 0) = 1.0;
+    for (int j = 1; j <= p; ++j) {
+        left[j] = u - knots[span + 1 - j];
+        right[j] = knots[span + j] - u;
+        double saved = 0.0;
+        for (int r = 0; r < j; ++r) {
+            NDU(j, r) = right[r + 1] + left[j - r];
+            const double temp = NDU(r, j - 1) / NDU(j, r);
+            NDU(r, j) = saved + right[r + 1] * temp;
+            saved = left[j - r] * temp;
+        }
+        NDU(j, j) = saved;
+    }
+    for (int j = 0; j <= p; ++j) ders[j] = NDU(j, p);
+
+    // 导数
+    for (int r = 0; r <= p; ++r) {
+        int s1 = 0, s2 = 1;
+        a[0][0] = 1.0;
+        for (int k = 1; k <= n; ++k) {
+            double d = 0.0;
+            const int rk = r - k;
+            const int pk = p - k;
+            if (r >= k) {
+                a[s2][0] = a[s1][0] / NDU(pk + 1, rk);
+                d = a[s2][0] * NDU(rk, pk);
+            }
+            const int j1 = (rk >= -1) ? 1 : -rk;
+            const int j2 = (r - 1 <= pk) ? k - 1 : p - r;
+            for (int j = j1; j <= j2; ++j) {
+                a[s2][j] = (a[s1][j] - a[s1][j - 1]) / NDU(pk + 1, rk + j);
+                d += a[s2][j] * NDU(rk + j, pk);
+            }
+            if (r <= pk) {
+                a[s2][k] = -a[s1][k - 1] / NDU(pk + 1, r);
+                d += a[s2][k] * NDU(r, pk);
+            }
+            ders[k * order + r] = d;
+            std::swap(s1, s2);
+        }
+    }
+
+    double factor = p;
+    for (int k = 1; k <= n; ++k) {
+        for (int j = 0; j <= p; ++j) ders[k * order + j] *= factor;
+        factor *= (p - k);
+    }
+}
+
+void NURBS::derivativesInSpan(int span, double u, int k, Vec3d* out) const {
+    GEOALGO_COUNT(Counter::NURBSEvaluations);
+    const int order = degree_ + 1;
+    const int nb = std::min(k, degree_); // 更高阶的齐次导数为零
+    double ders[(kMaxDegree + 1) * (kMaxDegree + 1)];
+    basisFunctionDerivatives(knots_, degree_, span, u, nb, ders);
+
+    // 齐次坐标导数 (A^(j), w^(j))
+    Vec4d Cw[kMaxDegree + 1];
+    const Vec4d* P = Pw_.data() + (span - degree_);
+    for (int j = 0; j <= k; ++j) {
+        Cw[j] = Vec4d();
+        if (j > nb) continue;
+        for (int i = 0; i < order; ++i) Cw[j] += P[i] * ders[j * order + i];
+    }
+
+    const double invW = 1.0 / Cw[0].w;
+    for (int j = 0; j <= k; ++j) {
+        Vec3d v(Cw[j].x, Cw[j].y, Cw[j].z);
+        const double* C = binomialTableRow(j);
+        for (int i = 1; i <= j; ++i) v -= out[j - i] * (C[i] * Cw[i].w);
+        out[j] = v * invW;
+    }
+}
+
+void NURBS::evaluateDerivatives(double u, int k, Vec3d* out) const {
+    if (k < 0 || k > kMaxDegree)
+        throw std::invalid_argument("NURBS: derivative order must be in [0, kMaxDegree]");
+    u = clampParam(u);
+    derivativesInSpan(findSpan(u), u, k, out);
+}
+
+void NURBS::evaluateDerivatives(double u, int k, Point2D* out) const {
+    Vec3d tmp[kMaxDegree + 1];
+    evaluateDerivatives(u, k, tmp);
+    for (int j = 0; j <= k; ++j) out[j] = Point2D(tmp[j].x, tmp[j].y);
+}
+
+void NURBS::evaluateDerivativesMany(const double* us, std::size_t count, int k, Vec3d* out) const {
+    if (count == 0) return;
+    if (k < 0 || k > kMaxDegree)
+        throw std::invalid_argument("NURBS: derivative order must be in [0, kMaxDegree]");
+    int span = findSpan(clampParam(us[0]));
+    for (std::size_t i = 0; i < count; ++i, out += k + 1) {
+        const double u = clampParam(us[i]);
+        span = advanceSpan(span, u);
+        derivativesInSpan(span, u, k, out);
+    }
+}
+
+NURBS NURBS::insertKnot(double u, int times) const {
+    if (times < 0) throw std::invalid_argument("NURBS: insertion count must be non-negative");
+    if (!(u >= firstParam() && u <= lastParam()))
+        throw std::invalid_argument("NURBS: inserted knot lies outside the domain");
+    const int p = degree_;
+    const int s = multiplicity(knots_, u);
+    if (s + times > p) throw std::invalid_argument("NURBS: knot multiplicity would exceed the degree");
+    if (times == 0) return *this;
+    GEOALGO_COUNT_N(Counter::KnotInsertions, times);
+
+    // k 为最后一个不大于 u 的节点下标
+    const std::vector<double>& UP = knots_;
+    const int k = static_cast<int>(std::upper_bound(UP.begin(), UP.end(), u) - UP.begin()) - 1;
+    const int n = numControlPoints() - 1;
+    const int r = times;
+
+    std::vector<double> UQ(UP.size() + r);
+    std::vector<Vec4d> Qw(Pw_.size() + r);
+    for (int i = 0; i <= k; ++i) UQ[i] = UP[i];
+    for (int i = 1; i <= r; ++i) UQ[k + i] = u;
+    for (int i = k + 1; i < static_cast<int>(UP.size()); ++i) UQ[i + r] = UP[i];
+    for (int i = 0; i <= k - p; ++i) Qw[i] = Pw_[i];
+    for (int i = k - s; i <= n; ++i) Qw[i + r] = Pw_[i];
+
+    // 受影响的 p-s+1 个控制点逐轮做凸组合
+    Vec4d Rw[kMaxDegree + 1];
+    for (int i = 0; i <= p - s; ++i) Rw[i] = Pw_[k - p + i];
+    int L = k - p;
+    for (int j = 1; j <= r; ++j) {
+        L = k - p + j;
+        for (int i = 0; i <= p - j - s; ++i) {
+            const double alpha = (u - UP[L + i]) / (UP[i + k + 1] - UP[L + i]);
+            Rw[i] = Rw[i + 1] * alpha + Rw[i] * (1.0 - alpha);
+        }
+        Qw[L] = Rw[0];
+        Qw[k + r - j - s] = Rw[p - j - s];
+    }
+    for (int i = L + 1; i < k - s; ++i) Qw[i] = Rw[i - L];
+    return NURBS(p, dim_, std::move(UQ), std::move(Qw), HomogeneousTag{});
+}
+
+NURBS NURBS::refineKnots(const std::vector<double>& X) const {
+    if (X.empty()) return *this;
+    if (!std::is_sorted(X.begin(), X.end()))
+        throw std::invalid_argument("NURBS: refinement knots must be non-decreasing");
+    if (!(X.front() >= firstParam() && X.back() <= lastParam()))
+        throw std::invalid_argument("NURBS: inserted knot lies outside the domain");
+    const int p = degree_;
+    for (std::size_t i = 0; i < X.size();) {
+        std::size_t j = i;
+        while (j < X.size() && X[j] == X[i]) ++j;
+        if (multiplicity(knots_, X[i]) + static_cast<int>(j - i) > p)
+            throw std::invalid_argument("NURBS: knot multiplicity would exceed the degree");
+        i = j;
+    }
+    GEOALGO_COUNT_N(Counter::KnotInsertions, X.size());
+
+    const std::vector<double>& UP = knots_;
+    const int n = numControlPoints() - 1;
+    const int m = n + p + 1;
+    const int r = static_cast<int>(X.size()) - 1;
+    const int a = findSpan(X.front());
+    const int b = findSpan(X.back()) + 1;
+
+    std::vector<Vec4d> Qw(n + r + 2);
+    std::vector<double> Ubar(m + r + 2);
+    for (int j = 0; j <= a - p; ++j) Qw[j] = Pw_[j];
+    for (int j = b - 1; j <= n; ++j) Qw[j + r + 1] = Pw_[j];
+    for (int j = 0; j <= a; ++j) Ubar[j] = UP[j];
+    for (int j = b + p; j <= m; ++j) Ubar[j + r + 1] = UP[j];
+
+    // 从右向左插入 X[j]：先搬移不受影响的控制点，再对 p 个相邻点做凸组合
+    int i = b + p - 1;
+    int k = b + p + r;
+    for (int j = r; j >= 0; --j) {
+        while (X[j] <= UP[i] && i > a) {
+            Qw[k - p - 1] = Pw_[i - p - 1];
+            Ubar[k] = UP[i];
+            --k;
+            --i;
+        }
+        Qw[k - p - 1] = Qw[k - p];
+        for (int l = 1; l <= p; ++l) {
+            const int ind = k - p + l;
+            double alpha = Ubar[k + l] - X[j];
+            if (alpha == 0.0) {
+                Qw[ind - 1] = Qw[ind];
+            } else {
+                alpha /= Ubar[k + l] - UP[i - p + l];
+                Qw[ind - 1] = Qw[ind - 1] * alpha + Qw[ind] * (1.0 - alpha);
+            }
+        }
+        Ubar[k] = X[j];
+        --k;
+    }
+    return NURBS(p, dim_, std::move(Ubar), std::move(Qw), HomogeneousTag{});
+}
+
+bool NURBS::isClamped() const {
+    const int p = degree_;
+    const int m = static_cast<int>(knots_.size()) - 1;
+    return knots_[0] == knots_[p] && knots_[m - p] == knots_[m];
+}
+
+NURBS NURBS::clamped() const {
+    if (isClamped()) return *this;
+    const int p = degree_;
+    const double a = firstParam();
+    const double b = lastParam();
+    NURBS c = *this;
+    const int sa = multiplicity(c.knots_, a);
+    if (sa < p) c = c.insertKnot(a, p - sa);
+    const int sb = multiplicity(c.knots_, b);
+    if (sb < p) c = c.insertKnot(b, p - sb);
+
+    // e 为最后一个等于 a 的节点，g 为第一个等于 b 的节点；两端至少 p 重，
+    // 保留控制点 [e-p, g-1]，其余节点与定义域外的基函数无关
+    const std::vector<double>& U = c.knots_;
+    const int e = static_cast<int>(std::upper_bound(U.begin(), U.end(), a) - U.begin()) - 1;
+    const int g = static_cast<int>(std::lower_bound(U.begin(), U.end(), b) - U.begin());
+    std::vector<double> knots(p + 1, a);
+    knots.insert(knots.end(), U.begin() + e + 1, U.begin() + g);
+    knots.insert(knots.end(), p + 1, b);
+    std::vector<Vec4d> Pw(c.Pw_.begin() + (e - p), c.Pw_.begin() + g);
+    return NURBS(p, dim_, std::move(knots), std::move(Pw), HomogeneousTag{});
+}
+
+int NURBS::numBezierSegments() const {
+    int count = 0;
+    for (int s = degree_; s < numControlPoints(); ++s)
+        if (knots_[s] < knots_[s + 1]) ++count;
+    return count;
+}
+
+void NURBS::decomposeToBezier(Vec4d* points, double* breaks) const {
+    if (!isClamped()) {
+        clamped().decomposeToBezier(points, breaks);
+        return;
+    }
+    GEOALGO_COUNT(Counter::BezierDecompositions);
+    const int p = degree_;
+    const int m = static_cast<int>(knots_.size()) - 1;
+    const std::vector<double>& U = knots_;
+    auto Q = [&](int seg, int i) -> Vec4d& { return points[seg * (p + 1) + i]; };
+
+    double alphas[kMaxDegree + 1];
+    int a = p;
+    int b = p + 1;
+    int nb = 0;
+    for (int i = 0; i <= p; ++i) Q(0, i) = Pw_[i];
+    if (breaks) breaks[0] = U[p];
+    while (b < m) {
+        const int first = b;
+        while (b < m && U[b + 1] == U[b]) ++b;
+        const int mult = b - first + 1;
+        if (mult < p) {
+            // 把 U[b] 插入到 p 重；每轮的最后一个点同时是下一段的控制点
+            const double numer = U[b] - U[a];
+            for (int j = p; j > mult; --j) alphas[j - mult - 1] = numer / (U[a + j] - U[a]);
+            const int r = p - mult;
+            for (int j = 1; j <= r; ++j) {
+                const int save = r - j;
+                const int s = mult + j;
+                for (int k = p; k >= s; --k) {
+                    const double alpha = alphas[k - s];
+                    Q(nb, k) = Q(nb, k) * alpha + Q(nb, k - 1) * (1.0 - alpha);
+                }
+                if (b < m) Q(nb + 1, save) = Q(nb, p);
+            }
+        }
+        ++nb;
+        if (breaks) breaks[nb] = U[b];
+        if (b < m) {
+            for (int i = std::max(0, p - mult); i <= p; ++i) Q(nb, i) = Pw_[b - p + i];
+            a = b;
+            ++b;
+        }
+    }
 }
 
 } // namespace GeoAlgo
@@ -1,8 +1,10 @@
 #include "PowerBasisCurve.h"
+#include "Instrumentation.h"
 
 namespace GeoAlgo {
 
 Point2D PowerBasisCurve::evaluate(double u) const {
+    GEOALGO_COUNT_N(Counter::PowerBasisEvaluations, 2);
     Point2D result(0, 0);
     double u_power = 1.0;
 
@@ -0,0 +1,224 @@
+#include "PowerBasisKernel.h"
+#include "Instrumentation.h"
+#include <stdexcept>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GEOALGO_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+namespace GeoAlgo {
+
+namespace {
+
+// 每次内核调用最多同时处理的分量数（保证累加器留在寄存器中）
+constexpr int kMaxKernelDim = 4;
+
+template <int Dim>
+void hornerScalar(const double* c, int order, const double* ts,
+                  std::size_t begin, std::size_t end, double* const* outs) {
+    for (std::size_t k = begin; k < end; ++k) {
+        const double t = ts[k];
+        double acc[Dim];
+        for (int d = 0; d < Dim; ++d) acc[d] = c[d * order + order - 1];
+        for (int i = order - 2; i >= 0; --i)
+            for (int d = 0; d < Dim; ++d) acc[d] = acc[d] * t + c[d * order + i];
+        for (int d = 0; d < Dim; ++d) outs[d][k] = acc[d];
+    }
+}
+
+#ifdef GEOALGO_X86_DISPATCH
+
+template <int Dim>
+__attribute__((target("sse2")))
+std::size_t hornerSSE2(const double* c, int order, const double* ts,
+                       std::size_t count, double* const* outs) {
+    std::size_t k = 0;
+    for (; k + 2 <= count; k += 2) {
+        const __m128d t = _mm_loadu_pd(ts + k);
+        __m128d acc[Dim];
+        for (int d = 0; d < Dim; ++d) acc[d] = _mm_set1_pd(c[d * order + order - 1]);
+        for (int i = order - 2; i >= 0; --i)
+            for (int d = 0; d < Dim; ++d)
+                acc[d] = _mm_add_pd(_mm_mul_pd(acc[d], t), _mm_set1_pd(c[d * order + i]));
+        for (int d = 0; d < Dim; ++d) _mm_storeu_pd(outs[d] + k, acc[d]);
+    }
+    return k;
+}
+
+template <int Dim>
+__attribute__((target("avx2,fma")))
+std::size_t hornerAVX2(const double* c, int order, const double* ts,
+                       std::size_t count, double* const* outs) {
+    std::size_t k = 0;
+    for (; k + 4 <= count; k += 4) {
+        const __m256d t = _mm256_loadu_pd(ts + k);
+        __m256d acc[Dim];
+        for (int d = 0; d < Dim; ++d) acc[d] = _mm256_set1_pd(c[d * order + order - 1]);
+        for (int i = order - 2; i >= 0; --i)
+            for (int d = 0; d < Dim; ++d)
+                acc[d] = _mm256_fmadd_pd(acc[d], t, _mm256_set1_pd(c[d * order + i]));
+        for (int d = 0; d < Dim; ++d) _mm256_storeu_pd(outs[d] + k, acc[d]);
+    }
+    return k;
+}
+
+template <int Dim>
+__attribute__((target("avx512f")))
+std::size_t hornerAVX512(const double* c, int order, const double* ts,
+                         std::size_t count, double* const* outs) {
+    std::size_t k = 0;
+    for (; k + 8 <= count; k += 8) {
+        const __m512d t = _mm512_loadu_pd(ts + k);
+        __m512d acc[Dim];
+        for (int d = 0; d < Dim; ++d) acc[d] = _mm512_set1_pd(c[d * order + order - 1]);
+        for (int i = order - 2; i >= 0; --i)
+            for (int d = 0; d < Dim; ++d)
+                acc[d] = _mm512_fmadd_pd(acc[d], t, _mm512_set1_pd(c[d * order + i]));
+        for (int d = 0; d < Dim; ++d) _mm512_storeu_pd(outs[d] + k, acc[d]);
+    }
+    return k;
+}
+
+SimdLevel detectSimdLevelUncached() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return SimdLevel::AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse2")) return SimdLevel::SSE2;
+    return SimdLevel::Scalar;
+}
+
+#else
+
+SimdLevel detectSimdLevelUncached() { return SimdLevel::Scalar; }
+
+#endif // GEOALGO_X86_DISPATCH
+
+template <int Dim>
+std::size_t hornerVector(const double* c, int order, const double* ts,
+                         std::size_t count, double* const* outs, SimdLevel level) {
+#ifdef GEOALGO_X86_DISPATCH
+    switch (level) {
+    case SimdLevel::AVX512: return hornerAVX512<Dim>(c, order, ts, count, outs);
+    case SimdLevel::AVX2:   return hornerAVX2<Dim>(c, order, ts, count, outs);
+    case SimdLevel::SSE2:   return hornerSSE2<Dim>(c, order, ts, count, outs);
+    case SimdLevel::Scalar: break;
+    }
+#else
+    (void)c; (void)order; (void)ts; (void)count; (void)outs; (void)level;
+#endif
+    return 0;
+}
+
+template <int Dim>
+void hornerDispatch(const double* c, int order, const double* ts,
+                    std::size_t count, double* const* outs, SimdLevel level) {
+    std::size_t done = hornerVector<Dim>(c, order, ts, count, outs, level);
+    if (done == count) return;
+    if (level == SimdLevel::Scalar) {
+        hornerScalar<Dim>(c, order, ts, done, count, outs);
+        return;
+    }
+    // 尾部补齐到一个完整向量后仍走向量路径，保证每个参数的结果与其在数组中的位置无关
+    constexpr std::size_t kPad = 8;
+    double tpad[kPad] = {};
+    double opad[Dim][kPad];
+    double* optr[Dim];
+    for (int d = 0; d < Dim; ++d) optr[d] = opad[d];
+    const std::size_t rest = count - done;
+    for (std::size_t k = 0; k < rest; ++k) tpad[k] = ts[done + k];
+    hornerVector<Dim>(c, order, tpad, kPad, optr, level);
+    for (int d = 0; d < Dim; ++d)
+        for (std::size_t k = 0; k < rest; ++k) outs[d][done + k] = opad[d][k];
+}
+
+} // namespace
+
+SimdLevel detectSimdLevel() {
+    static const SimdLevel level = detectSimdLevelUncached();
+    return level;
+}
+
+const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+    case SimdLevel::Scalar: return "scalar";
+    case SimdLevel::SSE2:   return "sse2";
+    case SimdLevel::AVX2:   return "avx2";
+    case SimdLevel::AVX512: return "avx512";
+    }
+    return "unknown";
+}
+
+void evaluatePowerBasisSoA(const double* coeffs, int dim, int order,
+                           const double* ts, std::size_t count, double* const* outs) {
+    evaluatePowerBasisSoA(coeffs, dim, order, ts, count, outs, detectSimdLevel());
+}
+
+void evaluatePowerBasisSoA(const double* coeffs, int dim, int order,
+                           const double* ts, std::size_t count, double* const* outs,
+                           SimdLevel level) {
+    if (dim <= 0 || count == 0) return;
+    GEOALGO_COUNT_N(Counter::PowerBasisEvaluations, count * dim);
+    if (order <= 0) {
+        for (int d = 0; d < dim; ++d)
+            for (std::size_t k = 0; k < count; ++k) outs[d][k] = 0.0;
+        return;
+    }
+    if (level > detectSimdLevel()) level = detectSimdLevel();
+
+    // 分量多于 kMaxKernelDim 时分组处理
+    for (int d0 = 0; d0 < dim; d0 += kMaxKernelDim) {
+        const double* c = coeffs + static_cast<std::size_t>(d0) * order;
+        double* const* o = outs + d0;
+        switch (dim - d0) {
+        case 1:  hornerDispatch<1>(c, order, ts, count, o, level); break;
+        case 2:  hornerDispatch<2>(c, order, ts, count, o, level); break;
+        case 3:  hornerDispatch<3>(c, order, ts, count, o, level); break;
+        default: hornerDispatch<4>(c, order, ts, count, o, level); break;
+        }
+    }
+}
+
+void evaluatePowerBasisDerivativesSoA(const double* coeffs, int dim, int order, int maxOrder,
+                                      const double* ts, std::size_t count, double* const* outs,
+                                      double* scratch) {
+    if (dim <= 0 || maxOrder < 0 || count == 0) return;
+    // 导数多项式系数表：块 b = j*dim + d 为第 d 个分量 j 阶导数的系数，补零到 order 个，
+    // 与 outs[b] 一一对应，因此可以按块分批求值
+    const int nonZero = order > 0 ? std::min(maxOrder, order - 1) : -1;
+    const int numBlocks = (nonZero + 1) * dim;
+    double stackBuf[kDerivativeTableCapacity];
+    double* table = scratch;
+    int batch = numBlocks;
+    if (!table && numBlocks > 0) {
+        // 栈缓冲区放不下整张表时分批：每批尽量多的块，多项式多遍历几次 ts
+        if (static_cast<std::size_t>(order) > kDerivativeTableCapacity)
+            throw std::invalid_argument("evaluatePowerBasisDerivativesSoA: order exceeds the stack capacity; "
+                                        "pass a scratch buffer");
+        table = stackBuf;
+        batch = std::min(numBlocks, static_cast<int>(kDerivativeTableCapacity / order));
+    }
+    for (int b0 = 0; b0 < numBlocks; b0 += batch) {
+        const int nb = std::min(batch, numBlocks - b0);
+        for (int b = b0; b < b0 + nb; ++b) {
+            const int j = b / dim;
+            const double* a = coeffs + static_cast<std::size_t>(b % dim) * order;
+            double* c = table + static_cast<std::size_t>(b - b0) * order;
+            for (int i = 0; i < order; ++i) {
+                if (i + j >= order) {
+                    c[i] = 0.0;
+                    continue;
+                }
+                // (i+j)! / i!
+                double f = 1.0;
+                for (int m = i + 1; m <= i + j; ++m) f *= m;
+                c[i] = a[i + j] * f;
+            }
+        }
+        evaluatePowerBasisSoA(table, nb, order, ts, count, outs + b0);
+    }
+    for (int j = nonZero + 1; j <= maxOrder; ++j)
+        for (int d = 0; d < dim; ++d) std::fill(outs[j * dim + d], outs[j * dim + d] + count, 0.0);
+}
+
+} // namespace GeoAlgo
@@ -0,0 +1,183 @@
+#include "RationalBezierCurve.h"
+#include "BasisConversion.h"
+#include "CurveKernels.h"
+#include "Instrumentation.h"
+#include "PowerBasisKernel.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace GeoAlgo {
+
+namespace {
+
+constexpr std::size_t kPowerBlock = 256;
+
+// 齐次空间中的 Bernstein–Horner 递推，scaled[i] = C(n,i) * H_i
+inline Vec4d bernsteinHorner(const Vec4d* scaled, int n, double u) {
+    const double s = 1.0 - u;
+    double ui = 1.0;
+    Vec4d result = scaled[0];
+    for (int i = 1; i <= n; ++i) {
+        ui *= u;
+        result = result * s + scaled[i] * ui;
+    }
+    return result;
+}
+
+void checkWeights(std::size_t numPoints, const std::vector<double>& weights) {
+    if (numPoints == 0)
+        throw std::invalid_argument("RationalBezierCurve: need at least one control point");
+    if (numPoints - 1 > static_cast<std::size_t>(kMaxTableDegree))
+        throw std::invalid_argument("RationalBezierCurve: degree exceeds kMaxTableDegree");
+    if (weights.size() != numPoints)
+        throw std::invalid_argument("RationalBezierCurve: weight count does not match control points");
+    for (double w : weights)
+        if (!(w > 0.0)) throw std::invalid_argument("RationalBezierCurve: weights must be positive");
+}
+
+} // namespace
+
+RationalBezierCurve::RationalBezierCurve(const std::vector<Point2D>& controlPoints,
+                                         const std::vector<double>& weights) {
+    checkWeights(controlPoints.size(), weights);
+    homogeneous.reserve(controlPoints.size());
+    for (std::size_t i = 0; i < controlPoints.size(); ++i)
+        homogeneous.push_back(toHomogeneous(controlPoints[i], weights[i]));
+    init(2);
+}
+
+RationalBezierCurve::RationalBezierCurve(const std::vector<Vec3d>& controlPoints,
+                                         const std::vector<double>& weights) {
+    checkWeights(controlPoints.size(), weights);
+    homogeneous.reserve(controlPoints.size());
+    for (std::size_t i = 0; i < controlPoints.size(); ++i)
+        homogeneous.push_back(toHomogeneous(controlPoints[i], weights[i]));
+    init(3);
+}
+
+void RationalBezierCurve::init(int dimension) {
+    dim = dimension;
+    const int n = degree();
+    const double* C = binomialTableRow(n);
+    scaledPoints.resize(n + 1);
+    for (int i = 0; i <= n; ++i) scaledPoints[i] = homogeneous[i] * C[i];
+
+    if (n >= 1) {
+        const double* Cm = binomialTableRow(n - 1);
+        scaledHodograph.resize(n);
+        for (int i = 0; i < n; ++i)
+            scaledHodograph[i] = (homogeneous[i + 1] - homogeneous[i]) * (n * Cm[i]);
+    }
+
+    if (n <= kMaxPowerDegree) {
+        // 齐次控制点按点连续存放（dim 个坐标 + 权重），转换后改为按分量连续
+        const int comps = dim + 1;
+        std::vector<double> bezier(static_cast<std::size_t>(comps) * (n + 1));
+        std::vector<double> power(bezier.size());
+        for (int i = 0; i <= n; ++i) {
+            for (int d = 0; d < dim; ++d) bezier[i * comps + d] = homogeneous[i][d];
+            bezier[i * comps + dim] = homogeneous[i].w;
+        }
+        bezierToPower(bezier.data(), n, comps, power.data());
+        powerPacked.resize(power.size());
+        for (int i = 0; i <= n; ++i)
+            for (int d = 0; d < comps; ++d) powerPacked[d * (n + 1) + i] = power[i * comps + d];
+    }
+}
+
+Vec4d RationalBezierCurve::evaluateHomogeneous(double u) const {
+    GEOALGO_COUNT(Counter::RationalEvaluations);
+    if (scaledPoints.empty()) return Vec4d();
+    return bernsteinHorner(scaledPoints.data(), degree(), u);
+}
+
+Point2D RationalBezierCurve::evaluate(double u) const {
+    if (scaledPoints.empty()) return Point2D(0, 0);
+    return fromHomogeneous<2>(evaluateHomogeneous(u));
+}
+
+Vec3d RationalBezierCurve::evaluate3D(double u) const {
+    if (scaledPoints.empty()) return Vec3d(0, 0, 0);
+    return fromHomogeneous<3>(evaluateHomogeneous(u));
+}
+
+Vec3d RationalBezierCurve::derivative3D(double u) const {
+    if (scaledHodograph.empty()) return Vec3d(0, 0, 0);
+    const Vec4d A = evaluateHomogeneous(u);
+    const Vec4d dA = bernsteinHorner(scaledHodograph.data(), degree() - 1, u);
+    const double inv = 1.0 / A.w;
+    const Vec3d C = fromHomogeneous<3>(A);
+    return Vec3d(dA.x - dA.w * C.x, dA.y - dA.w * C.y, dA.z - dA.w * C.z) * inv;
+}
+
+Point2D RationalBezierCurve::derivative(double u) const {
+    const Vec3d d = derivative3D(u);
+    return Point2D(d.x, d.y);
+}
+
+void RationalBezierCurve::evaluateMany(const double* us, std::size_t count, Point2D* out) const {
+    double xs[kPowerBlock], ys[kPowerBlock];
+    for (std::size_t k0 = 0; k0 < count; k0 += kPowerBlock) {
+        const std::size_t len = std::min(kPowerBlock, count - k0);
+        evaluateMany(us + k0, len, xs, ys);
+        for (std::size_t k = 0; k < len; ++k) out[k0 + k] = Point2D(xs[k], ys[k]);
+    }
+}
+
+void RationalBezierCurve::evaluateMany(const double* us, std::size_t count, Vec3d* out) const {
+    double xs[kPowerBlock], ys[kPowerBlock], zs[kPowerBlock];
+    for (std::size_t k0 = 0; k0 < count; k0 += kPowerBlock) {
+        const std::size_t len = std::min(kPowerBlock, count - k0);
+        evaluateMany(us + k0, len, xs, ys, zs);
+        for (std::size_t k = 0; k < len; ++k) out[k0 + k] = Vec3d(xs[k], ys[k], zs[k]);
+    }
+}
+
+void RationalBezierCurve::evaluateMany(const double* us, std::size_t count,
+                                       double* xs, double* ys, double* zs) const {
+    GEOALGO_COUNT_N(Counter::RationalEvaluations, count);
+    if (scaledPoints.empty()) {
+        std::fill(xs, xs + count, 0.0);
+        std::fill(ys, ys + count, 0.0);
+        if (zs) std::fill(zs, zs + count, 0.0);
+        return;
+    }
+    if (powerPacked.empty()) {
+        const Vec4d* scaled = scaledPoints.data();
+        const int n = degree();
+        for (std::size_t k = 0; k < count; ++k) {
+            const Vec3d p = fromHomogeneous<3>(bernsteinHorner(scaled, n, us[k]));
+            xs[k] = p.x;
+            ys[k] = p.y;
+            if (zs) zs[k] = p.z;
+        }
+        return;
+    }
+
+    // 齐次分量先写入输出数组（z 为空或二维曲线时用栈缓冲），权重单独缓冲，最后统一相除
+    const int order = degree() + 1;
+    double zbuf[kPowerBlock], wbuf[kPowerBlock];
+    for (std::size_t k0 = 0; k0 < count; k0 += kPowerBlock) {
+        const std::size_t len = std::min(kPowerBlock, count - k0);
+        double* x = xs + k0;
+        double* y = ys + k0;
+        double* z = zs ? zs + k0 : zbuf;
+        if (dim == 3) {
+            double* outs[4] = {x, y, z, wbuf};
+            evaluatePowerBasisSoA(powerPacked.data(), 4, order, us + k0, len, outs);
+        } else {
+            double* outs[3] = {x, y, wbuf};
+            evaluatePowerBasisSoA(powerPacked.data(), 3, order, us + k0, len, outs);
+        }
+        // 先求倒数再逐分量相乘，各循环只涉及两个数组，便于向量化
+        for (std::size_t k = 0; k < len; ++k) wbuf[k] = 1.0 / wbuf[k];
+        for (std::size_t k = 0; k < len; ++k) x[k] *= wbuf[k];
+        for (std::size_t k = 0; k < len; ++k) y[k] *= wbuf[k];
+        if (zs && dim == 3)
+            for (std::size_t k = 0; k < len; ++k) z[k] *= wbuf[k];
+        else if (zs)
+            std::fill(z, z + len, 0.0);
+    }
+}
+
+} // namespace GeoAlgo
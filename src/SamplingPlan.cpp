@@ -0,0 +1,192 @@
+#include "SamplingPlan.h"
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+namespace GeoAlgo {
+
+namespace {
+
+std::vector<double> bezierKnots(int degree) {
+    std::vector<double> U(2 * degree + 2, 0.0);
+    std::fill(U.begin() + degree + 1, U.end(), 1.0);
+    return U;
+}
+
+} // namespace
+
+SamplingPlan::SamplingPlan(int degree, const std::vector<double>& knots, int numSamples)
+    : degree_(degree), knots_(knots), bezier_(false) {
+    if (degree < 0 || degree > NURBS::kMaxDegree)
+        throw std::invalid_argument("SamplingPlan: degree must be in [0, kMaxDegree]");
+    if (knots.size() < 2 * static_cast<std::size_t>(degree) + 2)
+        throw std::invalid_argument("SamplingPlan: knot vector too short for degree");
+    if (numSamples < 1)
+        throw std::invalid_argument("SamplingPlan: numSamples must be positive");
+    if (!std::is_sorted(knots.begin(), knots.end()))
+        throw std::invalid_argument("SamplingPlan: knot vector must be non-decreasing");
+    if (!(knots[degree] < knots[knots.size() - degree - 1]))
+        throw std::invalid_argument("SamplingPlan: knot vector has an empty domain");
+
+    const int n = static_cast<int>(knots.size()) - degree - 2;
+    bezier_ = (knots == bezierKnots(degree));
+    const double a = knots[degree];
+    const double b = knots[n + 1];
+    const int order = degree + 1;
+
+    params_.resize(numSamples);
+    first_.resize(numSamples);
+    basis_.resize(static_cast<std::size_t>(numSamples) * order);
+    int span = degree;
+    for (int k = 0; k < numSamples; ++k) {
+        const double u = (numSamples == 1) ? a
+                       : (k == numSamples - 1) ? b
+                       : a + (b - a) * k / (numSamples - 1);
+        // 参数递增，区间只需向前推进
+        while (span < n && u >= knots[span + 1]) ++span;
+        params_[k] = u;
+        first_[k] = span - degree;
+        NURBS::basisFunctions(knots, degree, span, u, &basis_[static_cast<std::size_t>(k) * order]);
+    }
+}
+
+SamplingPlan SamplingPlan::forBezier(int degree, int numSamples) {
+    return SamplingPlan(degree, bezierKnots(degree), numSamples);
+}
+
+bool SamplingPlan::matches(const NURBS& curve) const {
+    return curve.degree() == degree_ && curve.knots() == knots_;
+}
+
+bool SamplingPlan::matches(const BezierCurve& curve) const {
+    return bezier_ && curve.degree() == degree_;
+}
+
+void SamplingPlan::evaluateHomogeneous(const Vec4d* Pw, int numPoints, int dim, double* out) const {
+    if (numPoints != numControlPoints())
+        throw std::invalid_argument("SamplingPlan: control point count does not match plan");
+    if (dim < 1 || dim > NURBS::kMaxDim)
+        throw std::invalid_argument("SamplingPlan: dimension must be in [1, 3]");
+    const int order = degree_ + 1;
+    const int samples = numSamples();
+    const double* N = basis_.data();
+    for (int k = 0; k < samples; ++k, N += order, out += dim) {
+        const Vec4d* P = Pw + first_[k];
+        Vec4d Cw = P[0] * N[0];
+        for (int j = 1; j < order; ++j) Cw += P[j] * N[j];
+        const Vec3d p = fromHomogeneous<3>(Cw);
+        for (int d = 0; d < dim; ++d) out[d] = p[d];
+    }
+}
+
+void SamplingPlan::evaluate(const NURBS& curve, double* out) const {
+    if (!matches(curve))
+        throw std::invalid_argument("SamplingPlan: curve degree/knots do not match plan");
+    evaluateHomogeneous(curve.homogeneousPoints().data(), curve.numControlPoints(), curve.dimension(), out);
+}
+
+void SamplingPlan::evaluate(const BezierCurve& curve, Point2D* out) const {
+    if (!matches(curve))
+        throw std::invalid_argument("SamplingPlan: Bezier degree does not match plan");
+    const int order = degree_ + 1;
+    const int samples = numSamples();
+    const Point2D* P = curve.controlPoints().data();
+    const double* N = basis_.data();
+    for (int k = 0; k < samples; ++k, N += order) {
+        Point2D r = P[0] * N[0];
+        for (int j = 1; j < order; ++j) r += P[j] * N[j];
+        out[k] = r;
+    }
+}
+
+void SamplingPlan::evaluateBatch(const NURBS* curves, std::size_t count, double* out) const {
+    for (std::size_t c = 0; c < count; ++c) {
+        evaluate(curves[c], out);
+        out += static_cast<std::size_t>(numSamples()) * curves[c].dimension();
+    }
+}
+
+void SamplingPlan::evaluateBatch(const BezierCurve* curves, std::size_t count, Point2D* out) const {
+    for (std::size_t c = 0; c < count; ++c, out += numSamples())
+        evaluate(curves[c], out);
+}
+
+SamplingPlanCache::SamplingPlanCache(std::size_t capacity)
+    : capacity_(std::max<std::size_t>(capacity, 1)) {}
+
+std::size_t SamplingPlanCache::hashKey(int degree, const std::vector<double>& knots, int numSamples) {
+    std::size_t h = std::hash<int>()(degree) * 31u + std::hash<int>()(numSamples);
+    for (double u : knots)
+        h ^= std::hash<double>()(u) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+    return h;
+}
+
+std::shared_ptr<const SamplingPlan> SamplingPlanCache::get(int degree, const std::vector<double>& knots,
+                                                           int numSamples) {
+    const std::size_t h = hashKey(degree, knots, numSamples);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto range = index_.equal_range(h);
+        for (auto it = range.first; it != range.second; ++it) {
+            const Entry& e = *it->second;
+            if (e.degree == degree && e.numSamples == numSamples && e.knots == knots) {
+                entries_.splice(entries_.begin(), entries_, it->second);
+                ++hits_;
+                return e.plan;
+            }
+        }
+        ++misses_;
+    }
+
+    // 在锁外构建，避免阻塞其他线程的命中查询
+    auto plan = std::make_shared<const SamplingPlan>(degree, knots, numSamples);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto range = index_.equal_range(h);
+    for (auto it = range.first; it != range.second; ++it) {
+        const Entry& e = *it->second;
+        if (e.degree == degree && e.numSamples == numSamples && e.knots == knots)
+            return e.plan; // 其他线程已插入
+    }
+    entries_.push_front(Entry{degree, numSamples, knots, h, plan});
+    index_.emplace(h, entries_.begin());
+    while (entries_.size() > capacity_) {
+        auto last = std::prev(entries_.end());
+        auto r = index_.equal_range(last->hash);
+        for (auto it = r.first; it != r.second; ++it) {
+            if (it->second == last) {
+                index_.erase(it);
+                break;
+            }
+        }
+        entries_.pop_back();
+    }
+    return plan;
+}
+
+std::shared_ptr<const SamplingPlan> SamplingPlanCache::getBezier(int degree, int numSamples) {
+    return get(degree, bezierKnots(degree), numSamples);
+}
+
+std::size_t SamplingPlanCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+std::size_t SamplingPlanCache::hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+}
+
+std::size_t SamplingPlanCache::misses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+}
+
+void SamplingPlanCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    index_.clear();
+}
+
+} // namespace GeoAlgo
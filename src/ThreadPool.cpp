@@ -0,0 +1,141 @@
+#include "ThreadPool.h"
+#include <algorithm>
+#include <exception>
+
+namespace GeoAlgo {
+
+namespace {
+
+// 当前线程所属的线程池及其队列下标
+thread_local const ThreadPool* tlsPool = nullptr;
+thread_local std::size_t tlsQueue = 0;
+
+} // namespace
+
+struct ThreadPool::ForState {
+    const std::function<void(std::size_t)>* fn;
+    std::atomic<std::size_t> remaining;
+    std::mutex errorMutex;
+    std::exception_ptr error;
+};
+
+ThreadPool::ThreadPool(std::size_t numThreads) {
+    if (numThreads == 0) numThreads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    for (std::size_t i = 0; i < numThreads; ++i) queues_.push_back(std::make_unique<Queue>());
+    for (std::size_t i = 1; i < numThreads; ++i) workers_.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stop_ = true;
+    }
+    sleepCv_.notify_all();
+    for (auto& t : workers_) t.join();
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+std::size_t ThreadPool::currentQueue() const {
+    return tlsPool == this ? tlsQueue : 0;
+}
+
+void ThreadPool::push(std::size_t queue, const Job& job) {
+    {
+        std::lock_guard<std::mutex> lock(queues_[queue]->mutex);
+        queues_[queue]->jobs.push_back(job);
+    }
+    queued_.fetch_add(1);
+    std::lock_guard<std::mutex> lock(sleepMutex_);
+    sleepCv_.notify_one();
+}
+
+bool ThreadPool::tryPop(std::size_t self, Job& job) {
+    {
+        Queue& q = *queues_[self];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (!q.jobs.empty()) {
+            job = q.jobs.back();
+            q.jobs.pop_back();
+            queued_.fetch_sub(1);
+            return true;
+        }
+    }
+    for (std::size_t k = 1; k < queues_.size(); ++k) {
+        Queue& q = *queues_[(self + k) % queues_.size()];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (!q.jobs.empty()) {
+            job = q.jobs.front();
+            q.jobs.pop_front();
+            queued_.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::run(std::size_t self, Job job) {
+    // 对半拆分，后半段留给本线程稍后执行或被其他线程窃取
+    while (job.end - job.begin > 1) {
+        const std::size_t mid = job.begin + (job.end - job.begin) / 2;
+        push(self, Job{job.state, mid, job.end});
+        job.end = mid;
+    }
+    ForState& s = *job.state;
+    try {
+        (*s.fn)(job.begin);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(s.errorMutex);
+        if (!s.error) s.error = std::current_exception();
+    }
+    s.remaining.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void ThreadPool::workerLoop(std::size_t index) {
+    tlsPool = this;
+    tlsQueue = index;
+    for (;;) {
+        Job job;
+        if (tryPop(index, job)) {
+            run(index, job);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        sleepCv_.wait(lock, [&] { return stop_ || queued_.load() > 0; });
+        if (stop_) return;
+    }
+}
+
+void ThreadPool::parallelFor(std::size_t numTasks, const std::function<void(std::size_t)>& fn) {
+    if (numTasks == 0) return;
+    if (queues_.size() == 1 || numTasks == 1) {
+        for (std::size_t i = 0; i < numTasks; ++i) fn(i);
+        return;
+    }
+
+    ForState state;
+    state.fn = &fn;
+    state.remaining = numTasks;
+
+    // 初始区间平均分到各队列，其余由窃取平衡
+    const std::size_t self = currentQueue();
+    const std::size_t parts = std::min(numTasks, queues_.size());
+    for (std::size_t p = 0; p < parts; ++p) {
+        const std::size_t b = numTasks * p / parts;
+        const std::size_t e = numTasks * (p + 1) / parts;
+        push((self + p) % queues_.size(), Job{&state, b, e});
+    }
+
+    // 调用线程参与执行直至本批任务全部完成
+    while (state.remaining.load(std::memory_order_acquire) > 0) {
+        Job job;
+        if (tryPop(self, job)) run(self, job);
+        else std::this_thread::yield();
+    }
+    if (state.error) std::rethrow_exception(state.error);
+}
+
+} // namespace GeoAlgo
@@ -0,0 +1,74 @@
+#include "ArcLengthTable.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace GeoAlgo;
+
+int main() {
+    // 直线上的非均匀参数化：x(u) = 0.2u + 2.8u^2，弧长即 x
+    BezierCurve line({Point2D(0, 0), Point2D(0.1, 0), Point2D(3, 0)});
+    ArcLengthTable lt(line);
+    assert(std::fabs(lt.length() - 3.0) < 1e-12);
+    for (double s : {0.0, 0.37, 1.5, 2.99, 3.0}) {
+        const double t = lt.param(line, s);
+        assert(std::fabs(line.evaluate(t).x - s) < 1e-9);
+    }
+    std::vector<Point2D> pts(31);
+    std::vector<double> ts(31);
+    lt.equallySpaced(line, pts.size(), pts.data(), ts.data());
+    for (std::size_t i = 0; i < pts.size(); ++i) {
+        assert(std::fabs(pts[i].x - 0.1 * i) < 1e-9);
+        assert(pts[i] == line.evaluate(ts[i]));
+    }
+
+    // 抛物线 (t, t^2)，t ∈ [0, 1]：L = √5/2 + asinh(2)/4
+    PowerBasisCurve2D par({0.0, 1.0}, {0.0, 0.0, 1.0});
+    ArcLengthTable pt(par, 0.0, 1.0);
+    auto exact = [](double t) { return 0.5 * t * std::sqrt(1 + 4 * t * t) + 0.25 * std::asinh(2 * t); };
+    assert(std::fabs(pt.length() - exact(1.0)) < 1e-10);
+    for (double t : {0.1, 0.5, 0.8}) {
+        assert(std::fabs(pt.lengthAt(par, t) - exact(t)) < 1e-10);
+        assert(std::fabs(pt.param(par, exact(t)) - t) < 1e-9);
+    }
+    std::vector<double> ps(101);
+    pt.equallySpacedParams(par, ps.size(), ps.data());
+    assert(ps.front() == 0.0 && std::fabs(ps.back() - 1.0) < 1e-12);
+    for (std::size_t i = 0; i < ps.size(); ++i) assert(std::fabs(exact(ps[i]) - pt.length() * i / 100) < 1e-9);
+
+    // 三维直线 (t, 2t, 2t)，t ∈ [-1, 2]：速度恒为 3
+    PowerBasisCurve3D l3({0.0, 1.0}, {0.0, 2.0}, {0.0, 2.0});
+    ArcLengthTable t3(l3, -1.0, 2.0);
+    assert(std::fabs(t3.length() - 9.0) < 1e-12);
+    assert(std::fabs(t3.param(l3, 4.5) - 0.5) < 1e-12);
+
+    // 有理曲线：四分之一单位圆，按弧长等距即按角度等距
+    const double w = std::sqrt(0.5);
+    NURBS arc(2, {Point2D(1, 0), Point2D(1, 1), Point2D(0, 1)}, {0, 0, 0, 1, 1, 1}, {1.0, w, 1.0});
+    ArcLengthTable at(arc);
+    const double kPi = std::acos(-1.0);
+    assert(std::fabs(at.length() - kPi / 2) < 1e-10);
+    std::vector<Vec3d> cp(10);
+    at.equallySpaced(arc, cp.size(), cp.data());
+    for (std::size_t i = 0; i < cp.size(); ++i) {
+        const double angle = kPi / 2 * i / 9;
+        assert(std::fabs(cp[i].x - std::cos(angle)) < 1e-9 && std::fabs(cp[i].y - std::sin(angle)) < 1e-9);
+    }
+
+    // 多区间 B 样条：断点与节点对齐，逐点查询与批量一致
+    NURBS spl(3, {Point2D(0, 0), Point2D(1, 2), Point2D(3, 3), Point2D(4, 0), Point2D(6, 1), Point2D(7, 4)},
+              {0, 0, 0, 0, 0.25, 0.5, 1, 1, 1, 1});
+    ArcLengthTable st(spl);
+    assert(st.intervals() >= 12);
+    std::vector<double> sp(57);
+    st.equallySpacedParams(spl, sp.size(), sp.data());
+    for (std::size_t i = 0; i < sp.size(); ++i) {
+        const double s = st.length() * i / 56;
+        assert(std::fabs(st.param(spl, s) - sp[i]) < 1e-9);
+        assert(std::fabs(st.lengthAt(spl, sp[i]) - s) < 1e-8);
+    }
+
+    std::cout << "✅ Arc-length table test passed!" << std::endl;
+    return 0;
+}
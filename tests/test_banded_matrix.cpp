@@ -0,0 +1,100 @@
+#include "BandedMatrix.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace GeoAlgo;
+
+int main() {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> uni(-1.0, 1.0);
+
+    // LU：对角占优的一般带状矩阵，已知解 X 反推右端项
+    {
+        const int n = 200, kl = 2, ku = 3, nrhs = 3;
+        BandedMatrix A(n, kl, ku);
+        for (int i = 0; i < n; ++i)
+            for (int j = std::max(0, i - kl); j <= std::min(n - 1, i + ku); ++j) A(i, j) = i == j ? 10.0 : uni(rng);
+        std::vector<double> X(n * nrhs), B(n * nrhs, 0.0);
+        for (double& x : X) x = uni(rng);
+        for (int i = 0; i < n; ++i)
+            for (int j = std::max(0, i - kl); j <= std::min(n - 1, i + ku); ++j)
+                for (int c = 0; c < nrhs; ++c) B[i * nrhs + c] += A(i, j) * X[j * nrhs + c];
+        A.factorLU();
+        A.solve(B.data(), nrhs);
+        for (int i = 0; i < n * nrhs; ++i) assert(std::abs(B[i] - X[i]) < 1e-12);
+    }
+
+    // Cholesky：只存下带的对称正定矩阵
+    {
+        const int n = 150, p = 3;
+        BandedMatrix A(n, p, 0);
+        for (int i = 0; i < n; ++i) {
+            A(i, i) = 8.0;
+            for (int j = std::max(0, i - p); j < i; ++j) A(i, j) = uni(rng);
+        }
+        std::vector<double> X(n * 2), B(n * 2, 0.0);
+        for (double& x : X) x = uni(rng);
+        for (int i = 0; i < n; ++i)
+            for (int j = std::max(0, i - p); j <= std::min(n - 1, i + p); ++j) {
+                const double a = j <= i ? A(i, j) : A(j, i);
+                for (int c = 0; c < 2; ++c) B[i * 2 + c] += a * X[j * 2 + c];
+            }
+        A.factorCholesky();
+        A.solve(B.data(), 2);
+        for (int i = 0; i < n * 2; ++i) assert(std::abs(B[i] - X[i]) < 1e-12);
+    }
+
+    // 三对角与 1×1
+    {
+        BandedMatrix T(4, 1, 1);
+        for (int i = 0; i < 4; ++i) {
+            T(i, i) = 4.0;
+            if (i > 0) T(i, i - 1) = 1.0;
+            if (i < 3) T(i, i + 1) = 1.0;
+        }
+        double b[] = {5.0, 6.0, 6.0, 5.0}; // 解全为 1
+        T.factorLU();
+        T.solve(b, 1);
+        for (double v : b) assert(std::abs(v - 1.0) < 1e-15);
+
+        BandedMatrix one(1, 0, 0);
+        one(0, 0) = 4.0;
+        double x = 2.0;
+        one.factorCholesky();
+        one.solve(&x, 1);
+        assert(x == 0.5);
+    }
+
+    // 错误处理
+    {
+        bool threw = false;
+        try { BandedMatrix(3, -1, 0); } catch (const std::invalid_argument&) { threw = true; }
+        assert(threw);
+
+        BandedMatrix S(2, 1, 0);
+        S(0, 0) = 1.0;
+        S(1, 0) = 2.0;
+        S(1, 1) = 1.0; // 不定
+        threw = false;
+        try { S.factorCholesky(); } catch (const std::runtime_error&) { threw = true; }
+        assert(threw);
+
+        BandedMatrix Z(2, 1, 1);
+        threw = false;
+        try { Z.factorLU(); } catch (const std::runtime_error&) { threw = true; }
+        assert(threw);
+
+        BandedMatrix U(2, 0, 0);
+        double b[2] = {1.0, 1.0};
+        threw = false;
+        try { U.solve(b, 1); } catch (const std::invalid_argument&) { threw = true; }
+        assert(threw);
+    }
+
+    std::cout << "✅ Banded matrix test passed!" << std::endl;
+    return 0;
+}
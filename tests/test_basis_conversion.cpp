@@ -0,0 +1,103 @@
+#include "BasisConversion.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace GeoAlgo;
+
+int main() {
+    // 三次矩阵：a = M b
+    const double* M = bezierToPowerMatrix(3);
+    const double expected[16] = {1, 0, 0, 0, -3, 3, 0, 0, 3, -6, 3, 0, -1, 3, -3, 1};
+    for (int i = 0; i < 16; ++i) assert(M[i] == expected[i]);
+
+    // 两个方向互逆
+    for (int n = 0; n <= kMaxConversionDegree; ++n) {
+        const double* A = bezierToPowerMatrix(n);
+        const double* B = powerToBezierMatrix(n);
+        for (int i = 0; i <= n; ++i)
+            for (int j = 0; j <= n; ++j) {
+                double sum = 0.0;
+                for (int k = 0; k <= n; ++k) sum += B[i * (n + 1) + k] * A[k * (n + 1) + j];
+                assert(std::fabs(sum - (i == j ? 1.0 : 0.0)) < (n <= 10 ? 1e-12 : 1e-3));
+            }
+    }
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> d(-1.0, 1.0);
+    for (int n = 0; n <= 10; ++n) {
+        std::vector<Point2D> P;
+        for (int i = 0; i <= n; ++i) P.emplace_back(d(rng), d(rng));
+        BezierCurve bez(P);
+        PowerBasisCurve pb = toPowerBasis(bez);
+        PowerBasisCurve2D pb2 = toPowerBasis2D(bez);
+        BezierCurve back = toBezier(pb);
+        BezierCurve back2 = toBezier(pb2);
+        for (int i = 0; i <= n; ++i) {
+            assert(back.controlPoints()[i].distanceTo(P[i]) < 1e-12);
+            assert(back2.controlPoints()[i].distanceTo(P[i]) < 1e-12);
+        }
+        for (double u : {0.0, 0.3, 0.71, 1.0}) {
+            assert(pb.evaluate(u).distanceTo(bez.evaluate(u)) < 1e-12);
+            assert(pb2.evaluate(u).distanceTo(bez.evaluate(u)) < 1e-12);
+        }
+
+        // 一维
+        std::vector<double> vals;
+        for (int i = 0; i <= n; ++i) vals.push_back(P[i].x);
+        PowerBasisCurve1D f = toPowerBasis1D(vals);
+        std::vector<double> vb = toBezierValues(f);
+        for (int i = 0; i <= n; ++i) assert(std::fabs(vb[i] - vals[i]) < 1e-12);
+        assert(std::fabs(f.evaluate(0.4) - bez.evaluate(0.4).x) < 1e-12);
+
+        // 缓存的幂基形式：AoS 与 SoA 批量求值
+        std::vector<double> us(1000);
+        for (std::size_t k = 0; k < us.size(); ++k) us[k] = k / 999.0;
+        std::vector<Point2D> ref(us.size()), fast(us.size());
+        bez.evaluateMany(us.data(), us.size(), ref.data());
+        BezierCurve cached = bez;
+        assert(!cached.hasPowerBasisCache());
+        cached.cachePowerBasis();
+        assert(cached.hasPowerBasisCache());
+        cached.evaluateMany(us.data(), us.size(), fast.data());
+        std::vector<double> xs(us.size()), ys(us.size());
+        cached.evaluateMany(us.data(), us.size(), xs.data(), ys.data());
+        for (std::size_t k = 0; k < us.size(); ++k) {
+            assert(fast[k].distanceTo(ref[k]) < 1e-11);
+            assert(fast[k] == Point2D(xs[k], ys[k]));
+        }
+        cached.clearPowerBasisCache();
+        cached.evaluateMany(us.data(), us.size(), fast.data());
+        assert(fast == ref);
+    }
+
+    // 批量
+    std::vector<BezierCurve> curves;
+    for (int c = 0; c < 700; ++c) {
+        std::vector<Point2D> P;
+        for (int i = 0; i <= c % 6; ++i) P.emplace_back(d(rng), d(rng));
+        curves.emplace_back(P);
+    }
+    ThreadPool pool(3);
+    std::vector<PowerBasisCurve> pbs(curves.size());
+    toPowerBasis(curves.data(), curves.size(), pbs.data(), pool);
+    std::vector<BezierCurve> round(curves.size());
+    toBezier(pbs.data(), pbs.size(), round.data(), pool);
+    for (std::size_t c = 0; c < curves.size(); ++c) {
+        assert(pbs[c].coefficients() == toPowerBasis(curves[c]).coefficients());
+        assert(round[c].evaluate(0.6).distanceTo(curves[c].evaluate(0.6)) < 1e-12);
+    }
+
+    bool threw = false;
+    try {
+        bezierToPowerMatrix(kMaxConversionDegree + 1);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "✅ Basis conversion test passed!" << std::endl;
+    return 0;
+}
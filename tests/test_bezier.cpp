@@ -0,0 +1,50 @@
+#include "BezierCurve.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace GeoAlgo;
+
+// 直接按 Bernstein 定义求值，作为参考结果
+static Point2D bernsteinReference(const std::vector<Point2D>& P, double u) {
+    int n = static_cast<int>(P.size()) - 1;
+    Point2D r(0, 0);
+    for (int i = 0; i <= n; ++i) {
+        double c = 1.0;
+        for (int k = 1; k <= i; ++k) c *= (n - k + 1) / static_cast<double>(k);
+        r = r + P[i] * (c * std::pow(1 - u, n - i) * std::pow(u, i));
+    }
+    return r;
+}
+
+int main() {
+    std::vector<Point2D> ctrl = {{0, 0}, {1, 2}, {3, 3}, {4, 0}, {5, -1}};
+    BezierCurve bezier(ctrl);
+    assert(bezier.degree() == 4);
+
+    const int N = 101;
+    std::vector<double> us(N);
+    for (int k = 0; k < N; ++k) us[k] = static_cast<double>(k) / (N - 1);
+
+    std::vector<Point2D> out(N);
+    bezier.evaluateMany(us.data(), us.size(), out.data());
+
+    for (int k = 0; k < N; ++k) {
+        Point2D ref = bernsteinReference(ctrl, us[k]);
+        Point2D p = bezier.evaluate(us[k]);
+        assert(p.distanceTo(ref) < 1e-12);
+        assert(out[k].distanceTo(ref) < 1e-12);
+    }
+
+    // 端点插值
+    assert(bezier.evaluate(0.0).distanceTo(ctrl.front()) < 1e-15);
+    assert(bezier.evaluate(1.0).distanceTo(ctrl.back()) < 1e-12);
+
+    // 空曲线
+    BezierCurve empty;
+    assert(empty.evaluate(0.5).distanceTo(Point2D(0, 0)) == 0.0);
+
+    std::cout << "✅ BezierCurve evaluate/evaluateMany test passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include "CurveBatch.h"
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace GeoAlgo;
+
+int main() {
+    // 线程池：每个下标恰好执行一次，异常传回调用线程，嵌套调用不死锁
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> hits(1000);
+    pool.parallelFor(hits.size(), [&](std::size_t i) { hits[i]++; });
+    for (auto& h : hits) assert(h == 1);
+
+    std::atomic<int> nested{0};
+    pool.parallelFor(8, [&](std::size_t) {
+        pool.parallelFor(8, [&](std::size_t) { nested++; });
+    });
+    assert(nested == 64);
+
+    bool threw = false;
+    try {
+        pool.parallelFor(100, [](std::size_t i) {
+            if (i == 37) throw std::runtime_error("task failed");
+        });
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // 曲线集合
+    const std::size_t numCurves = 37, count = 101;
+    std::vector<BezierCurve> beziers;
+    std::vector<PowerBasisCurve2D> pb2;
+    std::vector<NURBS> nurbs;
+    for (std::size_t c = 0; c < numCurves; ++c) {
+        double s = 0.1 * c;
+        beziers.emplace_back(std::vector<Point2D>{{0, s}, {1, 2 + s}, {3, 3 - s}, {4, s * s}});
+        pb2.emplace_back(std::vector<double>{s, 1.0, -s}, std::vector<double>{1.0, s, 0.5, -0.25});
+        std::vector<double> pts = {0, 0, 1, s, 2, 1, 3, -s, 4, 0};
+        if (c % 2) {
+            nurbs.emplace_back(2, 2, pts, NURBS::clampedUniformKnots(5, 2));
+        } else {
+            std::vector<double> p3;
+            for (std::size_t i = 0; i < pts.size(); i += 2) {
+                p3.push_back(pts[i]);
+                p3.push_back(pts[i + 1]);
+                p3.push_back(s * i);
+            }
+            nurbs.emplace_back(3, 3, p3, NURBS::clampedUniformKnots(5, 3), std::vector<double>{1, 2, 1, 0.5, 1});
+        }
+    }
+    std::vector<double> us(count);
+    for (std::size_t k = 0; k < count; ++k) us[k] = static_cast<double>(k) / (count - 1);
+
+    // 参考结果：单线程逐条求值
+    std::vector<Point2D> refB(numCurves * count);
+    std::vector<double> refX(numCurves * count), refY(numCurves * count), refN;
+    for (std::size_t c = 0; c < numCurves; ++c) {
+        beziers[c].evaluateMany(us.data(), count, refB.data() + c * count);
+        pb2[c].evaluateMany(us.data(), count, refX.data() + c * count, refY.data() + c * count);
+        std::vector<double> tmp(count * nurbs[c].dimension());
+        nurbs[c].evaluateMany(us.data(), count, tmp.data());
+        refN.insert(refN.end(), tmp.begin(), tmp.end());
+    }
+
+    // 不同线程数与粒度下结果逐位一致
+    for (std::size_t threads : {1, 2, 5}) {
+        for (std::size_t grain : {7, 101, 4096}) {
+            CurveBatch batch(threads, grain);
+            std::vector<Point2D> outB(numCurves * count);
+            batch.evaluate(beziers.data(), numCurves, us.data(), count, outB.data());
+            assert(outB == refB);
+
+            std::vector<double> xs(numCurves * count), ys(numCurves * count);
+            batch.evaluate(pb2.data(), numCurves, us.data(), count, xs.data(), ys.data());
+            assert(xs == refX && ys == refY);
+
+            std::vector<double> outN(refN.size());
+            batch.evaluate(nurbs.data(), numCurves, us.data(), count, outN.data());
+            assert(outN == refN);
+        }
+    }
+
+    std::cout << "✅ CurveBatch test passed!" << std::endl;
+    return 0;
+}
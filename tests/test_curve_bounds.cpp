@@ -0,0 +1,141 @@
+#include "CurveBounds.h"
+#include <cassert>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace GeoAlgo;
+
+// 稠密采样的包围盒：精确包围盒必须包含它，且只比它大采样误差
+static Box3D sampled(const std::function<Vec3d(double)>& f, double t0, double t1) {
+    Box3D box;
+    const int S = 20000;
+    for (int i = 0; i <= S; ++i) box.expand(f(t0 + (t1 - t0) * i / S));
+    return box;
+}
+
+static void checkTight(const Box3D& exact, const Box3D& s, int dim, double tol) {
+    for (int d = 0; d < dim; ++d) {
+        assert(exact.lo[d] <= s.lo[d] + 1e-12 && exact.hi[d] >= s.hi[d] - 1e-12);
+        assert(exact.lo[d] >= s.lo[d] - tol && exact.hi[d] <= s.hi[d] + tol);
+    }
+}
+
+static Box3D to3(const Box2D& b) {
+    return Box3D(Vec3d(b.lo.x, b.lo.y, 0.0), Vec3d(b.hi.x, b.hi.y, 0.0));
+}
+
+int main() {
+    // 多项式实根
+    {
+        // (t - 0.2)(t - 0.5)(t - 0.9) = -0.09 + 0.73 t - 1.6 t^2 + t^3
+        const double c[] = {-0.09, 0.73, -1.6, 1.0};
+        double roots[3];
+        assert(polynomialRoots(c, 3, 0.0, 1.0, roots) == 3);
+        assert(std::abs(roots[0] - 0.2) < 1e-14 && std::abs(roots[1] - 0.5) < 1e-14 && std::abs(roots[2] - 0.9) < 1e-14);
+        assert(polynomialRoots(c, 3, 0.3, 0.6, roots) == 1 && std::abs(roots[0] - 0.5) < 1e-14);
+        // 重根 (t - 0.5)^2 与恒零多项式
+        const double sq[] = {0.25, -1.0, 1.0};
+        assert(polynomialRoots(sq, 2, 0.0, 1.0, roots) == 1 && std::abs(roots[0] - 0.5) < 1e-8);
+        const double zero[] = {0.0, 0.0, 0.0};
+        assert(polynomialRoots(zero, 2, 0.0, 1.0, roots) == 0);
+    }
+
+    // 闭式结果：抛物线顶点与半圆
+    {
+        const BezierCurve parabola({Point2D(0, 0), Point2D(1, 2), Point2D(2, 0)});
+        const Box2D b = exactBounds(parabola);
+        assert(b.lo.x == 0.0 && b.hi.x == 2.0 && b.lo.y == 0.0 && std::abs(b.hi.y - 1.0) < 1e-15);
+
+        // 单位半圆（权重 1, 1/2, 1/2, 1），顶点 (0,1) 在两段的连接处
+        const NURBS arc(2, {Point2D(1, 0), Point2D(1, 1), Point2D(-1, 1), Point2D(-1, 0)},
+                        {0, 0, 0, 0.5, 1, 1, 1}, {1, 0.5, 0.5, 1});
+        const Box2D a = exactBounds(arc);
+        assert(std::abs(a.lo.x + 1.0) < 1e-15 && std::abs(a.hi.x - 1.0) < 1e-15);
+        assert(std::abs(a.lo.y) < 1e-15 && std::abs(a.hi.y - 1.0) < 1e-14);
+    }
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> coord(-5.0, 5.0);
+    std::uniform_real_distribution<double> weight(0.3, 3.0);
+    // 14 组覆盖 Bezier 次数 2..8、B 样条次数 1..4 以及有理 / 非有理
+    for (int trial = 0; trial < 14; ++trial) {
+        const int n = 2 + trial % 7;
+
+        std::vector<Point2D> P;
+        for (int i = 0; i <= n; ++i) P.push_back(Point2D(coord(rng), coord(rng)));
+        const BezierCurve bezier(P);
+        checkTight(to3(exactBounds(bezier)),
+                   sampled([&](double u) { const Point2D p = bezier.evaluate(u); return Vec3d(p.x, p.y, 0.0); }, 0, 1),
+                   2, 1e-6);
+
+        std::vector<Vec3d> R;
+        std::vector<double> W;
+        for (int i = 0; i <= n; ++i) {
+            R.push_back(Vec3d(coord(rng), coord(rng), coord(rng)));
+            W.push_back(weight(rng));
+        }
+        const RationalBezierCurve rational(R, W);
+        checkTight(exactBounds3D(rational), sampled([&](double u) { return rational.evaluate3D(u); }, 0, 1), 3, 1e-5);
+
+        std::vector<double> xs, ys, zs;
+        for (int i = 0; i <= n; ++i) {
+            xs.push_back(coord(rng));
+            ys.push_back(coord(rng));
+            zs.push_back(coord(rng));
+        }
+        const PowerBasisCurve3D power(xs, ys, zs);
+        checkTight(exactBounds(power, -1.0, 1.5), sampled([&](double t) { return power.evaluate(t); }, -1.0, 1.5), 3,
+                   1e-4);
+        const PowerBasisCurve2D power2(xs, ys);
+        const Box2D b2 = exactBounds(power2);
+        const std::pair<double, double> rx = exactRange(power.xCurve());
+        assert(b2.lo.x == rx.first && b2.hi.x == rx.second);
+
+        std::vector<Point2D> pc;
+        for (int i = 0; i <= n; ++i) pc.push_back(P[i] * 0.5);
+        const PowerBasisCurve legacy(pc);
+        checkTight(to3(exactBounds(legacy)),
+                   sampled([&](double u) { const Point2D p = legacy.evaluate(u); return Vec3d(p.x, p.y, 0.0); }, 0, 1),
+                   2, 1e-5);
+
+        // 非均匀（有理）B 样条，逐个 Bezier 段处理
+        const int p = 1 + trial % 4, m = p + 4;
+        std::vector<double> cp, ws;
+        for (int i = 0; i < m * 3; ++i) cp.push_back(coord(rng));
+        for (int i = 0; i < m; ++i) ws.push_back(trial % 2 ? weight(rng) : 1.0);
+        std::vector<double> knots = NURBS::clampedUniformKnots(m, p);
+        knots[p + 1] = 0.1;
+        const NURBS nurbs(p, 3, cp, knots, ws);
+        checkTight(exactBounds3D(nurbs),
+                   sampled([&](double u) { return nurbs.evaluatePoint3D(u); }, nurbs.firstParam(), nurbs.lastParam()),
+                   3, 1e-5);
+        const Box2D n2 = exactBounds(nurbs);
+        assert(n2.lo.y == exactBounds3D(nurbs).lo.y);
+    }
+
+    // 精确盒不大于控制多边形盒
+    {
+        const BezierCurve c({Point2D(0, 0), Point2D(1, 5), Point2D(2, -5), Point2D(3, 0)});
+        const Box2D b = exactBounds(c);
+        assert(b.hi.y < 5.0 && b.lo.y > -5.0 && std::abs(b.hi.y + b.lo.y) < 1e-14);
+    }
+
+    // 参数区间颠倒时拒绝
+    {
+        const PowerBasisCurve2D c({0.0, 1.0}, {1.0, 0.0, 1.0});
+        bool threw = false;
+        try {
+            exactBounds(c, 1.0, 0.0);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    std::cout << "✅ Curve bounds test passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,150 @@
+#include "CurveBVH.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace GeoAlgo;
+
+// 暴力最近距离：均匀采样找出距离的局部极小，再在相邻两个采样参数之间黄金分割细化
+static const int kSamples = 128;
+
+template <typename Eval>
+static double closestOnCurve(Eval eval, double u0, double u1, const Point2D& q) {
+    std::vector<double> d(kSamples + 1);
+    for (int i = 0; i <= kSamples; ++i) d[i] = eval(u0 + (u1 - u0) * i / kSamples).distanceTo(q);
+    double best = 1e300;
+    const double h = (u1 - u0) / kSamples;
+    const double g = 0.5 * (std::sqrt(5.0) - 1.0);
+    for (int i = 0; i <= kSamples; ++i) {
+        if ((i > 0 && d[i] > d[i - 1]) || (i < kSamples && d[i] > d[i + 1])) continue;
+        double a = u0 + h * std::max(i - 1, 0), b = u0 + h * std::min(i + 1, kSamples);
+        double x1 = b - g * (b - a), x2 = a + g * (b - a);
+        double f1 = eval(x1).distanceTo(q), f2 = eval(x2).distanceTo(q);
+        for (int it = 0; it < 60; ++it) {
+            if (f1 < f2) {
+                b = x2, x2 = x1, f2 = f1;
+                x1 = b - g * (b - a), f1 = eval(x1).distanceTo(q);
+            } else {
+                a = x1, x1 = x2, f1 = f2;
+                x2 = a + g * (b - a), f2 = eval(x2).distanceTo(q);
+            }
+        }
+        best = std::min({best, d[i], f1, f2});
+    }
+    return best;
+}
+
+static double bruteForce(const std::vector<BezierCurve>& bez, const std::vector<NURBS>& nurbs,
+                         const std::vector<bool>& alive, const Point2D& q) {
+    double best = 1e300;
+    for (std::size_t c = 0; c < bez.size(); ++c) {
+        if (!alive[c]) continue;
+        best = std::min(best, closestOnCurve([&](double u) { return bez[c].evaluate(u); }, 0.0, 1.0, q));
+    }
+    for (const NURBS& n : nurbs)
+        best = std::min(best, closestOnCurve([&](double u) { return n.evaluatePoint(u); }, n.firstParam(),
+                                             n.lastParam(), q));
+    return best;
+}
+
+int main() {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> pos(0.0, 100.0);
+    std::uniform_real_distribution<double> off(-8.0, 8.0);
+
+    CurveBVH bvh;
+    assert(bvh.closestPoint(Point2D(0, 0)).curve == -1);
+
+    std::vector<BezierCurve> bez;
+    for (int c = 0; c < 60; ++c) {
+        const Point2D base(pos(rng), pos(rng));
+        std::vector<Point2D> pts;
+        for (int i = 0; i <= 3 + c % 3; ++i) pts.push_back(base + Point2D(off(rng), off(rng)));
+        bez.emplace_back(pts);
+        assert(bvh.add(bez.back()) == c);
+    }
+    // 两条 NURBS：四分之一圆（有理）与非均匀三次 B 样条
+    const double s = std::sqrt(0.5);
+    std::vector<NURBS> nurbs;
+    nurbs.emplace_back(2, std::vector<Point2D>{Point2D(60, 50), Point2D(60, 60), Point2D(50, 60)},
+                       std::vector<double>{0, 0, 0, 1, 1, 1}, std::vector<double>{1, s, 1});
+    nurbs.emplace_back(3, std::vector<Point2D>{Point2D(10, 10), Point2D(20, 40), Point2D(40, 0),
+                                               Point2D(60, 30), Point2D(80, 5), Point2D(95, 45)},
+                       std::vector<double>{0, 0, 0, 0, 0.2, 0.7, 1, 1, 1, 1});
+    const int arcId = bvh.add(nurbs[0]);
+    const int splId = bvh.add(nurbs[1]);
+    assert(bvh.size() == 62);
+
+    std::vector<bool> alive(bez.size(), true);
+    std::vector<Point2D> qs;
+    for (int i = 0; i < 300; ++i) qs.emplace_back(pos(rng), pos(rng));
+
+    // 暴力结果只随曲线集合变化，重建前后共用
+    std::vector<double> brute;
+    auto computeBrute = [&] {
+        brute.resize(qs.size());
+        for (std::size_t i = 0; i < qs.size(); ++i) brute[i] = bruteForce(bez, nurbs, alive, qs[i]);
+    };
+    auto check = [&](const CurveBVH& tree) {
+        std::vector<CurveBVH::Projection> out(qs.size());
+        tree.closestPoints(qs.data(), qs.size(), out.data());
+        for (std::size_t i = 0; i < qs.size(); ++i) {
+            const CurveBVH::Projection p = tree.closestPoint(qs[i]);
+            assert(p.curve == out[i].curve && p.param == out[i].param && p.distance == out[i].distance);
+            // 与细化后的暴力结果一致
+            assert(std::fabs(p.distance - brute[i]) < 1e-9);
+            assert(std::fabs(p.point.distanceTo(qs[i]) - p.distance) < 1e-12);
+            // 最近点与参数一致
+            const Point2D onCurve = p.curve < static_cast<int>(bez.size()) ? bez[p.curve].evaluate(p.param)
+                                                                          : nurbs[p.curve - bez.size()].evaluatePoint(p.param);
+            assert(p.point.distanceTo(onCurve) < 1e-12);
+        }
+    };
+    computeBrute();
+    check(bvh);
+    bvh.rebuild();
+    assert(bvh.height() <= 9);
+    check(bvh);
+
+    // 增量修改：删除、替换后与暴力结果一致
+    for (int c = 0; c < 60; c += 3) {
+        bvh.remove(c);
+        alive[c] = false;
+    }
+    for (int c = 1; c < 60; c += 7) {
+        if (!alive[c]) continue;
+        std::vector<Point2D> pts = bez[c].controlPoints();
+        for (Point2D& p : pts) p += Point2D(5, -5);
+        bez[c] = BezierCurve(pts);
+        bvh.update(c, bez[c]);
+    }
+    assert(bvh.size() == 42 && bvh.contains(8) && !bvh.contains(0) && bvh.contains(1));
+    computeBrute();
+    check(bvh);
+    bvh.rebuild();
+    check(bvh);
+
+    // 点求逆：曲线上的点投影回原参数
+    for (double u : {0.0, 0.13, 0.5, 0.91, 1.0}) {
+        CurveBVH::Projection p = bvh.project(arcId, nurbs[0].evaluatePoint(u));
+        assert(p.distance < 1e-12 && std::fabs(p.param - u) < 1e-9);
+        p = bvh.project(splId, nurbs[1].evaluatePoint(u));
+        assert(p.distance < 1e-12 && std::fabs(p.param - u) < 1e-9);
+    }
+    // 圆心到圆弧的距离为半径
+    assert(std::fabs(bvh.project(arcId, Point2D(50, 50)).distance - 10.0) < 1e-9);
+
+    bool threw = false;
+    try {
+        bvh.remove(0);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "✅ Curve BVH test passed!" << std::endl;
+    return 0;
+}
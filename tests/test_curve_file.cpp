@@ -0,0 +1,206 @@
+#include "CurveFile.h"
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace GeoAlgo;
+
+int main() {
+    const char* path = "test_curve_file.gcf";
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> coord(-3.0, 3.0);
+    std::uniform_real_distribution<double> weight(0.4, 2.0);
+
+    std::vector<Point2D> bp;
+    for (int i = 0; i < 6; ++i) bp.push_back(Point2D(coord(rng), coord(rng)));
+    const BezierCurve bezier(bp);
+    std::vector<Vec3d> rp;
+    std::vector<double> rw;
+    for (int i = 0; i < 4; ++i) {
+        rp.push_back(Vec3d(coord(rng), coord(rng), coord(rng)));
+        rw.push_back(weight(rng));
+    }
+    const RationalBezierCurve rational(rp, rw);
+    const PowerBasisCurve power({Point2D(1, 2), Point2D(-1, 0.5), Point2D(0.25, 3)});
+    const PowerBasisCurve1D power1({1.0, -2.0, 0.5, 4.0});
+    const PowerBasisCurve2D power2({1.0, 2.0}, {0.0, -1.0, 3.0, 0.5});
+    const PowerBasisCurve3D power3({1.0, 2.0, 3.0}, {0.5}, {0.0, 0.0, 1.0, -1.0});
+    std::vector<double> np, nw;
+    for (int i = 0; i < 9 * 3; ++i) np.push_back(coord(rng));
+    for (int i = 0; i < 9; ++i) nw.push_back(weight(rng));
+    std::vector<double> knots = NURBS::clampedUniformKnots(9, 3);
+    knots[5] = knots[4]; // 二重内部节点
+    const NURBS nurbs(3, 3, np, knots, nw);
+    const NURBS spline(2, {Point2D(0, 0), Point2D(1, 2), Point2D(2, 0), Point2D(3, 1)},
+                       NURBS::clampedUniformKnots(4, 2));
+
+    CurveStore2D store;
+    store.append(bezier);
+    store.append(power);
+
+    {
+        CurveFileWriter w(path);
+        assert(w.add(bezier) == 0);
+        assert(w.add(rational) == 1);
+        assert(w.add(power) == 2);
+        assert(w.add(power1) == 3);
+        assert(w.add(power2) == 4);
+        assert(w.add(power3) == 5);
+        assert(w.add(nurbs) == 6);
+        assert(w.add(spline) == 7);
+        w.add(store);
+        assert(w.size() == 10);
+        bool threw = false;
+        try {
+            w.add(BezierCurve());
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+        // 析构时自动 finish
+    }
+
+    const CurveFile file(path);
+    assert(file.size() == 10);
+    assert(file.validate().empty());
+    assert(file.header().version == kCurveFileVersion);
+
+    // 记录布局：每块 64 字节对齐，非有理 B 样条不写权重
+    for (std::size_t i = 0; i < file.size(); ++i)
+        assert(reinterpret_cast<std::uintptr_t>(file.record(i).coeffs) % kCurveFileAlignment == 0);
+    assert(file.record(1).rational && file.record(1).dim == 3);
+    assert(file.record(6).type == CurveFileType::BSpline && file.record(6).rational);
+    assert(file.record(7).type == CurveFileType::BSpline && !file.record(7).rational);
+    assert(file.record(5).degree == 3 && file.record(5).numPoints == 4);
+
+    // 映射页上直接求值，与原曲线一致
+    std::vector<double> us(301);
+    for (std::size_t k = 0; k < us.size(); ++k) us[k] = k / 300.0;
+    std::vector<Vec3d> out(us.size());
+    for (double u : us) {
+        const Point2D b = bezier.evaluate(u), pw = power.evaluate(u);
+        const Vec2d p2 = power2.evaluate(u);
+        assert((file.evaluate(0, u) - Vec3d(b.x, b.y, 0.0)).norm() < 1e-12);
+        assert((file.evaluate(1, u) - rational.evaluate3D(u)).norm() < 1e-12);
+        assert((file.evaluate(2, u) - Vec3d(pw.x, pw.y, 0.0)).norm() < 1e-12);
+        assert(std::abs(file.evaluate(3, u).x - power1.evaluate(u)) < 1e-12);
+        assert((file.evaluate(4, u) - Vec3d(p2.x, p2.y, 0.0)).norm() < 1e-12);
+        assert((file.evaluate(5, u) - power3.evaluate(u)).norm() < 1e-12);
+        assert((file.evaluate(6, u) - nurbs.evaluatePoint3D(u)).norm() < 1e-12);
+        assert((file.evaluate(7, u) - spline.evaluatePoint3D(u)).norm() < 1e-12);
+        assert((file.evaluate(8, u) - Vec3d(b.x, b.y, 0.0)).norm() < 1e-12);
+        assert((file.evaluate(9, u) - Vec3d(pw.x, pw.y, 0.0)).norm() < 1e-12);
+    }
+    for (std::size_t i = 0; i < file.size(); ++i) {
+        file.evaluateMany(i, us.data(), us.size(), out.data());
+        for (std::size_t k = 0; k < us.size(); ++k) assert((out[k] - file.evaluate(i, us[k])).norm() < 1e-12);
+    }
+    // SoA：幂基曲线走 SIMD 内核
+    std::vector<double> xs(us.size()), ys(us.size()), zs(us.size());
+    double* outs[3] = {xs.data(), ys.data(), zs.data()};
+    file.evaluateMany(5, us.data(), us.size(), outs);
+    for (std::size_t k = 0; k < us.size(); ++k)
+        assert((Vec3d(xs[k], ys[k], zs[k]) - power3.evaluate(us[k])).norm() < 1e-12);
+
+    // 复制回曲线对象
+    for (int i = 0; i <= 5; ++i) assert(file.bezierCurve(0).controlPoints()[i] == bp[i]);
+    assert(file.rationalBezier(1).evaluate3D(0.3).distanceTo(rational.evaluate3D(0.3)) < 1e-13);
+    assert(file.powerBasis(2).coefficients() == power.coefficients());
+    assert(file.powerBasis1D(3).coefficients() == power1.coefficients());
+    assert(file.powerBasis2D(4).yCurve().coefficients() == power2.yCurve().coefficients());
+    assert(file.powerBasis3D(5).zCurve().coefficients() == power3.zCurve().coefficients());
+    const NURBS back = file.nurbs(6);
+    assert(back.knots() == nurbs.knots());
+    assert(back.evaluatePoint3D(0.7).distanceTo(nurbs.evaluatePoint3D(0.7)) < 1e-13);
+    bool threw = false;
+    try {
+        file.bezierCurve(2);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // 内存中的副本：校验能发现损坏，结构错误在打开或访问时抛出
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    const std::size_t bytes = static_cast<std::size_t>(in.tellg());
+    in.seekg(0);
+    std::vector<double> buf((bytes + 7) / 8);
+    in.read(reinterpret_cast<char*>(buf.data()), static_cast<std::streamsize>(bytes));
+    {
+        const CurveFile mem = CurveFile::fromMemory(buf.data(), bytes);
+        assert(mem.size() == file.size() && mem.validate().empty());
+        assert((mem.evaluate(6, 0.4) - file.evaluate(6, 0.4)).norm() < 1e-15);
+    }
+    {
+        const CurveFile::Record r = file.record(6);
+        const double* base = reinterpret_cast<const double*>(&file.header());
+        const std::size_t knotIndex = static_cast<std::size_t>(r.knots - base);
+        const std::size_t lastWeight = static_cast<std::size_t>(r.coeffs - base) + 9 * 4 - 1;
+        std::vector<double> bad = buf;
+        std::swap(bad[knotIndex + 4], bad[knotIndex + 7]);
+        bad[lastWeight] = -1.0;
+        const CurveFile mem = CurveFile::fromMemory(bad.data(), bytes);
+        const std::vector<std::string> issues = mem.validate();
+        assert(issues.size() == 2);
+        assert(issues[0].find("curve 6") == 0);
+        // 0 表示不限条数；record() 同样拒绝递减的节点
+        assert(mem.validate(0) == issues && mem.validate(1).size() == 1);
+        threw = false;
+        try {
+            mem.record(6);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+    {
+        std::vector<double> bad = buf;
+        CurveFileHeader h;
+        std::memcpy(&h, bad.data(), sizeof(h));
+        CurveFileEntry e;
+        std::memcpy(&e, reinterpret_cast<const char*>(bad.data()) + h.indexOffset, sizeof(e));
+        e.coeffOffset = h.dataSize; // 越界
+        std::memcpy(reinterpret_cast<char*>(bad.data()) + h.indexOffset, &e, sizeof(e));
+        const CurveFile mem = CurveFile::fromMemory(bad.data(), bytes);
+        threw = false;
+        try {
+            mem.evaluate(0, 0.5);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw);
+        assert(mem.validate().size() == 1);
+
+        bad[0] = 0.0; // 破坏 magic
+        threw = false;
+        try {
+            CurveFile::fromMemory(bad.data(), bytes);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    // 未关联文件
+    {
+        CurveFile empty;
+        assert(empty.size() == 0 && empty.validate().empty());
+        threw = false;
+        try {
+            empty.header();
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    std::remove(path);
+    std::cout << "✅ Curve file test passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include "CurveFitting.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace GeoAlgo;
+
+int main() {
+    // 参数化
+    {
+        const std::vector<double> pts = {0, 0, 1, 0, 1, 4, 1, 4};
+        const std::vector<double> u = parameterize(pts.data(), 4, 2, Parameterization::Uniform);
+        assert(u[0] == 0.0 && std::abs(u[1] - 1.0 / 3) < 1e-15 && u[3] == 1.0);
+        const std::vector<double> c = parameterize(pts.data(), 4, 2, Parameterization::ChordLength);
+        assert(std::abs(c[1] - 0.2) < 1e-15 && c[2] == 1.0 && c[3] == 1.0);
+        const std::vector<double> q = parameterize(pts.data(), 4, 2, Parameterization::Centripetal);
+        assert(std::abs(q[1] - 1.0 / 3) < 1e-15 && q[2] == 1.0);
+        const std::vector<double> same = {2, 2, 2, 2, 2, 2};
+        const std::vector<double> s = parameterize(same.data(), 3, 2, Parameterization::ChordLength);
+        assert(s[1] == 0.5 && s[2] == 1.0);
+
+        // 平均法节点：每个内部节点区间都有数据参数
+        std::vector<double> params(100);
+        for (int k = 0; k < 100; ++k) params[k] = std::pow(k / 99.0, 2.0);
+        const std::vector<double> knots = approximationKnots(params, 20, 3);
+        assert(knots.size() == 24 && knots[3] == 0.0 && knots[20] == 1.0);
+        for (int j = 3; j < 20; ++j) {
+            assert(knots[j] < knots[j + 1]);
+            bool hit = false;
+            for (double t : params) hit = hit || (t >= knots[j] && t < knots[j + 1]);
+            assert(hit);
+        }
+    }
+
+    // 数据取自同节点的 B 样条时精确复原
+    {
+        const int p = 3, n = 12;
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<double> coord(-2.0, 2.0);
+        std::vector<double> cp(n * 3);
+        for (double& v : cp) v = coord(rng);
+        std::vector<double> knots = NURBS::clampedUniformKnots(n, p);
+        knots[5] = 0.3; // 非均匀
+        const NURBS truth(p, 3, cp, knots);
+        const int count = 401;
+        std::vector<double> pts(count * 3);
+        for (int k = 0; k < count; ++k) truth.evaluate(static_cast<double>(k) / (count - 1), &pts[k * 3]);
+
+        CurveFitOptions o;
+        o.parameterization = Parameterization::Uniform;
+        o.knots = knots;
+        for (bool ends : {true, false}) {
+            o.interpolateEnds = ends;
+            const CurveFitResult r = fitBSpline(pts.data(), count, 3, o);
+            assert(r.curve.numControlPoints() == n && r.iterations == 1 && r.maxError < 1e-10);
+            for (int i = 0; i < n; ++i)
+                for (int d = 0; d < 3; ++d) assert(std::abs(r.curve.homogeneousPoints()[i][d] - cp[i * 3 + d]) < 1e-9);
+        }
+    }
+
+    // 按容差插入节点：噪声正弦曲线
+    std::vector<Point2D> wave;
+    {
+        std::mt19937 rng(9);
+        std::normal_distribution<double> noise(0.0, 1e-4);
+        for (int k = 0; k < 50000; ++k) {
+            const double x = k * 1e-4;
+            wave.push_back(Point2D(x, std::sin(6.0 * x) + 0.5 * std::sin(17.0 * x) + noise(rng)));
+        }
+        CurveFitOptions o;
+        o.tolerance = 1e-3;
+        o.grainPoints = 4096;
+        const CurveFitResult r = fitBSpline(wave, o);
+        assert(r.maxError <= 1e-3 && r.iterations > 1 && r.rmsError <= r.maxError);
+        assert(r.curve.numControlPoints() < 1000);
+        const Point2D a = r.curve.evaluatePoint(r.curve.firstParam()), b = r.curve.evaluatePoint(r.curve.lastParam());
+        assert(a.x == wave.front().x && a.y == wave.front().y && b.x == wave.back().x && b.y == wave.back().y);
+        for (std::size_t k = 0; k < wave.size(); k += 997) {
+            const Point2D c = r.curve.evaluatePoint(r.params[k]);
+            assert(std::hypot(c.x - wave[k].x, c.y - wave[k].y) <= 1e-3 + 1e-12);
+        }
+
+        // 结果与线程数、分块大小无关
+        ThreadPool single(1), four(4);
+        CurveFitOptions o1 = o, o4 = o;
+        o1.pool = &single;
+        o4.pool = &four;
+        o4.grainPoints = 1000;
+        const CurveFitResult r1 = fitBSpline(wave, o1), r4 = fitBSpline(wave, o4);
+        assert(r1.curve.knots() == r.curve.knots() && r4.curve.knots() == r.curve.knots());
+        for (int i = 0; i < r.curve.numControlPoints(); ++i)
+            for (int d = 0; d < 2; ++d) {
+                assert(r1.curve.homogeneousPoints()[i][d] == r.curve.homogeneousPoints()[i][d]);
+                assert(std::abs(r4.curve.homogeneousPoints()[i][d] - r.curve.homogeneousPoints()[i][d]) < 1e-9);
+            }
+
+        // 控制点上限
+        CurveFitOptions capped = o;
+        capped.maxControlPoints = 12;
+        const CurveFitResult rc = fitBSpline(wave, capped);
+        assert(rc.curve.numControlPoints() <= 12 && rc.maxError > 1e-3);
+    }
+
+    // 三维螺旋
+    {
+        std::vector<Vec3d> helix;
+        for (int k = 0; k <= 2000; ++k) {
+            const double t = k * 0.01;
+            helix.push_back(Vec3d(std::cos(t), std::sin(t), 0.1 * t));
+        }
+        CurveFitOptions o;
+        o.tolerance = 1e-5;
+        const CurveFitResult r = fitBSpline(helix, o);
+        assert(r.maxError <= 1e-5 && r.curve.dimension() == 3);
+    }
+
+    // 非法参数
+    {
+        const std::vector<double> pts = {0, 0, 1, 1, 2, 0, 3, 1, 4, 0};
+        CurveFitOptions o;
+        auto rejects = [&](std::size_t count, int dim) {
+            try {
+                fitBSpline(pts.data(), count, dim, o);
+            } catch (const std::invalid_argument&) {
+                return true;
+            }
+            return false;
+        };
+        assert(!rejects(5, 2));
+        assert(rejects(3, 2));
+        assert(rejects(5, 4));
+        o.degree = 0;
+        assert(rejects(5, 2));
+        o.degree = 3;
+        o.numControlPoints = 6;
+        assert(rejects(5, 2));
+        o.numControlPoints = 0;
+        o.knots = {0, 0, 0, 1, 0.5, 1, 1, 1, 1};
+        assert(rejects(5, 2));
+        o.knots = {0, 0, 0, 0, 1, 1, 1};
+        assert(rejects(5, 2));
+    }
+
+    std::cout << "✅ Curve fitting test passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,139 @@
+#include "CurveInterpolation.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace GeoAlgo;
+
+static double dist(const Point2D& a, const Point2D& b) { return std::hypot(a.x - b.x, a.y - b.y); }
+
+int main() {
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<double> step(0.2, 1.0), jitter(-1.0, 1.0);
+
+    // 全局 B 样条插值：各次数、各参数化方式都经过数据点
+    std::vector<Point2D> pts;
+    {
+        double x = 0.0;
+        for (int k = 0; k < 5000; ++k) {
+            x += step(rng);
+            pts.push_back(Point2D(x, 3.0 * std::sin(0.1 * x) + jitter(rng)));
+        }
+        for (int p = 1; p <= 5; ++p)
+            for (Parameterization m : {Parameterization::Uniform, Parameterization::ChordLength, Parameterization::Centripetal}) {
+                const NURBS c = interpolateBSpline(pts, p, m);
+                assert(c.degree() == p && c.numControlPoints() == static_cast<int>(pts.size()));
+                assert(c.firstParam() == 0.0 && c.lastParam() == 1.0);
+                std::vector<double> raw;
+                for (const Point2D& q : pts) {
+                    raw.push_back(q.x);
+                    raw.push_back(q.y);
+                }
+                const std::vector<double> t = parameterize(raw.data(), pts.size(), 2, m);
+                for (std::size_t k = 0; k < pts.size(); k += 7) assert(dist(c.evaluatePoint(t[k]), pts[k]) < 1e-9);
+                assert(dist(c.evaluatePoint(1.0), pts.back()) < 1e-12);
+            }
+
+        // 三维与一维
+        std::vector<Vec3d> helix;
+        for (int k = 0; k <= 300; ++k) helix.push_back(Vec3d(std::cos(0.1 * k), std::sin(0.1 * k), 0.01 * k));
+        const NURBS h = interpolateBSpline(helix);
+        const Vec3d mid = h.evaluatePoint3D(0.5);
+        assert(std::abs(mid.x * mid.x + mid.y * mid.y - 1.0) < 1e-4);
+        const std::vector<double> ys = {0.0, 1.0, 4.0, 9.0, 16.0};
+        const NURBS f = interpolateBSpline(ys.data(), ys.size(), 1, 2, Parameterization::Uniform);
+        assert(std::abs(f.evaluate(0.25) - 1.0) < 1e-12 && std::abs(f.evaluate(0.75) - 9.0) < 1e-12);
+    }
+
+    // 批量插值与逐条结果一致，且与线程数无关
+    {
+        std::vector<std::vector<Point2D>> seqs;
+        for (int s = 0; s < 100; ++s) {
+            std::vector<Point2D> q;
+            for (int k = 0; k < 4 + s * 3; ++k) q.push_back(Point2D(k + 0.1 * jitter(rng), jitter(rng)));
+            seqs.push_back(q);
+        }
+        ThreadPool four(4);
+        const std::vector<NURBS> batch = interpolateBSplines(seqs, 3, Parameterization::Centripetal, four);
+        assert(batch.size() == seqs.size());
+        for (std::size_t s = 0; s < seqs.size(); s += 9) {
+            const NURBS one = interpolateBSpline(seqs[s]);
+            assert(one.knots() == batch[s].knots());
+            for (int i = 0; i < one.numControlPoints(); ++i)
+                assert(one.homogeneousPoints()[i] == batch[s].homogeneousPoints()[i]);
+        }
+        seqs[50].resize(2); // 点数不足，异常传到调用方
+        bool threw = false;
+        try { interpolateBSplines(seqs, 3, Parameterization::Centripetal, four); } catch (const std::invalid_argument&) { threw = true; }
+        assert(threw);
+    }
+
+    // Catmull-Rom 与自然三次样条：经过数据点、C1 连续
+    for (int variant = 0; variant < 2; ++variant) {
+        const std::vector<Point2D> q(pts.begin(), pts.begin() + 200);
+        const std::vector<BezierCurve> segs = variant == 0 ? catmullRomSegments(q) : cubicSplineSegments(q);
+        assert(segs.size() == q.size() - 1);
+        for (std::size_t i = 0; i < segs.size(); ++i) {
+            assert(segs[i].degree() == 3);
+            assert(segs[i].evaluate(0.0) == q[i] && segs[i].evaluate(1.0) == q[i + 1]);
+            if (i == 0) continue;
+            // 局部参数不同，切向方向一致
+            const Point2D a = segs[i - 1].derivative(1.0), b = segs[i].derivative(0.0);
+            assert(std::abs(a.x * b.y - a.y * b.x) <= 1e-9 * std::hypot(a.x, a.y) * std::hypot(b.x, b.y));
+        }
+    }
+
+    // 自然三次样条精确复现直线，两端二阶导数为 0；Catmull-Rom 精确复现抛物线
+    {
+        const std::vector<Point2D> line = {Point2D(0, 0), Point2D(1, 2), Point2D(3, 6), Point2D(3.5, 7)};
+        const std::vector<BezierCurve> s = cubicSplineSegments(line);
+        for (const BezierCurve& b : s) assert(dist(b.evaluate(0.5), (b.evaluate(0.0) + b.evaluate(1.0)) * 0.5) < 1e-12);
+
+        std::vector<Point2D> wave;
+        for (int k = 0; k < 20; ++k) wave.push_back(Point2D(k * 0.3, std::cos(k * 0.3)));
+        const std::vector<BezierCurve> n = cubicSplineSegments(wave);
+        assert(std::hypot(n.front().derivative(0.0, 2).x, n.front().derivative(0.0, 2).y) < 1e-10);
+        assert(std::hypot(n.back().derivative(1.0, 2).x, n.back().derivative(1.0, 2).y) < 1e-10);
+
+        std::vector<Point2D> parabola;
+        for (int k = 0; k < 6; ++k) parabola.push_back(Point2D(k, k * k));
+        const std::vector<BezierCurve> c = catmullRomSegments(parabola, Parameterization::Uniform);
+        for (std::size_t i = 0; i < c.size(); ++i) {
+            const Point2D m = c[i].evaluate(0.5);
+            assert(std::abs(m.x - (i + 0.5)) < 1e-12 && std::abs(m.y - (i + 0.5) * (i + 0.5)) < 1e-12);
+        }
+    }
+
+    // Hermite：给定切向
+    {
+        const std::vector<BezierCurve> h =
+            hermiteSegments({Point2D(0, 0), Point2D(2, 0)}, {Point2D(0, 1), Point2D(0, -1)}, {0.0, 3.0});
+        assert(h.size() == 1 && h[0].controlPoints()[1] == Point2D(0, 1) && h[0].controlPoints()[2] == Point2D(2, 1));
+        assert(dist(h[0].derivative(0.0), Point2D(0, 3)) < 1e-15);
+    }
+
+    // 非法输入
+    {
+        bool threw = false;
+        try { interpolateBSpline(std::vector<Point2D>{Point2D(0, 0), Point2D(1, 1), Point2D(1, 1), Point2D(2, 0)}); }
+        catch (const std::invalid_argument&) { threw = true; }
+        assert(threw);
+        threw = false;
+        try { interpolateBSpline(std::vector<Point2D>{Point2D(0, 0), Point2D(1, 1)}, 2); }
+        catch (const std::invalid_argument&) { threw = true; }
+        assert(threw);
+        threw = false;
+        try { catmullRomSegments({Point2D(0, 0)}); } catch (const std::invalid_argument&) { threw = true; }
+        assert(threw);
+        threw = false;
+        try { hermiteSegments({Point2D(0, 0), Point2D(1, 0)}, {Point2D(1, 0)}, {0.0, 1.0}); }
+        catch (const std::invalid_argument&) { threw = true; }
+        assert(threw);
+    }
+
+    std::cout << "✅ Curve interpolation test passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include "CurveIntersector.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace GeoAlgo;
+
+// 折线逼近下的交点个数，作为参照
+static int polylineCrossings(const BezierCurve& a, const BezierCurve& b, int N) {
+    std::vector<Point2D> pa(N + 1), pb(N + 1);
+    for (int i = 0; i <= N; ++i) {
+        pa[i] = a.evaluate(double(i) / N);
+        pb[i] = b.evaluate(double(i) / N);
+    }
+    auto cross = [](const Point2D& u, const Point2D& v) { return u.x * v.y - u.y * v.x; };
+    int count = 0;
+    for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < N; ++j) {
+            const Point2D r = pa[i + 1] - pa[i];
+            const Point2D q = pb[j + 1] - pb[j];
+            const double d = cross(r, q);
+            if (d == 0.0) continue;
+            const double s = cross(pb[j] - pa[i], q) / d;
+            const double t = cross(pb[j] - pa[i], r) / d;
+            if (s >= 0.0 && s < 1.0 && t >= 0.0 && t < 1.0) ++count;
+        }
+    }
+    return count;
+}
+
+int main() {
+    CurveIntersector isect;
+
+    // 曲线与线段：y(u) = 6u(1-u)(1-2u)，x(u) = 3u，与 x 轴交于 u = 0, 0.5, 1
+    BezierCurve wave({Point2D(0, 0), Point2D(1, 2), Point2D(2, -2), Point2D(3, 0)});
+    std::vector<CurveIntersector::LineHit> lh;
+    isect.intersect(wave, Point2D(-1, 0), Point2D(4, 0), lh);
+    assert(lh.size() == 3);
+    const double roots[3] = {0.0, 0.5, 1.0};
+    for (int i = 0; i < 3; ++i) {
+        assert(std::fabs(lh[i].t - roots[i]) < 1e-10);
+        assert(std::fabs(lh[i].s - (3.0 * roots[i] + 1.0) / 5.0) < 1e-10);
+        assert(std::fabs(lh[i].point.y) < 1e-9);
+    }
+    lh.clear();
+    isect.intersect(wave, Point2D(-1, 0), Point2D(1, 0), lh); // 线段只覆盖第一个交点
+    assert(lh.size() == 1 && lh[0].t < 1e-10);
+
+    // 抛物线 y = 4u(1-u) 与直线 y = 0.5：u = (1 ± √0.5)/2
+    BezierCurve arch({Point2D(0, 0), Point2D(1, 2), Point2D(2, 0)});
+    std::vector<CurveIntersector::Hit> hits;
+    isect.intersect(arch, BezierCurve({Point2D(0, 0.5), Point2D(2, 0.5)}), hits);
+    assert(hits.size() == 2);
+    const double r = std::sqrt(0.5);
+    assert(std::fabs(hits[0].tA - (1 - r) / 2) < 1e-9 && std::fabs(hits[1].tA - (1 + r) / 2) < 1e-9);
+    assert(std::fabs(hits[0].tB - hits[0].tA) < 1e-9 && std::fabs(hits[1].tB - hits[1].tA) < 1e-9);
+
+    // 相切：顶点 (1,1) 与直线 y = 1 相切，只报告一个交点
+    hits.clear();
+    isect.intersect(arch, BezierCurve({Point2D(0, 1), Point2D(2, 1)}), hits);
+    assert(hits.size() == 1 && hits[0].point.distanceTo(Point2D(1, 1)) < 1e-4);
+    hits.clear();
+    isect.intersect(arch, BezierCurve({Point2D(0, 1.01), Point2D(2, 1.01)}), hits);
+    assert(hits.empty());
+
+    // 共线重叠：报告重叠区间端点
+    hits.clear();
+    isect.intersect(BezierCurve({Point2D(0, 0), Point2D(2, 0)}), BezierCurve({Point2D(1, 0), Point2D(3, 0)}), hits);
+    assert(hits.size() == 2);
+    assert(hits[0].point.distanceTo(Point2D(1, 0)) < 1e-12 && hits[1].point.distanceTo(Point2D(2, 0)) < 1e-12);
+
+    // 随机三次曲线：全部两两求交与逐对求交一致，且与折线逼近的交点数一致
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> pos(0.0, 20.0);
+    std::uniform_real_distribution<double> off(-4.0, 4.0);
+    std::vector<BezierCurve> curves;
+    for (int c = 0; c < 80; ++c) {
+        const Point2D base(pos(rng), pos(rng));
+        std::vector<Point2D> pts;
+        for (int i = 0; i < 4; ++i) pts.push_back(base + Point2D(off(rng), off(rng)));
+        curves.emplace_back(pts);
+    }
+    ThreadPool pool1(1), pool4(4);
+    const std::vector<CurveIntersector::Hit> all = isect.intersectAll(curves.data(), curves.size(), pool4);
+    const std::vector<CurveIntersector::Hit> all1 = isect.intersectAll(curves.data(), curves.size(), pool1);
+    assert(all.size() == all1.size() && !all.empty());
+    std::size_t k = 0;
+    int checkedPairs = 0;
+    for (int i = 0; i < 80; ++i) {
+        for (int j = i + 1; j < 80; ++j) {
+            std::vector<CurveIntersector::Hit> pair;
+            isect.intersect(curves[i], curves[j], pair);
+            for (const CurveIntersector::Hit& h : pair) {
+                assert(k < all.size());
+                assert(all[k].curveA == i && all[k].curveB == j);
+                assert(all[k].tA == h.tA && all[k].tB == h.tB);
+                assert(all1[k].tA == h.tA && all1[k].tB == h.tB);
+                assert(curves[i].evaluate(h.tA).distanceTo(curves[j].evaluate(h.tB)) <= 1e-9);
+                ++k;
+            }
+            if (!pair.empty() && checkedPairs < 40) {
+                assert(static_cast<int>(pair.size()) == polylineCrossings(curves[i], curves[j], 600));
+                ++checkedPairs;
+            }
+        }
+    }
+    assert(k == all.size());
+
+    // 幂基曲线：P(u) = (u, u^2) 与 (u, 1 - u) 交于 x = (√5 - 1)/2
+    std::vector<PowerBasisCurve> pb{PowerBasisCurve({Point2D(0, 0), Point2D(1, 0), Point2D(0, 1)}),
+                                    PowerBasisCurve({Point2D(0, 1), Point2D(1, -1)})};
+    const std::vector<CurveIntersector::Hit> ph = isect.intersectAll(pb.data(), pb.size(), pool4);
+    assert(ph.size() == 1 && std::fabs(ph[0].point.x - (std::sqrt(5.0) - 1) / 2) < 1e-9);
+
+    std::cout << "✅ Curve intersection test passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include "BezierCurveN.h"
+#include "PowerBasisCurveN.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+using namespace GeoAlgo;
+
+// 编译期求值
+constexpr CubicBezier2D kCubic(CubicBezier2D::ControlPoints{{{0, 0}, {1, 2}, {3, 3}, {4, 0}}});
+static_assert(kCubic.evaluate(0.0) == Point2D(0, 0), "P(0) = P0");
+static_assert(kCubic.evaluate(1.0) == Point2D(4, 0), "P(1) = P3");
+static_assert(kCubic.evaluate(0.5).x == 2.0, "symmetric x at u = 0.5");
+static_assert(detail::kBinomialRow<4>[2] == 6.0, "C(4,2) = 6");
+
+constexpr QuadraticPowerBasis2D kQuad(QuadraticPowerBasis2D::Coefficients{{{1, 2}, {1, -1}, {1, 0}}});
+static_assert(kQuad.evaluate(2.0) == Point2D(7, 0), "x = 1+t+t^2, y = 2-t");
+
+int main() {
+    // 与动态 BezierCurve 一致
+    BezierCurve dyn({{0, 0}, {1, 2}, {3, 3}, {4, 0}});
+    CubicBezier2D fixed(dyn);
+    BezierCurve back = fixed.toDynamic();
+    for (int k = 0; k <= 50; ++k) {
+        double u = k / 50.0;
+        Point2D p = fixed.evaluate(u);
+        Point2D q = dyn.evaluate(u);
+        assert(p.distanceTo(q) < 1e-14);
+        assert(back.evaluate(u).distanceTo(q) == 0.0);
+    }
+
+    bool threw = false;
+    try {
+        QuadraticBezier2D wrong(dyn);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // 与动态幂基曲线一致，低次动态曲线补零
+    PowerBasisCurve2D c2({1.0, 1.0, 1.0}, {2.0, -1.0});
+    CubicPowerBasis2D p2(c2);
+    PowerBasisCurve3D c3({0.0, 1.0}, {0.0, 0.0, 1.0}, {1.0, 0.0, 0.0, -2.0});
+    CubicPowerBasis3D p3(c3);
+    PowerBasisCurve1D c1({1.0, -2.0, 0.5});
+    PowerBasisCurveN<2, 1> p1(c1);
+    for (int k = 0; k <= 50; ++k) {
+        double t = -1.0 + k / 25.0;
+        assert(c2.evaluate(t).distanceTo(p2.evaluate(t)) < 1e-14);
+        Vec3d d = p3.evaluate(t);
+        assert(c3.evaluate(t).distanceTo(d) < 1e-14);
+        assert(std::fabs(c1.evaluate(t) - p1.evaluate(t).x) < 1e-14);
+        assert(std::fabs(p3.component(1).evaluate(t) - d.y) < 1e-14);
+    }
+
+    PowerBasisCurve pb({{0, 0}, {1, 2}, {0.5, 0.5}});
+    QuadraticPowerBasis2D q2(pb);
+    assert(q2.toDynamic().evaluate(0.5).distanceTo(pb.evaluate(0.5)) == 0.0);
+
+    std::cout << "✅ BezierCurveN / PowerBasisCurveN test passed!" << std::endl;
+    return 0;
+}
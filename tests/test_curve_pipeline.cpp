@@ -0,0 +1,284 @@
+#include "CurvePipeline.h"
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace GeoAlgo;
+
+namespace {
+
+// 收集全部输出，检查块按顺序到达
+struct Collected {
+    std::vector<std::vector<Vec3d>> points;
+    std::vector<std::vector<double>> params;
+    std::size_t chunks = 0;
+};
+
+CallbackPointSink collector(Collected& c) {
+    return CallbackPointSink([&c](const PointChunk& chunk) {
+        assert(chunk.firstCurve == c.points.size());
+        ++c.chunks;
+        for (std::size_t i = 0; i < chunk.numCurves(); ++i) {
+            c.points.emplace_back(chunk.points.begin() + chunk.offsets[i], chunk.points.begin() + chunk.offsets[i + 1]);
+            c.params.emplace_back(chunk.params.begin() + chunk.offsets[i], chunk.params.begin() + chunk.offsets[i + 1]);
+        }
+    });
+}
+
+template <typename F>
+bool throws(F f) {
+    try {
+        f();
+    } catch (const std::exception&) {
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+int main() {
+    const char* path = "test_curve_pipeline.gcf";
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> coord(-2.0, 2.0);
+    std::uniform_real_distribution<double> weight(0.5, 2.0);
+
+    // 混合类型的曲线文件
+    const std::size_t numCurves = 300;
+    {
+        CurveFileWriter w(path);
+        for (std::size_t i = 0; i < numCurves; ++i) {
+            switch (i % 4) {
+            case 0: {
+                std::vector<Point2D> p;
+                for (int k = 0; k < 4; ++k) p.push_back(Point2D(coord(rng), coord(rng)));
+                w.add(BezierCurve(p));
+                break;
+            }
+            case 1: {
+                std::vector<Vec3d> p;
+                std::vector<double> ws;
+                for (int k = 0; k < 3; ++k) {
+                    p.push_back(Vec3d(coord(rng), coord(rng), coord(rng)));
+                    ws.push_back(weight(rng));
+                }
+                w.add(RationalBezierCurve(p, ws));
+                break;
+            }
+            case 2:
+                w.add(PowerBasisCurve3D({coord(rng), coord(rng), coord(rng)}, {coord(rng), coord(rng)},
+                                        {coord(rng), coord(rng), coord(rng), coord(rng)}));
+                break;
+            default: {
+                std::vector<double> cp;
+                for (int k = 0; k < 7 * 3; ++k) cp.push_back(coord(rng));
+                std::vector<double> ws;
+                for (int k = 0; k < 7; ++k) ws.push_back(weight(rng));
+                w.add(NURBS(3, 3, cp, NURBS::clampedUniformKnots(7, 3), ws));
+                break;
+            }
+            }
+        }
+    }
+    const CurveFile file(path);
+    assert(file.size() == numCurves);
+
+    // 求值模式：与逐条直接求值一致，块按输入顺序
+    {
+        CurvePipelineOptions opts;
+        opts.chunkCurves = 64;
+        opts.samplesPerCurve = 17;
+        opts.grainCurves = 5;
+        CurveFileSource source(file);
+        Collected c;
+        CallbackPointSink sink = collector(c);
+        const PipelineStats stats = CurvePipeline(opts).run(source, sink);
+        assert(stats.curves == numCurves && stats.points == numCurves * 17);
+        assert(stats.chunks == (numCurves + 63) / 64 && c.chunks == stats.chunks);
+        assert(stats.bufferBytes > 0 && stats.truncatedCurves == 0);
+        assert(!stats.toText().empty());
+        for (std::size_t i = 0; i < numCurves; ++i) {
+            const CurveFile::Record r = file.record(i);
+            assert(c.points[i].size() == 17);
+            assert(c.params[i].front() == r.firstParam() && c.params[i].back() == r.lastParam());
+            for (std::size_t k = 0; k < 17; ++k)
+                assert((c.points[i][k] - file.evaluate(i, c.params[i][k])).norm() < 1e-12);
+        }
+
+        // 子范围：下标从 0 重新编号
+        CurveFileSource part(file, 250, 1000);
+        Collected d;
+        CallbackPointSink partSink = collector(d);
+        assert(CurvePipeline(opts).run(part, partSink).curves == 50);
+        assert(d.points[0] == c.points[250]);
+    }
+
+    // 离散模式：与直接调用离散器一致，结果与线程数和分块无关
+    {
+        CurvePipelineOptions opts;
+        opts.mode = CurvePipelineOptions::Mode::Tessellate;
+        opts.tolerance = 1e-3;
+        opts.chunkCurves = 50;
+        ThreadPool single(1);
+        opts.pool = &single;
+        CurveFileSource source(file);
+        Collected a;
+        CallbackPointSink sinkA = collector(a);
+        CurvePipeline(opts).run(source, sinkA);
+
+        opts.pool = nullptr;
+        opts.chunkCurves = 7;
+        opts.grainCurves = 1;
+        CurveFileSource again(file);
+        Collected b;
+        CallbackPointSink sinkB = collector(b);
+        CurvePipeline(opts).run(again, sinkB);
+        assert(a.points == b.points && a.params == b.params);
+
+        const AdaptiveTessellator tess(1e-3);
+        const RationalBezierCurve rb = file.rationalBezier(1);
+        std::vector<Vec3d> direct(1024);
+        const std::size_t n = tess.tessellateHomogeneous<3>(rb.homogeneousPoints().data(), rb.degree(), direct.data(),
+                                                            direct.size());
+        direct.resize(n);
+        assert(a.points[1].size() == n);
+        for (std::size_t k = 0; k < n; ++k) assert((a.points[1][k] - direct[k]).norm() < 1e-12);
+
+        // 离散点都在曲线上，B 样条跨段参数单调
+        for (std::size_t i = 0; i < numCurves; ++i) {
+            assert(a.points[i].size() >= 2);
+            for (std::size_t k = 0; k < a.points[i].size(); ++k) {
+                assert((a.points[i][k] - file.evaluate(i, a.params[i][k])).norm() < 1e-9);
+                if (k) assert(a.params[i][k] > a.params[i][k - 1]);
+            }
+        }
+
+        // 点数上限：超出的曲线改为覆盖整个定义域的等距采样并计数
+        opts.maxPointsPerCurve = 4;
+        opts.tolerance = 1e-9;
+        CurveFileSource capped(file, 0, 40);
+        Collected t;
+        CallbackPointSink sinkT = collector(t);
+        const PipelineStats stats = CurvePipeline(opts).run(capped, sinkT);
+        assert(stats.truncatedCurves == 40);
+        for (std::size_t i = 0; i < 40; ++i) {
+            const CurveFile::Record r = file.record(i);
+            assert(t.points[i].size() == 4);
+            assert(t.params[i].front() == r.firstParam() && t.params[i].back() == r.lastParam());
+            for (std::size_t k = 0; k < 4; ++k)
+                assert((t.points[i][k] - file.evaluate(i, t.params[i][k])).norm() < 1e-9);
+        }
+    }
+
+    // 文本来源：与曲线对象的求值一致
+    {
+        std::istringstream text(
+            "# comment\n"
+            "bezier 2 2  0 0  1 2  2 0\n"
+            "\n"
+            "rbezier 2 2  1 0 1  1 1 0.70710678118654752  0 1 1\n"
+            "power 1 2  1  -2  3\n"
+            "bspline 2 2 4  0 0  1 2  2 0  3 1  0 0 0 0.5 1 1 1\n"
+            "nurbs 1 1 2  0 1  4 3  0 0 1 1\n");
+        CurveTextSource source(text);
+        CurvePipelineOptions opts;
+        opts.chunkCurves = 2;
+        opts.samplesPerCurve = 5;
+        Collected c;
+        CallbackPointSink sink = collector(c);
+        const PipelineStats stats = CurvePipeline(opts).run(source, sink);
+        assert(stats.curves == 5 && stats.chunks == 3);
+
+        const BezierCurve bezier({Point2D(0, 0), Point2D(1, 2), Point2D(2, 0)});
+        for (std::size_t k = 0; k < 5; ++k) {
+            const Point2D p = bezier.evaluate(c.params[0][k]);
+            assert((c.points[0][k] - Vec3d(p.x, p.y, 0.0)).norm() < 1e-14);
+            // 四分之一圆
+            assert(std::abs(c.points[1][k].norm() - 1.0) < 1e-12);
+            const double t = c.params[2][k];
+            assert(std::abs(c.points[2][k].x - (1 - 2 * t + 3 * t * t)) < 1e-14);
+        }
+        const NURBS spline(2, {Point2D(0, 0), Point2D(1, 2), Point2D(2, 0), Point2D(3, 1)}, {0, 0, 0, 0.5, 1, 1, 1});
+        for (std::size_t k = 0; k < 5; ++k)
+            assert((c.points[3][k] - spline.evaluatePoint3D(c.params[3][k])).norm() < 1e-13);
+        // 有理一次：x(u) = 12u / (1 + 2u)
+        assert(std::abs(c.points[4][2].x - 3.0) < 1e-14);
+
+        // 文本输出
+        std::istringstream again("power 1 1  1 1\n");
+        CurveTextSource one(again);
+        opts.samplesPerCurve = 2;
+        std::ostringstream out;
+        TextPointSink textSink(out);
+        CurvePipeline(opts).run(one, textSink);
+        assert(out.str() == "0 0 1\n0 1 2\n");
+    }
+
+    // 错误：解析错误带行号，写出端异常在 run() 中重新抛出
+    {
+        const char* bad[] = {"spline 2 1 0 0 1 1\n", "bezier 2 1 0 0 1\n", "rbezier 1 1 0 1 1 -1\n",
+                             "bspline 1 1 2 0 1 0 1 0 1\n", "bezier 2 1 0 0 1 x\n", "bezier 4 1 0 0 0 0 1 1 1 1\n",
+                             "bezier 2 1 0 nan 1 1\n", "power 1 1 inf 1\n"};
+        for (const char* s : bad) {
+            std::istringstream text(std::string("\n") + s);
+            CurveTextSource source(text);
+            Collected c;
+            CallbackPointSink sink = collector(c);
+            try {
+                CurvePipeline().run(source, sink);
+                assert(false);
+            } catch (const std::runtime_error& e) {
+                assert(std::string(e.what()).find("line 2") != std::string::npos);
+            }
+        }
+
+        CurvePipelineOptions opts;
+        opts.chunkCurves = 10;
+        CurveFileSource source(file);
+        std::size_t written = 0;
+        CallbackPointSink failing([&](const PointChunk&) {
+            if (++written == 3) throw std::runtime_error("disk full");
+        });
+        try {
+            CurvePipeline(opts).run(source, failing);
+            assert(false);
+        } catch (const std::runtime_error& e) {
+            assert(std::string(e.what()) == "disk full");
+        }
+        assert(written == 3);
+
+        opts.chunkCurves = 0;
+        assert(throws([&] { CurvePipeline p(opts); }));
+        opts.chunkCurves = 10;
+        opts.chunkBytes = 0;
+        assert(throws([&] { CurvePipeline p(opts); }));
+    }
+
+    // 每块曲线数受 chunkBytes 约束：默认离散模式的单个输出块不超过 16 MiB
+    {
+        CurvePipelineOptions opts;
+        assert(CurvePipeline(opts).chunkCurves() == opts.chunkCurves);
+        opts.mode = CurvePipelineOptions::Mode::Tessellate;
+        const std::size_t n = CurvePipeline(opts).chunkCurves();
+        assert(n > 0 && n < opts.chunkCurves);
+        assert(n * opts.maxPointsPerCurve * (sizeof(Vec3d) + sizeof(double)) <= opts.chunkBytes);
+        opts.chunkBytes = 1;
+        assert(CurvePipeline(opts).chunkCurves() == 1);
+
+        opts.chunkBytes = 10 * opts.maxPointsPerCurve * (sizeof(Vec3d) + sizeof(double));
+        CurveFileSource source(file);
+        Collected c;
+        CallbackPointSink sink = collector(c);
+        const PipelineStats stats = CurvePipeline(opts).run(source, sink);
+        assert(stats.curves == numCurves && stats.chunks == (numCurves + 9) / 10);
+    }
+
+    std::remove(path);
+    std::cout << "✅ Curve pipeline test passed!" << std::endl;
+    return 0;
+}
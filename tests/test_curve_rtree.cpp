@@ -0,0 +1,136 @@
+#include "CurveBounds.h"
+#include "CurveRTree.h"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace GeoAlgo;
+
+int main() {
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<double> pos(0.0, 1000.0);
+    std::uniform_real_distribution<double> off(-6.0, 6.0);
+
+    CurveRTree none;
+    std::vector<int> hits;
+    assert(none.size() == 0 && none.height() == 0);
+    assert(none.query(Box2D(Point2D(0, 0), Point2D(1, 1)), hits) == 0);
+    assert(none.nearest(Point2D(0, 0), 3).empty());
+
+    const int n = 800;
+    std::vector<BezierCurve> curves;
+    for (int c = 0; c < n; ++c) {
+        const Point2D base(pos(rng), pos(rng));
+        std::vector<Point2D> pts;
+        for (int i = 0; i <= 3; ++i) pts.push_back(base + Point2D(off(rng), off(rng)));
+        curves.emplace_back(pts);
+    }
+
+    ThreadPool single(1);
+    const CurveRTree tree(curves);
+    const CurveRTree serial(curves, single);
+    assert(tree.size() == static_cast<std::size_t>(n));
+    // 800 条目、每节点 16 个：50 → 4 → 1
+    assert(tree.height() == 3);
+    for (int c = 0; c < n; ++c) {
+        const Box2D b = exactBounds(curves[c]);
+        assert(tree.box(c).lo == b.lo && tree.box(c).hi == b.hi);
+        assert(tree.bounds().contains(b.lo) && tree.bounds().contains(b.hi));
+    }
+
+    // 窗口查询与暴力结果一致，且与线程数无关
+    std::vector<Box2D> windows;
+    for (int i = 0; i < 200; ++i) {
+        const Point2D a(pos(rng), pos(rng));
+        windows.emplace_back(a, a + Point2D(std::abs(off(rng)) * 10, std::abs(off(rng)) * 10));
+    }
+    windows.emplace_back(Point2D(-1e9, -1e9), Point2D(1e9, 1e9));
+    for (const Box2D& w : windows) {
+        std::vector<int> got, again;
+        tree.query(w, got);
+        serial.query(w, again);
+        assert(got == again);
+        std::sort(got.begin(), got.end());
+        std::vector<int> brute;
+        for (int c = 0; c < n; ++c)
+            if (tree.box(c).overlaps(w)) brute.push_back(c);
+        assert(got == brute);
+    }
+
+    // 最近邻：包围盒距离与曲线距离（采样近似）两种模式
+    auto curveDistance = [&](int id, const Point2D& q) {
+        double best = 1e300;
+        for (int i = 0; i <= 200; ++i) best = std::min(best, curves[id].evaluate(i / 200.0).distanceTo(q));
+        return best;
+    };
+    for (int i = 0; i < 50; ++i) {
+        const Point2D q(pos(rng), pos(rng));
+        const std::vector<CurveRTree::Neighbor> nb = tree.nearest(q, 5);
+        assert(nb.size() == 5);
+        std::vector<std::pair<double, int>> brute;
+        for (int c = 0; c < n; ++c) brute.emplace_back(std::sqrt(tree.box(c).squaredDistanceTo(q)), c);
+        std::sort(brute.begin(), brute.end());
+        for (int k = 0; k < 5; ++k) assert(nb[k].id == brute[k].second && nb[k].distance == brute[k].first);
+
+        std::atomic<int> calls{0};
+        const std::vector<CurveRTree::Neighbor> exact = tree.nearest(q, 3, [&](int id, const Point2D& p) {
+            ++calls;
+            return curveDistance(id, p);
+        });
+        std::vector<std::pair<double, int>> bruteExact;
+        for (int c = 0; c < n; ++c) bruteExact.emplace_back(curveDistance(c, q), c);
+        std::sort(bruteExact.begin(), bruteExact.end());
+        for (int k = 0; k < 3; ++k) assert(exact[k].id == bruteExact[k].second);
+        // 只对少量候选计算曲线距离
+        assert(calls < n / 20);
+    }
+    assert(tree.nearest(Point2D(0, 0), 2 * n).size() == static_cast<std::size_t>(n));
+
+    // 并发查询：结果与串行一致
+    std::vector<std::size_t> counts(windows.size());
+    ThreadPool::shared().parallelFor(windows.size(), [&](std::size_t i) {
+        std::vector<int> local;
+        counts[i] = tree.query(windows[i], local);
+    });
+    for (std::size_t i = 0; i < windows.size(); ++i) {
+        std::vector<int> local;
+        assert(counts[i] == tree.query(windows[i], local));
+    }
+
+    // 其他曲线类型与直接给定的包围盒
+    std::vector<NURBS> splines;
+    for (int c = 0; c < 100; ++c) {
+        std::vector<Point2D> pts;
+        for (int i = 0; i < 6; ++i) pts.push_back(Point2D(pos(rng), pos(rng)));
+        splines.emplace_back(3, pts, NURBS::clampedUniformKnots(6, 3));
+    }
+    const CurveRTree splineTree(splines);
+    std::vector<int> all;
+    assert(splineTree.query(splineTree.bounds(), all) == splines.size());
+    const CurveRTree boxTree(std::vector<Box2D>{Box2D(Point2D(0, 0), Point2D(1, 1)), Box2D(Point2D(5, 5), Point2D(6, 6))});
+    assert(boxTree.height() == 1 && boxTree.nearest(Point2D(4, 4))[0].id == 1);
+
+    // 空包围盒不进入树，含 NaN 的包围盒被拒绝
+    const CurveRTree sparse(std::vector<Box2D>{Box2D(), Box2D(Point2D(2, 2), Point2D(3, 3)), Box2D()});
+    std::vector<int> found;
+    assert(sparse.size() == 3 && sparse.query(Box2D(Point2D(-1e9, -1e9), Point2D(1e9, 1e9)), found) == 1);
+    assert(found[0] == 1 && sparse.nearest(Point2D(0, 0), 3).size() == 1);
+    assert(CurveRTree(std::vector<Box2D>(5)).height() == 0);
+    Box2D bad(Point2D(0, 0), Point2D(1, 1));
+    bad.hi.x = std::nan("");
+    bool threw = false;
+    try {
+        CurveRTree(std::vector<Box2D>{bad});
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "✅ Curve R-tree test passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include "CurveBatch.h"
+#include "CurveStore.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace GeoAlgo;
+
+int main() {
+    // 不同次数、不同类型的曲线混合存放
+    std::vector<BezierCurve> beziers = {
+        BezierCurve({{0, 0}, {1, 2}, {3, 3}, {4, 0}}),
+        BezierCurve({{0, 0}, {1, 1}}),
+        BezierCurve({{1, 1}, {2, 5}, {3, -1}, {4, 2}, {6, 0}, {7, 7}}),
+    };
+    PowerBasisCurve pb({{0, 0}, {1, 2}, {0.5, 0.5}});
+    PowerBasisCurve2D pb2({1.0, 1.0, 1.0}, {2.0, -1.0});
+
+    CurveStore2D store;
+    store.reserve(8, 32);
+    for (const auto& b : beziers) store.append(b);
+    std::size_t ipb = store.append(pb);
+    std::size_t ipb2 = store.append(pb2);
+    assert(store.size() == 5);
+    assert(store.pointCount() == 4 + 2 + 6 + 3 + 3);
+    assert(store[2].degree() == 5 && store[2].kind() == CurveKind::Bezier);
+    assert(store[ipb].kind() == CurveKind::PowerBasis);
+    assert(store[0].point(1) == Point2D(1, 2));
+
+    const std::size_t N = 33;
+    std::vector<double> us(N);
+    for (std::size_t k = 0; k < N; ++k) us[k] = static_cast<double>(k) / (N - 1);
+
+    for (std::size_t c = 0; c < beziers.size(); ++c)
+        for (double u : us) assert(store[c].evaluate(u).distanceTo(beziers[c].evaluate(u)) < 1e-13);
+    for (double u : us) {
+        assert(store.evaluate(ipb, u).distanceTo(pb.evaluate(u)) < 1e-14);
+        assert(store.evaluate(ipb2, u).distanceTo(pb2.evaluate(u)) < 1e-14);
+    }
+
+    // SoA 输出：有 / 无 SoA 副本结果一致
+    std::vector<double> xs(N), ys(N), xs2(N), ys2(N);
+    double* outs[2] = {xs.data(), ys.data()};
+    double* outs2[2] = {xs2.data(), ys2.data()};
+    store.evaluateMany(ipb2, us.data(), N, outs);
+    store.buildSoA();
+    assert(store.hasSoA());
+    store.evaluateMany(ipb2, us.data(), N, outs2);
+    for (std::size_t k = 0; k < N; ++k)
+        assert(std::fabs(xs[k] - xs2[k]) < 1e-14 && std::fabs(ys[k] - ys2[k]) < 1e-14);
+    store.append(pb);
+    assert(!store.hasSoA());
+
+    // 批量载入 CSR 数据，再交给 CurveBatch 并行求值
+    CurveStore3D store3;
+    std::vector<double> coords = {0, 0, 0, 1, 1, 1, 2, 0, 1,   // 二次 Bezier
+                                  1, 0, 0, 0, 1, 0};           // 一次幂基
+    std::vector<std::size_t> offsets = {0, 3, 5};
+    std::vector<CurveKind> kinds = {CurveKind::Bezier, CurveKind::PowerBasis};
+    store3.bulkLoad(coords.data(), offsets.data(), 2, kinds.data());
+    assert(store3.size() == 2 && store3.degree(0) == 2 && store3.degree(1) == 1);
+    assert(store3.evaluate(0, 0.5) == Vec3d(1, 0.5, 0.75));
+    assert(store3.evaluate(1, 2.0) == Vec3d(1, 2, 0));
+
+    CurveBatch batch(3, 5);
+    std::vector<Point2D> all(store.size() * N);
+    batch.evaluate(store, us.data(), N, all.data());
+    for (std::size_t c = 0; c < store.size(); ++c)
+        for (std::size_t k = 0; k < N; ++k) assert(all[c * N + k] == store.evaluate(c, us[k]));
+
+    std::cout << "✅ CurveStore test passed!" << std::endl;
+    return 0;
+}
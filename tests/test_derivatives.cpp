@@ -0,0 +1,120 @@
+#include "PowerBasisCurve1D.h"
+#include "PowerBasisCurve2D.h"
+#include "PowerBasisCurve3D.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+static bool close(double a, double b) {
+    return std::fabs(a - b) <= 1e-11 * (1.0 + std::fabs(b));
+}
+
+int main() {
+    // 与逐次构造导数多项式的结果比较
+    PowerBasisCurve1D f({1.0, -2.0, 0.5, 3.0, -1.25, 0.75});
+    const int K = 7; // 超过次数的导数为 0
+    for (double t : {-1.5, -0.3, 0.0, 0.4, 1.0, 2.2}) {
+        double d[K + 1];
+        f.evaluateDerivatives(t, K, d);
+        PowerBasisCurve1D g = f;
+        for (int j = 0; j <= K; ++j) {
+            assert(close(d[j], g.evaluate(t)));
+            g = g.derivative();
+        }
+        assert(d[6] == 0.0 && d[7] == 0.0);
+        assert(close(f.evaluateDerivative(t), f.derivative().evaluate(t)));
+        assert(close(f.evaluateSecondDerivative(t), f.secondDerivative().evaluate(t)));
+    }
+
+    PowerBasisCurve2D c2({1.0, 1.0, 1.0}, {2.0, -1.0, 0.0, 0.3});
+    PowerBasisCurve3D c3({0.0, 1.0}, {0.0, 0.0, 1.0}, {1.0, 0.0, 0.0, -2.0});
+    for (double t : {-1.0, 0.25, 2.0}) {
+        GeoAlgo::Vec2d d2[4];
+        c2.evaluateDerivatives(t, 3, d2);
+        assert(d2[0] == c2.evaluate(t));
+        assert(close(d2[1].x, 1.0 + 2.0 * t) && close(d2[1].y, -1.0 + 0.9 * t * t));
+        assert(close(d2[2].x, 2.0) && close(d2[2].y, 1.8 * t));
+        assert(close(d2[3].x, 0.0) && close(d2[3].y, 1.8));
+        assert(c2.derivative(t) == d2[1] && c2.secondDerivative(t) == d2[2]);
+
+        GeoAlgo::Vec3d d3[3];
+        c3.evaluateDerivatives(t, 2, d3);
+        assert(close(d3[1].x, 1.0) && close(d3[1].y, 2.0 * t) && close(d3[1].z, -6.0 * t * t));
+        assert(close(d3[2].x, 0.0) && close(d3[2].y, 2.0) && close(d3[2].z, -12.0 * t));
+    }
+
+    // 批量：位置、速度、加速度
+    const std::size_t N = 37;
+    std::vector<double> ts(N);
+    for (std::size_t i = 0; i < N; ++i) ts[i] = -1.0 + 3.0 * i / (N - 1);
+    std::vector<std::vector<double>> buf(9, std::vector<double>(N));
+    double* outs[9];
+    for (int i = 0; i < 9; ++i) outs[i] = buf[i].data();
+
+    f.evaluateDerivativesMany(ts.data(), N, 2, outs);
+    for (std::size_t i = 0; i < N; ++i) {
+        double d[3];
+        f.evaluateDerivatives(ts[i], 2, d);
+        for (int j = 0; j < 3; ++j) assert(close(buf[j][i], d[j]));
+    }
+
+    c3.evaluateDerivativesMany(ts.data(), N, 2, outs);
+    for (std::size_t i = 0; i < N; ++i) {
+        GeoAlgo::Vec3d d[3];
+        c3.evaluateDerivatives(ts[i], 2, d);
+        for (int j = 0; j < 3; ++j)
+            for (int c = 0; c < 3; ++c) assert(close(buf[3 * j + c][i], d[j][c]));
+    }
+
+    c2.evaluateDerivativesMany(ts.data(), N, 3, outs);
+    for (std::size_t i = 0; i < N; ++i) {
+        GeoAlgo::Vec2d d[4];
+        c2.evaluateDerivatives(ts[i], 3, d);
+        for (int j = 0; j < 4; ++j)
+            for (int c = 0; c < 2; ++c) assert(close(buf[2 * j + c][i], d[j][c]));
+    }
+
+    // 高于次数的导数为零；系数表超过栈容量时须由调用者提供 scratch，不做堆分配
+    {
+        std::vector<double> coeffs(40);
+        for (int i = 0; i < 40; ++i) coeffs[i] = 1.0 / (i + 1);
+        const PowerBasisCurve1D g(coeffs);
+        const int k = 20;
+        std::vector<std::vector<double>> gbuf(k + 1, std::vector<double>(N));
+        std::vector<double*> gouts(k + 1);
+        for (int j = 0; j <= k; ++j) gouts[j] = gbuf[j].data();
+        // 系数表超过栈容量：不给 scratch 时按导数分批，与一次算出整张表的结果相同
+        std::vector<double> scratch(GeoAlgo::powerBasisDerivativeTableSize(1, 40, k));
+        assert(scratch.size() > GeoAlgo::kDerivativeTableCapacity);
+        g.evaluateDerivativesMany(ts.data(), N, k, gouts.data(), scratch.data());
+        std::vector<std::vector<double>> batched(k + 1, std::vector<double>(N));
+        std::vector<double*> bouts(k + 1);
+        for (int j = 0; j <= k; ++j) bouts[j] = batched[j].data();
+        g.evaluateDerivativesMany(ts.data(), N, k, bouts.data());
+        assert(batched == gbuf);
+        std::vector<double> d(k + 1);
+        for (std::size_t i = 0; i < N; i += 6) {
+            g.evaluateDerivatives(ts[i], k, d.data());
+            for (int j = 0; j <= k; ++j) assert(std::fabs(gbuf[j][i] - d[j]) <= 1e-9 * (1.0 + std::fabs(d[j])));
+        }
+
+        // 单个多项式的系数就放不下栈缓冲区时须提供 scratch
+        const PowerBasisCurve1D huge(std::vector<double>(GeoAlgo::kDerivativeTableCapacity + 1, 1.0));
+        bool threw = false;
+        try {
+            huge.evaluateDerivativesMany(ts.data(), N, 0, gouts.data());
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+
+        // c2 为三次，四阶导数的两个分量写零
+        c2.evaluateDerivativesMany(ts.data(), N, 4, gouts.data());
+        for (std::size_t i = 0; i < N; ++i) assert(gbuf[8][i] == 0.0 && gbuf[9][i] == 0.0);
+    }
+
+    std::cout << "✅ Power-basis derivatives test passed!" << std::endl;
+    return 0;
+}
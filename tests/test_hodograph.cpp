@@ -0,0 +1,96 @@
+#include "BezierCurve.h"
+#include "NURBS.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace GeoAlgo;
+
+static bool near(double a, double b, double tol) {
+    return std::fabs(a - b) <= tol * (1.0 + std::fabs(b));
+}
+
+int main() {
+    // Bezier：导数与 hodograph 曲线、中心差分一致
+    BezierCurve bez({Point2D(0, 0), Point2D(1, 3), Point2D(3, -1), Point2D(4, 2), Point2D(6, 0)});
+    BezierCurve h1 = bez.hodograph();
+    BezierCurve h2 = h1.hodograph();
+    assert(h1.degree() == 3 && h2.degree() == 2);
+    const double e = 1e-5;
+    for (double u : {0.0, 0.2, 0.5, 0.77, 1.0}) {
+        Point2D d[6];
+        bez.evaluateDerivatives(u, 5, d);
+        assert(d[0].distanceTo(bez.evaluate(u)) < 1e-12);
+        assert(d[1].distanceTo(h1.evaluate(u)) < 1e-10);
+        assert(d[2].distanceTo(h2.evaluate(u)) < 1e-9);
+        assert(d[5] == Point2D(0, 0));
+        assert(bez.derivative(u) == d[1] && bez.derivative(u, 3) == d[3]);
+        Point2D fd = (bez.evaluate(u + e) - bez.evaluate(u - e)) / (2 * e);
+        assert(near(d[1].x, fd.x, 1e-6) && near(d[1].y, fd.y, 1e-6));
+    }
+    // 四次曲线的四阶导数为常数 4! * Δ^4 P_0
+    Point2D d4 = bez.derivative(0.3, 4);
+    assert(near(d4.x, 24.0 * (6 - 4 * 4 + 6 * 3 - 4 * 1 + 0), 1e-12));
+    assert(near(d4.y, 24.0 * (0 - 4 * 2 + 6 * -1 - 4 * 3 + 0), 1e-12));
+
+    // 批量
+    std::vector<double> us;
+    for (int i = 0; i <= 20; ++i) us.push_back(i / 20.0);
+    std::vector<Point2D> many(us.size() * 3);
+    bez.evaluateDerivativesMany(us.data(), us.size(), 2, many.data());
+    for (std::size_t i = 0; i < us.size(); ++i) {
+        Point2D d[3];
+        bez.evaluateDerivatives(us[i], 2, d);
+        for (int j = 0; j < 3; ++j) assert(many[i * 3 + j] == d[j]);
+    }
+
+    // 有理曲线：单位圆四分之一，切向与位置正交，二阶导数满足 |C|=1 的约束
+    const double s = std::sqrt(0.5);
+    NURBS arc(2, {Point2D(1, 0), Point2D(1, 1), Point2D(0, 1)}, {0, 0, 0, 1, 1, 1}, {1.0, s, 1.0});
+    for (double u : {0.0, 0.1, 0.5, 0.9, 1.0}) {
+        Vec3d d[3];
+        arc.evaluateDerivatives(u, 2, d);
+        assert(near(d[0].norm(), 1.0, 1e-12));
+        assert(std::fabs(d[0].dot(d[1])) < 1e-12);
+        // d²/du² |C|² = 2(|C'|² + C·C'') = 0
+        assert(std::fabs(d[1].squaredNorm() + d[0].dot(d[2])) < 1e-10);
+        Point2D p[2];
+        arc.evaluateDerivatives(u, 1, p);
+        assert(p[0].distanceTo(arc.evaluatePoint(u)) < 1e-12);
+    }
+
+    // 非均匀三次 B 样条：与中心差分比较，批量与逐点一致
+    NURBS spl(3, 3, {0, 0, 0, 1, 2, 0, 2, -1, 1, 4, 0, 2, 5, 3, 0, 7, 1, -1},
+              {0, 0, 0, 0, 0.3, 0.5, 1, 1, 1, 1}, {1, 2, 0.5, 1, 3, 1});
+    for (double u : {0.05, 0.3, 0.42, 0.75, 0.95}) {
+        Vec3d d[5];
+        spl.evaluateDerivatives(u, 4, d);
+        Vec3d p0 = spl.evaluatePoint3D(u - e), p1 = spl.evaluatePoint3D(u + e);
+        Vec3d fd = (p1 - p0) / (2 * e);
+        Vec3d fd2 = (p1 - d[0] * 2.0 + p0) / (e * e);
+        for (int c = 0; c < 3; ++c) {
+            assert(near(d[1][c], fd[c], 1e-5));
+            assert(near(d[2][c], fd2[c], 1e-2));
+        }
+    }
+    std::vector<Vec3d> nd(us.size() * 3);
+    spl.evaluateDerivativesMany(us.data(), us.size(), 2, nd.data());
+    for (std::size_t i = 0; i < us.size(); ++i) {
+        Vec3d d[3];
+        spl.evaluateDerivatives(us[i], 2, d);
+        for (int j = 0; j < 3; ++j) assert(nd[i * 3 + j] == d[j]);
+    }
+
+    bool threw = false;
+    try {
+        Vec3d d[1];
+        spl.evaluateDerivatives(0.5, -1, d);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "✅ Hodograph / NURBS derivative test passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include "AdaptiveTessellator.h"
+#include "BezierCurve.h"
+#include "Instrumentation.h"
+#include "NURBS.h"
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace GeoAlgo;
+using namespace GeoAlgo::instrumentation;
+
+// 析构晚于计数块注销（先于它构造）的线程局部对象
+struct LateCounter {
+    ~LateCounter() { count(Counter::KnotInsertions, 7); }
+};
+
+int main() {
+    // 名称表与枚举一一对应
+    assert(std::string(counterName(Counter::BezierEvaluations)) == "bezier_evaluations");
+    assert(std::string(counterName(Counter::Deallocations)) == "deallocations");
+    assert(std::string(timerName(Timer::ArcLengthBuild)) == "arc_length_build");
+
+    // 计数接口本身与开关无关：多线程各自计数，汇总精确（含已退出线程）
+    reset();
+    const Snapshot base = snapshot();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([] {
+            for (int i = 0; i < 1000; ++i) count(Counter::KnotInsertions);
+            count(Counter::TessellationPoints, 5);
+        });
+    for (std::thread& t : threads) t.join();
+    count(Counter::KnotInsertions, 3);
+    {
+        ScopedTimer timer(Timer::Intersection);
+    }
+    const Snapshot delta = snapshot() - base;
+    assert(delta.counter(Counter::KnotInsertions) == 4003);
+    assert(delta.counter(Counter::TessellationPoints) == 20);
+    assert(delta.timer(Timer::Intersection).calls == 1);
+
+    const std::string text = delta.toText();
+    assert(text.find("knot_insertions 4003\n") != std::string::npos);
+    const std::string json = delta.toJson();
+    assert(json.front() == '{' && json.back() == '}');
+    assert(json.find("\"knot_insertions\": 4003") != std::string::npos);
+    assert(json.find("\"intersection\": {\"calls\": 1,") != std::string::npos);
+
+    reset();
+    assert(snapshot().counter(Counter::KnotInsertions) == 0);
+
+    // 线程退出阶段、计数块注销之后的计数被丢弃，不再登记新块
+    std::thread([] {
+        static thread_local LateCounter late;
+        (void)late;
+        count(Counter::KnotInsertions);
+    }).join();
+    assert(snapshot().counter(Counter::KnotInsertions) == 1);
+    reset();
+
+    // 库内插桩只在开启 GEOALGO_ENABLE_INSTRUMENTATION 编译时生效
+    const BezierCurve curve({Point2D(0, 0), Point2D(1, 2), Point2D(2, -1), Point2D(3, 1)});
+    const Snapshot before = snapshot();
+    std::vector<double> us(10);
+    std::vector<Point2D> out(us.size());
+    for (std::size_t i = 0; i < us.size(); ++i) us[i] = i / 9.0;
+    curve.evaluateMany(us.data(), us.size(), out.data());
+    const AdaptiveTessellator tess(1e-3);
+    std::vector<Point2D> pts(1024);
+    const std::size_t n = tess.tessellate(curve, pts.data(), pts.size());
+    const NURBS nurbs(3, {Point2D(0, 0), Point2D(1, 1), Point2D(2, 0), Point2D(3, 1), Point2D(4, 0)},
+                      NURBS::clampedUniformKnots(5, 3));
+    const NURBS refined = nurbs.insertKnot(0.3, 2);
+    std::vector<double> buffer(1 << 16);
+    const Snapshot after = snapshot() - before;
+
+    // 分段离散的 NURBS 只计一条曲线，点数为返回值（段间共享端点不重复计）
+    assert(nurbs.numBezierSegments() > 1);
+    std::vector<Vec3d> bounded(1024);
+    const Snapshot beforeBounded = snapshot();
+    const std::size_t m = tess.tessellateBounded(nurbs, bounded.data(), bounded.size());
+    const Snapshot afterBounded = snapshot() - beforeBounded;
+
+    if (libraryInstrumented()) {
+        assert(after.counter(Counter::BezierEvaluations) == 10);
+        assert(after.counter(Counter::TessellatedCurves) == 1);
+        assert(after.counter(Counter::TessellationPoints) == n);
+        assert(after.timer(Timer::Tessellation).calls == 1);
+        assert(afterBounded.counter(Counter::TessellatedCurves) == 1);
+        assert(afterBounded.counter(Counter::TessellationPoints) == m);
+        assert(afterBounded.timer(Timer::Tessellation).calls == 1);
+        assert(after.counter(Counter::KnotInsertions) == 2);
+        assert(after.counter(Counter::Allocations) >= 1);
+        assert(after.counter(Counter::AllocatedBytes) >= buffer.size() * sizeof(double));
+    } else {
+        for (int i = 0; i < kNumCounters; ++i) assert(after.counters[i] == 0);
+        for (int i = 0; i < kNumTimers; ++i) assert(after.timers[i].calls == 0);
+    }
+    (void)refined;
+    (void)m;
+
+    std::cout << "✅ Instrumentation test passed! (library instrumented: "
+              << (libraryInstrumented() ? "yes" : "no") << ")" << std::endl;
+    return 0;
+}
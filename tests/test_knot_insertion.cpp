@@ -0,0 +1,175 @@
+#include "BezierSegments.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace GeoAlgo;
+
+// 两条曲线在定义域内逐点一致
+static double maxDeviation(const NURBS& a, const NURBS& b) {
+    assert(a.firstParam() == b.firstParam() && a.lastParam() == b.lastParam());
+    double err = 0.0;
+    for (int i = 0; i <= 400; ++i) {
+        const double u = a.firstParam() + (a.lastParam() - a.firstParam()) * i / 400.0;
+        err = std::max(err, a.evaluatePoint3D(u).distanceTo(b.evaluatePoint3D(u)));
+    }
+    return err;
+}
+
+static NURBS randomCurve(std::mt19937& rng, int degree, int dim, int numPoints, bool clamped) {
+    std::uniform_real_distribution<double> coord(-2.0, 2.0);
+    std::uniform_real_distribution<double> weight(0.3, 2.5);
+    std::vector<double> pts, w;
+    for (int i = 0; i < numPoints * dim; ++i) pts.push_back(coord(rng));
+    for (int i = 0; i < numPoints; ++i) w.push_back(weight(rng));
+    std::vector<double> knots;
+    if (clamped) {
+        knots = NURBS::clampedUniformKnots(numPoints, degree);
+        // 打乱内部节点间距，并制造一个二重节点
+        for (int i = degree + 1; i < numPoints; ++i) knots[i] += 0.3 * (knots[i] - knots[i - 1]);
+        if (numPoints > degree + 2 && degree >= 2) knots[degree + 2] = knots[degree + 1];
+    } else {
+        for (int i = 0; i < numPoints + degree + 1; ++i) knots.push_back(i + 0.25 * (i % 3));
+    }
+    return NURBS(degree, dim, pts, knots, w);
+}
+
+int main() {
+    std::mt19937 rng(11);
+
+    // Boehm 插入与 Oslo/A5.4 细化：曲线不变，节点与控制点个数正确
+    for (int degree : {1, 2, 3, 5}) {
+        const NURBS c = randomCurve(rng, degree, 3, degree + 6, true);
+        const double u = 0.37 * c.firstParam() + 0.63 * c.lastParam();
+        const NURBS c1 = c.insertKnot(u);
+        assert(c1.numControlPoints() == c.numControlPoints() + 1);
+        assert(maxDeviation(c, c1) < 1e-13);
+        const NURBS c2 = c.insertKnot(u, degree);
+        assert(c2.numControlPoints() == c.numControlPoints() + degree);
+        assert(maxDeviation(c, c2) < 1e-13);
+        // p 重节点处曲线过控制点
+        bool found = false;
+        for (const Vec4d& h : c2.homogeneousPoints())
+            found = found || fromHomogeneous<3>(h).distanceTo(c.evaluatePoint3D(u)) < 1e-13;
+        assert(found);
+
+        std::vector<double> X;
+        std::uniform_real_distribution<double> param(c.firstParam(), c.lastParam());
+        for (int i = 0; i < 12; ++i) X.push_back(param(rng));
+        X.push_back(u);
+        std::sort(X.begin(), X.end());
+        const NURBS r = c.refineKnots(X);
+        assert(r.numControlPoints() == c.numControlPoints() + static_cast<int>(X.size()));
+        assert(maxDeviation(c, r) < 1e-13);
+        // 与逐个 Boehm 插入的结果一致
+        NURBS seq = c;
+        for (double x : X) seq = seq.insertKnot(x);
+        for (std::size_t i = 0; i < seq.knots().size(); ++i) assert(seq.knots()[i] == r.knots()[i]);
+        for (int i = 0; i < seq.numControlPoints(); ++i)
+            assert((seq.homogeneousPoints()[i] - r.homogeneousPoints()[i]).norm() < 1e-12);
+    }
+
+    // 重数超过次数、越出定义域时抛出
+    {
+        const NURBS c = randomCurve(rng, 3, 2, 8, true);
+        bool threw = false;
+        try {
+            c.insertKnot(c.firstParam());
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+        threw = false;
+        try {
+            c.refineKnots({c.lastParam() + 1.0});
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    // 非 clamped 节点向量：clamped() 与分解保持定义域与形状
+    {
+        const NURBS c = randomCurve(rng, 3, 2, 9, false);
+        const NURBS cc = c.clamped();
+        assert(cc.numControlPoints() == c.numBezierSegments() + 3);
+        assert(maxDeviation(c, cc) < 1e-12);
+    }
+
+    // Bezier 分解：每段在局部参数下与原曲线一致
+    for (bool clamped : {true, false}) {
+        const NURBS c = randomCurve(rng, 4, 3, 11, clamped);
+        const int segs = c.numBezierSegments();
+        std::vector<Vec4d> pts(static_cast<std::size_t>(segs) * 5);
+        std::vector<double> breaks(segs + 1);
+        c.decomposeToBezier(pts.data(), breaks.data());
+        assert(breaks.front() == c.firstParam() && breaks.back() == c.lastParam());
+        for (int s = 0; s < segs; ++s) {
+            std::vector<Vec3d> cp;
+            std::vector<double> w;
+            for (int i = 0; i < 5; ++i) {
+                cp.push_back(fromHomogeneous<3>(pts[s * 5 + i]));
+                w.push_back(pts[s * 5 + i].w);
+            }
+            const RationalBezierCurve seg(cp, w);
+            for (int i = 0; i <= 20; ++i) {
+                const double t = i / 20.0;
+                const double u = breaks[s] + (breaks[s + 1] - breaks[s]) * t;
+                assert(seg.evaluate3D(t).distanceTo(c.evaluatePoint3D(u)) < 1e-12);
+            }
+        }
+    }
+
+    // 曲线集合的并行分解：连续存储、与线程数无关，段上求值与 NURBS 一致
+    std::vector<NURBS> curves;
+    for (int i = 0; i < 300; ++i) curves.push_back(randomCurve(rng, 1 + i % 5, 2 + i % 2, 8 + i % 7, i % 4 != 0));
+    ThreadPool pool1(1), pool4(4);
+    const BezierSegments a(curves.data(), curves.size(), pool1);
+    const BezierSegments b(curves.data(), curves.size(), pool4);
+    assert(a.numCurves() == curves.size() && a.numSegments() == b.numSegments());
+    for (std::size_t s = 0; s < a.numSegments(); ++s)
+        for (int i = 0; i <= a.degree(s); ++i) assert(a.controlPoints(s)[i] == b.controlPoints(s)[i]);
+    std::vector<double> us(500);
+    std::vector<Vec3d> out(us.size());
+    for (std::size_t c = 0; c < curves.size(); ++c) {
+        assert(a.numSegments(c) == static_cast<std::size_t>(curves[c].numBezierSegments()));
+        for (std::size_t i = 0; i < us.size(); ++i)
+            us[i] = curves[c].firstParam() + (curves[c].lastParam() - curves[c].firstParam()) * i / (us.size() - 1);
+        a.evaluateMany(c, us.data(), us.size(), out.data());
+        for (std::size_t i = 0; i < us.size(); i += 7) {
+            const Vec3d expect = curves[c].evaluatePoint3D(us[i]);
+            assert(out[i].distanceTo(expect) < 1e-11);
+            assert(a.evaluate(c, us[i]).distanceTo(expect) < 1e-11);
+        }
+    }
+
+    // 多项式段转为 BezierCurve，有理段拒绝
+    {
+        const std::vector<double> knots = NURBS::clampedUniformKnots(6, 3);
+        const NURBS poly(3, {Point2D(0, 0), Point2D(1, 2), Point2D(2, -1), Point2D(3, 3), Point2D(4, 0), Point2D(5, 1)},
+                         knots);
+        const BezierSegments segs(&poly, 1);
+        assert(segs.numSegments() == 3);
+        for (std::size_t s = 0; s < segs.numSegments(); ++s) {
+            const BezierCurve bc = segs.bezier(s);
+            const double* B = segs.breaks(0);
+            for (int i = 0; i <= 10; ++i) {
+                const double u = B[s] + (B[s + 1] - B[s]) * i / 10.0;
+                assert(bc.evaluate(i / 10.0).distanceTo(poly.evaluatePoint(u)) < 1e-13);
+            }
+        }
+        bool threw = false;
+        try {
+            a.bezier(a.curveBegin(1));
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    std::cout << "✅ Knot insertion and Bezier decomposition test passed!" << std::endl;
+    return 0;
+}
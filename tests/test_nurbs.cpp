@@ -1,12 +1,79 @@
 #include "NURBS.h"
+#include "BezierCurve.h"
 #include <cassert>
+#include <cmath>
 #include <iostream>
+#include <vector>
+
+using namespace GeoAlgo;
 
 int main() {
     GeoAlgo::NURBS nurbs({0, 1, 2}, 2);
     double v = nurbs.evaluate(0.5);
     std::cout << "Test evaluate(0.5) = " << v << std::endl;
     assert(v >= 0 && v <= 2);
+    assert(std::fabs(v - 1.0) < 1e-15);
+
+    // 单段 clamped 节点、权重为 1 时退化为 Bezier 曲线
+    std::vector<Point2D> ctrl = {{0, 0}, {1, 2}, {3, 3}, {4, 0}};
+    NURBS cubic(3, ctrl, NURBS::clampedUniformKnots(4, 3));
+    BezierCurve bezier(ctrl);
+    for (int k = 0; k <= 20; ++k) {
+        double u = k / 20.0;
+        assert(cubic.evaluatePoint(u).distanceTo(bezier.evaluate(u)) < 1e-12);
+    }
+
+    // 有理二次曲线精确表示四分之一单位圆
+    const double w = std::sqrt(0.5);
+    NURBS arc(2, {{1, 0}, {1, 1}, {0, 1}}, {0, 0, 0, 1, 1, 1}, {1, w, 1});
+    for (int k = 0; k <= 20; ++k) {
+        Point2D p = arc.evaluatePoint(k / 20.0);
+        assert(std::fabs(std::hypot(p.x, p.y) - 1.0) < 1e-14);
+    }
+
+    // 多段曲线（含重节点）：基函数单位分解，批量求值与逐点求值一致
+    std::vector<double> pts3d;
+    for (int i = 0; i < 9; ++i) {
+        pts3d.push_back(i);
+        pts3d.push_back(std::sin(i));
+        pts3d.push_back(0.1 * i * i);
+    }
+    std::vector<double> knots = {0, 0, 0, 0, 0.1, 0.3, 0.3, 0.6, 0.8, 1, 1, 1, 1};
+    std::vector<double> weights = {1, 2, 0.5, 1, 3, 1, 1, 0.7, 1};
+    NURBS curve3d(3, 3, pts3d, knots, weights);
+    assert(curve3d.numControlPoints() == 9);
+    assert(curve3d.findSpan(0.0) == 3);
+    assert(curve3d.findSpan(0.3) == 6);
+    assert(curve3d.findSpan(1.0) == 8);
+
+    const int N = 257;
+    std::vector<double> us(N);
+    for (int k = 0; k < N; ++k) us[k] = static_cast<double>(k) / (N - 1);
+    std::vector<double> batch(N * 3);
+    curve3d.evaluateMany(us.data(), N, batch.data());
+    for (int k = 0; k < N; ++k) {
+        double basis[NURBS::kMaxDegree + 1];
+        int span = curve3d.findSpan(us[k]);
+        curve3d.basisFunctions(span, us[k], basis);
+        double sum = 0;
+        for (int j = 0; j <= 3; ++j) sum += basis[j];
+        assert(std::fabs(sum - 1.0) < 1e-14);
+
+        double p[3];
+        curve3d.evaluate(us[k], p);
+        for (int d = 0; d < 3; ++d) assert(std::fabs(p[d] - batch[k * 3 + d]) < 1e-14);
+    }
+
+    // 乱序参数同样正确
+    std::vector<double> shuffled = {0.9, 0.05, 0.31, 0.3, 1.0, 0.0, 0.65};
+    std::vector<double> out(shuffled.size() * 3);
+    curve3d.evaluateMany(shuffled.data(), shuffled.size(), out.data());
+    for (std::size_t k = 0; k < shuffled.size(); ++k) {
+        double p[3];
+        curve3d.evaluate(shuffled[k], p);
+        for (int d = 0; d < 3; ++d) assert(p[d] == out[k * 3 + d]);
+    }
+
     std::cout << "✅ NURBS basic test passed!" << std::endl;
     return 0;
 }
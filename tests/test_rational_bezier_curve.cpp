@@ -0,0 +1,96 @@
+#include "NURBS.h"
+#include "RationalBezierCurve.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace GeoAlgo;
+
+// 同一控制点与权重、节点全部位于两端的 NURBS 即为有理 Bezier 曲线
+static NURBS asNURBS(const std::vector<Vec3d>& pts, const std::vector<double>& w) {
+    const int n = static_cast<int>(pts.size()) - 1;
+    std::vector<double> flat;
+    for (const Vec3d& p : pts) flat.insert(flat.end(), {p.x, p.y, p.z});
+    std::vector<double> knots(n + 1, 0.0);
+    knots.insert(knots.end(), n + 1, 1.0);
+    return NURBS(n, 3, flat, knots, w);
+}
+
+int main() {
+    // 四分之一圆弧：二次，中间权重 √2/2
+    const double h = std::sqrt(0.5);
+    RationalBezierCurve arc({Point2D(1, 0), Point2D(1, 1), Point2D(0, 1)}, {1.0, h, 1.0});
+    assert(arc.degree() == 2 && arc.dimension() == 2);
+    std::vector<double> us(1000);
+    for (std::size_t i = 0; i < us.size(); ++i) us[i] = static_cast<double>(i) / (us.size() - 1);
+    std::vector<Point2D> pts(us.size());
+    arc.evaluateMany(us.data(), us.size(), pts.data());
+    for (std::size_t i = 0; i < us.size(); ++i) {
+        assert(std::fabs(pts[i].norm() - 1.0) < 1e-14);
+        assert(pts[i].distanceTo(arc.evaluate(us[i])) < 1e-14);
+        // 切向与半径垂直
+        assert(std::fabs(arc.derivative(us[i]).dot(pts[i])) < 1e-12);
+    }
+    assert(arc.evaluate(0.0).distanceTo(Point2D(1, 0)) == 0.0);
+    assert(arc.evaluate(1.0).distanceTo(Point2D(0, 1)) == 0.0);
+
+    // 与 NURBS 对照：幂基批量路径（低次）与 Bernstein 路径（高次）
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> coord(-1.0, 1.0);
+    std::uniform_real_distribution<double> weight(0.2, 3.0);
+    for (int degree : {1, 3, 5, 8, 10, 13}) {
+        std::vector<Vec3d> cp;
+        std::vector<double> w;
+        for (int i = 0; i <= degree; ++i) {
+            cp.emplace_back(coord(rng), coord(rng), coord(rng));
+            w.push_back(weight(rng));
+        }
+        RationalBezierCurve curve(cp, w);
+        const NURBS ref = asNURBS(cp, w);
+        assert(curve.controlPoint(1).distanceTo(cp[1]) < 1e-15 && curve.weight(1) == w[1]);
+
+        std::vector<Vec3d> many(us.size());
+        std::vector<double> xs(us.size()), ys(us.size()), zs(us.size());
+        curve.evaluateMany(us.data(), us.size(), many.data());
+        curve.evaluateMany(us.data(), us.size(), xs.data(), ys.data(), zs.data());
+        for (std::size_t i = 0; i < us.size(); ++i) {
+            const Vec3d expect = ref.evaluatePoint3D(us[i]);
+            assert(curve.evaluate3D(us[i]).distanceTo(expect) < 1e-13);
+            assert(many[i].distanceTo(expect) < 1e-10);
+            assert(many[i].distanceTo(Vec3d(xs[i], ys[i], zs[i])) == 0.0);
+        }
+
+        Vec3d d[2];
+        for (double u : {0.0, 0.3, 0.77, 1.0}) {
+            ref.evaluateDerivatives(u, 1, d);
+            assert(curve.derivative3D(u).distanceTo(d[1]) < 1e-10 * (1.0 + d[1].norm()));
+        }
+    }
+
+    // 二维曲线的 SoA 输出：z 为零，可省略
+    std::vector<double> xs(us.size()), ys(us.size()), zs(us.size(), 5.0);
+    arc.evaluateMany(us.data(), us.size(), xs.data(), ys.data(), zs.data());
+    for (std::size_t i = 0; i < us.size(); ++i) assert(zs[i] == 0.0 && xs[i] == pts[i].x && ys[i] == pts[i].y);
+
+    // 非法输入
+    bool threw = false;
+    try {
+        RationalBezierCurve({Point2D(0, 0), Point2D(1, 0)}, {1.0, 0.0});
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    threw = false;
+    try {
+        RationalBezierCurve({Point2D(0, 0), Point2D(1, 0)}, {1.0});
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "✅ Rational Bezier curve test passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include "SamplingPlan.h"
+#include <cassert>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace GeoAlgo;
+
+int main() {
+    // 共享节点的多条有理曲线
+    std::vector<double> knots = {0, 0, 0, 0, 0.25, 0.5, 0.5, 0.75, 1, 1, 1, 1};
+    std::vector<NURBS> curves;
+    for (int c = 0; c < 5; ++c) {
+        std::vector<Point2D> ctrl;
+        std::vector<double> w;
+        for (int i = 0; i < 8; ++i) {
+            ctrl.emplace_back(i + c, std::cos(i * 0.7 + c));
+            w.push_back(1.0 + 0.1 * ((i + c) % 3));
+        }
+        curves.emplace_back(3, ctrl, knots, w);
+    }
+
+    const int N = 101;
+    SamplingPlan plan(3, knots, N);
+    assert(plan.numSamples() == N);
+    assert(plan.params().front() == 0.0 && plan.params().back() == 1.0);
+
+    std::vector<double> batch(curves.size() * N * 2);
+    plan.evaluateBatch(curves.data(), curves.size(), batch.data());
+
+    std::vector<double> ref(N * 2);
+    for (std::size_t c = 0; c < curves.size(); ++c) {
+        curves[c].evaluateMany(plan.params().data(), N, ref.data());
+        for (int k = 0; k < N * 2; ++k)
+            assert(std::fabs(ref[k] - batch[c * N * 2 + k]) < 1e-13);
+    }
+
+    // Bezier 曲线使用 Bernstein 基
+    std::vector<Point2D> ctrl = {{0, 0}, {1, 2}, {3, 3}, {4, 0}};
+    BezierCurve bezier(ctrl);
+    SamplingPlan bplan = SamplingPlan::forBezier(3, N);
+    assert(bplan.matches(bezier) && !plan.matches(bezier));
+    std::vector<Point2D> pts(N);
+    bplan.evaluate(bezier, pts.data());
+    for (int k = 0; k < N; ++k)
+        assert(pts[k].distanceTo(bezier.evaluate(bplan.params()[k])) < 1e-13);
+
+    bool threw = false;
+    try {
+        plan.evaluate(bezier, pts.data());
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // 节点向量非降且定义域非空；控制点数与维数须与计划一致
+    auto rejects = [](const std::function<void()>& f) {
+        try {
+            f();
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    };
+    assert(plan.numControlPoints() == 8);
+    assert(rejects([] { SamplingPlan(2, {0, 0, 0, 0.6, 0.4, 1, 1, 1}, 5); }));
+    assert(rejects([] { SamplingPlan(1, {0, 0, 0, 0}, 5); }));
+    std::vector<double> out(N * 3);
+    const Vec4d* Pw = curves[0].homogeneousPoints().data();
+    assert(rejects([&] { plan.evaluateHomogeneous(Pw, 7, 2, out.data()); }));
+    assert(rejects([&] { plan.evaluateHomogeneous(Pw, 8, 4, out.data()); }));
+    plan.evaluateHomogeneous(Pw, 8, 2, out.data());
+    assert(out[0] == batch[0] && out[2 * N - 1] == batch[2 * N - 1]);
+
+    // 缓存：命中返回同一对象，超出容量按 LRU 淘汰
+    SamplingPlanCache cache(2);
+    auto p1 = cache.get(3, knots, N);
+    auto p2 = cache.get(3, knots, N);
+    assert(p1 == p2 && cache.hits() == 1 && cache.misses() == 1);
+    auto b1 = cache.getBezier(3, N);
+    auto b2 = cache.getBezier(2, N); // 淘汰 (3, knots, N)
+    assert(cache.size() == 2);
+    assert(cache.getBezier(3, N) == b1);
+    assert(cache.get(3, knots, N) != p1);
+    assert(cache.size() == 2);
+    (void)b2;
+
+    std::cout << "✅ SamplingPlan test passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include "AdaptiveTessellator.h"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace GeoAlgo;
+
+// 折线相邻两点之间的曲线到弦的距离不超过容差
+template <typename Curve, typename Eval>
+static void checkWithinTolerance(const std::vector<double>& params, std::size_t count,
+                                 const Curve& curve, Eval eval, double tol) {
+    for (std::size_t k = 0; k + 1 < count; ++k) {
+        auto a = eval(curve, params[k]);
+        auto b = eval(curve, params[k + 1]);
+        auto ab = b - a;
+        for (int s = 1; s < 16; ++s) {
+            double t = params[k] + (params[k + 1] - params[k]) * s / 16.0;
+            auto p = eval(curve, t);
+            double len2 = ab.squaredNorm();
+            double r = len2 > 0 ? std::min(1.0, std::max(0.0, (p - a).dot(ab) / len2)) : 0.0;
+            assert(p.distanceTo(a + ab * r) <= tol * (1 + 1e-9));
+        }
+    }
+}
+
+int main() {
+    const double tol = 1e-3;
+    AdaptiveTessellator tess(tol);
+
+    BezierCurve bezier({{0, 0}, {1, 2}, {3, 3}, {4, 0}});
+    std::size_t need = tess.tessellate(bezier, nullptr, 0);
+    std::vector<Point2D> pts(need);
+    std::vector<double> params(need);
+    assert(tess.tessellate(bezier, pts.data(), pts.size(), params.data()) == need);
+    assert(pts.front() == Point2D(0, 0));
+    assert(pts.back().distanceTo(Point2D(4, 0)) < 1e-12);
+    assert(params.front() == 0.0 && params.back() == 1.0);
+    checkWithinTolerance(params, need, bezier,
+                         [](const BezierCurve& c, double u) { return c.evaluate(u); }, tol);
+
+    // 容差放宽则点数减少
+    assert(AdaptiveTessellator(1e-1).tessellate(bezier, nullptr, 0) < need);
+
+    // 直线只需两个点
+    BezierCurve line({{0, 0}, {1, 1}, {2, 2}, {3, 3}});
+    assert(tess.tessellate(line, nullptr, 0) == 2);
+
+    // 幂基曲线，任意参数区间
+    PowerBasisCurve2D c2({1.0, 1.0, 1.0}, {2.0, -1.0, 0.0, 0.3});
+    need = tess.tessellate(c2, -1.0, 2.0, nullptr, 0);
+    pts.resize(need);
+    params.resize(need);
+    tess.tessellate(c2, -1.0, 2.0, pts.data(), pts.size(), params.data());
+    assert(params.front() == -1.0 && params.back() == 2.0);
+    assert(pts.back().distanceTo(c2.evaluate(2.0)) < 1e-12);
+    checkWithinTolerance(params, need, c2,
+                         [](const PowerBasisCurve2D& c, double t) { return c.evaluate(t); }, tol);
+
+    PowerBasisCurve3D c3({0.0, 1.0}, {0.0, 0.0, 1.0}, {1.0, 0.0, 0.0, -2.0});
+    need = tess.tessellate(c3, 0.0, 1.0, nullptr, 0);
+    std::vector<Vec3d> pts3(need);
+    params.resize(need);
+    tess.tessellate(c3, 0.0, 1.0, pts3.data(), pts3.size(), params.data());
+    checkWithinTolerance(params, need, c3,
+                         [](const PowerBasisCurve3D& c, double t) { return c.evaluate(t); }, tol);
+
+    PowerBasisCurve pb({{0, 0}, {1, 2}, {0.5, 0.5}});
+    need = tess.tessellate(pb, 0.0, 1.0, nullptr, 0);
+    pts.resize(need);
+    tess.tessellate(pb, 0.0, 1.0, pts.data(), pts.size());
+    assert(pts.back().distanceTo(pb.evaluate(1.0)) < 1e-12);
+
+    // 有理二次曲线（四分之一圆）：所有点在圆上，弦高不超过容差
+    const double w = std::sqrt(0.5);
+    Vec4d arc[3] = {toHomogeneous(Vec2d(1, 0), 1.0), toHomogeneous(Vec2d(1, 1), w), toHomogeneous(Vec2d(0, 1), 1.0)};
+    need = tess.tessellateHomogeneous<2>(arc, 2, nullptr, 0);
+    pts.resize(need);
+    tess.tessellateHomogeneous<2>(arc, 2, pts.data(), pts.size());
+    for (std::size_t k = 0; k < need; ++k) assert(std::fabs(pts[k].norm() - 1.0) < 1e-14);
+    for (std::size_t k = 0; k + 1 < need; ++k) {
+        double half = 0.5 * pts[k].distanceTo(pts[k + 1]);
+        assert(1.0 - std::sqrt(1.0 - half * half) <= tol);
+    }
+
+    // 容量不足时只写入前 capacity 个点
+    std::vector<Point2D> small(3);
+    assert(tess.tessellate(bezier, small.data(), small.size()) > 3);
+
+    // 有界离散 NURBS：多段曲线的点在曲线上、参数单调且首末为定义域端点
+    std::vector<Point2D> ctrl = {{0, 0}, {1, 2}, {2, -1}, {3, 3}, {4, 0}, {5, 2}};
+    NURBS spline(3, ctrl, NURBS::clampedUniformKnots(6, 3));
+    std::vector<Vec3d> bounded(1024);
+    std::vector<double> bparams(1024);
+    bool truncated = true;
+    std::size_t n = tess.tessellateBounded(spline, bounded.data(), bounded.size(), bparams.data(), &truncated);
+    assert(!truncated && n > 4 && n < bounded.size());
+    assert(bparams[0] == spline.firstParam() && bparams[n - 1] == spline.lastParam());
+    for (std::size_t k = 0; k < n; ++k) {
+        assert(bounded[k].distanceTo(spline.evaluatePoint3D(bparams[k])) < 1e-12);
+        if (k) assert(bparams[k] > bparams[k - 1]);
+    }
+
+    // 超出上限：改为整个定义域上的等距采样
+    n = tess.tessellateBounded(spline, bounded.data(), 4, bparams.data(), &truncated);
+    assert(truncated && n == 4);
+    for (std::size_t k = 0; k < 4; ++k) {
+        assert(std::fabs(bparams[k] - (spline.firstParam() + k / 3.0)) < 1e-12);
+        assert(bounded[k].distanceTo(spline.evaluatePoint3D(bparams[k])) < 1e-12);
+    }
+
+    std::cout << "✅ AdaptiveTessellator test passed!" << std::endl;
+    return 0;
+}